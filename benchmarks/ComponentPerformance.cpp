@@ -1,7 +1,17 @@
+﻿#include "DoNotOptimize.hpp"
 #include "autogen/all.hpp"
+#include "fast_ber/util/Arena.hpp"
 
 #include "catch2/catch.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <new>
+#include <string>
+#include <utility>
 #include <vector>
 
 struct IntegerDefault
@@ -14,8 +24,39 @@ struct StringDefault
     constexpr static const char* get_value() noexcept { return "Test string!"; }
 };
 
+using BorrowedOctetString =
+    fast_ber::OctetString<fast_ber::ExplicitId<fast_ber::UniversalTag::octet_string>, fast_ber::StorageMode::borrowed>;
+using NativeInteger =
+    fast_ber::Integer<fast_ber::ExplicitId<fast_ber::UniversalTag::integer>, fast_ber::StorageMode::native>;
+using NativeReal = fast_ber::Real<fast_ber::ExplicitId<fast_ber::UniversalTag::real>, fast_ber::StorageMode::native>;
+
+using DynamicIntegerSequence =
+    fast_ber::SequenceOf<fast_ber::Integer<>, fast_ber::ExplicitId<fast_ber::UniversalTag::sequence>,
+                         fast_ber::StorageMode::dynamic>;
+using DynamicStringSequence =
+    fast_ber::SequenceOf<fast_ber::OctetString<>, fast_ber::ExplicitId<fast_ber::UniversalTag::sequence>,
+                         fast_ber::StorageMode::dynamic>;
+
+using fast_ber::benchmark::do_not_optimize;
+
 const int iterations = 1000000;
 
+// Heap allocations are counted so that decode benchmarks can report the allocations made by each decode
+static size_t allocation_count = 0;
+
+void* operator new(std::size_t size)
+{
+    allocation_count++;
+    if (void* memory = std::malloc(size))
+    {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+
 template <typename T>
 void component_benchmark_encode(const T& type, const std::string& type_name)
 {
@@ -26,6 +67,7 @@ void component_benchmark_encode(const T& type, const std::string& type_name)
         for (int i = 0; i < iterations; i++)
         {
             res = fast_ber::encode(std::span<uint8_t>(buffer), type);
+            do_not_optimize(buffer);
         }
     }
     REQUIRE(res.success);
@@ -39,17 +81,120 @@ void component_benchmark_decode(const T& type, const std::string& type_name)
 
     T decoded_copy;
 
-    fast_ber::DecodeResult res = {false};
+    // Storage of the decoded object is reused, so decodes after the first should not allocate
+    const std::span<uint8_t> encoded            = std::span<uint8_t>(buffer.data(), encode_result.length);
+    fast_ber::DecodeResult   res                = fast_ber::decode(encoded, decoded_copy);
+    const size_t             allocations_before = allocation_count;
     BENCHMARK("fast_ber        - decode " + type_name)
     {
         for (int i = 0; i < iterations; i++)
         {
-            res = fast_ber::decode(std::span<uint8_t>(buffer.data(), encode_result.length), decoded_copy);
+            res = fast_ber::decode(encoded, decoded_copy);
+            do_not_optimize(decoded_copy);
+        }
+    }
+    std::cout << "fast_ber        - decode " << type_name << ": "
+              << double(allocation_count - allocations_before) / iterations << " allocations per decode\n";
+    REQUIRE(res.success);
+}
+
+// Decode into a newly constructed object each iteration, so storage is not reused between decodes
+template <typename T>
+void component_benchmark_decode_new(const T& type, const std::string& type_name)
+{
+    std::array<uint8_t, 1000> buffer{};
+    fast_ber::EncodeResult    encode_result = fast_ber::encode(std::span<uint8_t>(buffer), type);
+
+    fast_ber::DecodeResult res                = {false};
+    const size_t           allocations_before = allocation_count;
+    BENCHMARK("fast_ber        - decode new " + type_name)
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            T decoded;
+            res = fast_ber::decode(std::span<uint8_t>(buffer.data(), encode_result.length), decoded);
+            do_not_optimize(decoded);
         }
     }
+    std::cout << "fast_ber        - decode new " << type_name << ": "
+              << double(allocation_count - allocations_before) / iterations << " allocations per decode\n";
     REQUIRE(res.success);
 }
 
+// As component_benchmark_decode_new, taking storage from an arena which is reset after each decode
+template <typename T>
+void component_benchmark_decode_arena(const T& type, const std::string& type_name)
+{
+    std::array<uint8_t, 1000> buffer{};
+    fast_ber::EncodeResult    encode_result = fast_ber::encode(std::span<uint8_t>(buffer), type);
+
+    fast_ber::Arena        arena;
+    fast_ber::DecodeResult res                = {false};
+    const size_t           allocations_before = allocation_count;
+    BENCHMARK("fast_ber        - decode arena " + type_name)
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            {
+                fast_ber::ArenaScope scope(arena);
+                T                    decoded;
+                res = fast_ber::decode(std::span<uint8_t>(buffer.data(), encode_result.length), decoded);
+                do_not_optimize(decoded);
+            }
+            arena.reset();
+        }
+    }
+    std::cout << "fast_ber        - decode arena " << type_name << ": "
+              << double(allocation_count - allocations_before) / iterations << " allocations per decode\n";
+    REQUIRE(res.success);
+}
+
+// Assigning to an Integer encodes the value, reading it back decodes the stored content
+void component_benchmark_assign(int64_t value, const std::string& type_name)
+{
+    fast_ber::Integer<> integer;
+    int64_t             sum = 0;
+    BENCHMARK("fast_ber        - assign, read " + type_name)
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            do_not_optimize(value);
+            integer = value;
+            sum += integer.value();
+        }
+    }
+    REQUIRE(integer.value() == value);
+    REQUIRE(sum != 0);
+}
+
+// Setting a time formats it as the stored string, reading it back parses that string
+template <typename T>
+void component_benchmark_time(const typename T::Value& value, const std::string& type_name)
+{
+    T                 time;
+    typename T::Value read               = {};
+    const size_t      allocations_before = allocation_count;
+    BENCHMARK("fast_ber        - set time " + type_name)
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            time.set_time(value);
+            do_not_optimize(time);
+        }
+    }
+    BENCHMARK("fast_ber        - read time " + type_name)
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            read = time.time();
+            do_not_optimize(read);
+        }
+    }
+    std::cout << "fast_ber        - set time, read time " << type_name << ": "
+              << double(allocation_count - allocations_before) / iterations << " allocations per set and read\n";
+    REQUIRE(read == value);
+}
+
 template <typename T1, typename T2>
 void component_benchmark_construct(const T2& initial_value, const std::string& type_name)
 {
@@ -58,6 +203,7 @@ void component_benchmark_construct(const T2& initial_value, const std::string& t
         for (int i = 0; i < iterations; i++)
         {
             T1 t1(initial_value);
+            do_not_optimize(t1);
         }
     }
 }
@@ -70,6 +216,7 @@ void component_benchmark_default_construct(const std::string& type_name)
         for (int i = 0; i < iterations; i++)
         {
             T1 t1{};
+            do_not_optimize(t1);
         }
     }
 }
@@ -77,6 +224,7 @@ void component_benchmark_default_construct(const std::string& type_name)
 TEST_CASE("Component Performance: Encode")
 {
     component_benchmark_encode(fast_ber::Integer<>(-99999999), "Integer");
+    component_benchmark_encode(NativeInteger(-99999999), "Integer (Native)");
     component_benchmark_encode(fast_ber::Default<fast_ber::Integer<>, IntegerDefault>(-99999999), "Default Integer");
     component_benchmark_encode(fast_ber::Boolean<>(true), "Boolean");
     component_benchmark_encode(fast_ber::OctetString<>("Test string!"), "OctetString");
@@ -97,9 +245,11 @@ TEST_CASE("Component Performance: Encode")
 TEST_CASE("Component Performance: Decode")
 {
     component_benchmark_decode(fast_ber::Integer<>(-99999999), "Integer");
+    component_benchmark_decode(NativeInteger(-99999999), "Integer (Native)");
     component_benchmark_decode(fast_ber::Default<fast_ber::Integer<>, IntegerDefault>(-99999999), "Default Integer");
     component_benchmark_decode(fast_ber::Boolean<>(true), "Boolean");
     component_benchmark_decode(fast_ber::OctetString<>("Test string!"), "OctetString");
+    component_benchmark_decode(BorrowedOctetString("Test string!"), "OctetString (Borrowed)");
     component_benchmark_decode(fast_ber::Default<fast_ber::OctetString<>, StringDefault>("Test string!"),
                                "Default OctetString");
     component_benchmark_decode(fast_ber::Null<>(), "Null");
@@ -114,9 +264,195 @@ TEST_CASE("Component Performance: Decode")
     component_benchmark_decode(fast_ber::All::The_Choice(5), "Choice (Integer)");
 }
 
+TEST_CASE("Component Performance: Integer Widths")
+{
+    // Largest positive and smallest negative value encoded in each number of content octets
+    for (size_t width = 1; width <= sizeof(int64_t); width++)
+    {
+        const int64_t     positive = static_cast<int64_t>(std::numeric_limits<uint64_t>::max() >> (65 - width * 8));
+        const int64_t     negative = -positive - 1;
+        const std::string octets   = std::to_string(width) + (width == 1 ? " octet" : " octets");
+
+        component_benchmark_assign(positive, "Integer (" + octets + ", positive)");
+        component_benchmark_assign(negative, "Integer (" + octets + ", negative)");
+        component_benchmark_encode(NativeInteger(positive), "Integer (Native, " + octets + ", positive)");
+        component_benchmark_encode(NativeInteger(negative), "Integer (Native, " + octets + ", negative)");
+        component_benchmark_decode(NativeInteger(positive), "Integer (Native, " + octets + ", positive)");
+        component_benchmark_decode(NativeInteger(negative), "Integer (Native, " + octets + ", negative)");
+    }
+}
+
+TEST_CASE("Component Performance: Real")
+{
+    const std::vector<std::pair<double, std::string>> values = {
+        {1.0, "1"}, {0.1, "0.1"}, {-1234.5678, "-1234.5678"}, {1e300, "1e300"}, {1e-310, "1e-310 (Subnormal)"}};
+    for (const auto& [value, name] : values)
+    {
+        component_benchmark_encode(NativeReal(value), "Real (Native, " + name + ")");
+        component_benchmark_decode(NativeReal(value), "Real (Native, " + name + ")");
+    }
+
+    // Decimal forms are only decoded, values are always encoded in binary form
+    const std::string    decimal = "-1234,5678E-3";
+    std::vector<uint8_t> content = {0x03};
+    content.insert(content.end(), decimal.begin(), decimal.end());
+    double decoded = 0;
+    bool   success = false;
+    BENCHMARK("fast_ber        - decode content Real (Decimal, " + decimal + ")")
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            success = fast_ber::decode_real(content, decoded);
+            do_not_optimize(decoded);
+        }
+    }
+    REQUIRE(success);
+}
+
+TEST_CASE("Component Performance: Time")
+{
+    const fast_ber::TimePoint time =
+        fast_ber::TimePoint(std::chrono::seconds(1553029782)) + std::chrono::microseconds(250);
+    const std::chrono::sys_seconds seconds = std::chrono::floor<std::chrono::seconds>(time);
+
+    component_benchmark_time<fast_ber::GeneralizedTime<>>(time, "GeneralizedTime");
+    component_benchmark_time<fast_ber::UTCTime<>>(seconds, "UTCTime");
+    component_benchmark_time<fast_ber::DateTime<>>(seconds, "DateTime");
+    component_benchmark_time<fast_ber::Date<>>(std::chrono::floor<std::chrono::days>(time), "Date");
+    component_benchmark_time<fast_ber::TimeOfDay<>>(std::chrono::seconds(76182), "TimeOfDay");
+
+    component_benchmark_encode(fast_ber::GeneralizedTime<>(time), "GeneralizedTime");
+    component_benchmark_decode(fast_ber::GeneralizedTime<>(time), "GeneralizedTime");
+    component_benchmark_decode(fast_ber::UTCTime<>(time), "UTCTime");
+}
+
+TEST_CASE("Component Performance: ObjectIdentifier Match")
+{
+    // Match a decoded identifier against a set of known identifiers, as when dispatching on an algorithm or attribute
+    const std::vector<fast_ber::ObjectIdentifierComponents> known = {
+        {1, 2, 840, 113549, 1, 1, 1}, {1, 2, 840, 113549, 1, 1, 5}, {1, 2, 840, 10045, 4, 3, 2},
+        {2, 5, 4, 3},                 {2, 5, 29, 17},               {1, 2, 840, 113549, 1, 1, 11}};
+    const std::vector<fast_ber::ObjectIdentifier<>> known_oids(known.begin(), known.end());
+    const fast_ber::ObjectIdentifier<>              oid = known.back();
+
+    fast_ber::ObjectIdentifierTable table;
+    for (const fast_ber::ObjectIdentifier<>& known_oid : known_oids)
+    {
+        table.intern(known_oid);
+    }
+
+    size_t       match              = 0;
+    const size_t allocations_before = allocation_count;
+    BENCHMARK("fast_ber        - match value() ObjectIdentifier")
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            const fast_ber::ObjectIdentifierComponents components = oid.value();
+            match = std::find(known.begin(), known.end(), components) - known.begin();
+            do_not_optimize(match);
+        }
+    }
+    REQUIRE(match == known.size() - 1);
+    BENCHMARK("fast_ber        - match components ObjectIdentifier")
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            match = std::find_if(known.begin(), known.end(), [&](const auto& k) { return oid == k; }) - known.begin();
+            do_not_optimize(match);
+        }
+    }
+    REQUIRE(match == known.size() - 1);
+    BENCHMARK("fast_ber        - match content ObjectIdentifier")
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            match = std::find(known_oids.begin(), known_oids.end(), oid) - known_oids.begin();
+            do_not_optimize(match);
+        }
+    }
+    REQUIRE(match == known.size() - 1);
+    BENCHMARK("fast_ber        - match table ObjectIdentifier")
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            match = table.find(oid);
+            do_not_optimize(match);
+        }
+    }
+    REQUIRE(match == known.size());
+    std::cout << "fast_ber        - match ObjectIdentifier: "
+              << double(allocation_count - allocations_before) / iterations << " allocations per match\n";
+}
+
+TEST_CASE("Component Performance: SequenceOf Decode")
+{
+    component_benchmark_decode_new(fast_ber::SequenceOf<fast_ber::Integer<>>{1, 2, 3}, "SequenceOf (Integer)");
+    component_benchmark_decode_new(DynamicIntegerSequence{1, 2, 3}, "SequenceOf (Integer, Dynamic)");
+    component_benchmark_decode_new(fast_ber::SequenceOf<fast_ber::OctetString<>>{"first", "second"},
+                                   "SequenceOf (OctetString)");
+    component_benchmark_decode_new(DynamicStringSequence{"first", "second"}, "SequenceOf (OctetString, Dynamic)");
+
+    const DynamicStringSequence strings(20, fast_ber::OctetString<>(std::string(40, 'x')));
+    component_benchmark_decode(strings, "SequenceOf (OctetString x 20, Dynamic)");
+    component_benchmark_decode_new(strings, "SequenceOf (OctetString x 20, Dynamic)");
+}
+
+TEST_CASE("Component Performance: Arena Decode")
+{
+    component_benchmark_decode_new(DynamicIntegerSequence{1, 2, 3}, "SequenceOf (Integer, Dynamic)");
+    component_benchmark_decode_arena(DynamicIntegerSequence{1, 2, 3}, "SequenceOf (Integer, Dynamic)");
+
+    const DynamicStringSequence strings(20, fast_ber::OctetString<>(std::string(40, 'x')));
+    component_benchmark_decode_new(strings, "SequenceOf (OctetString x 20, Dynamic)");
+    component_benchmark_decode_arena(strings, "SequenceOf (OctetString x 20, Dynamic)");
+}
+
+// Record with the members of a typical call detail record, as a SET or SEQUENCE. Members are found by identifier
+template <typename Record>
+Record make_record(bool with_optionals)
+{
+    Record record;
+    record.record_type              = 18;
+    record.served_imsi              = "\x32\x54\x76\x98\x10\x32\x54\xF6";
+    record.charging_id              = 1234567890;
+    record.duration                 = 3600;
+    record.cause_for_closing        = 16;
+    record.charging_characteristics = "\x08\x00";
+    if (with_optionals)
+    {
+        record.served_imei            = "\x53\x41\x00\x71\x23\x45\x67\x80";
+        record.access_point_name      = "internet.operator.com";
+        record.record_sequence_number = 7;
+        record.node_id                = "sgsn01";
+        record.local_sequence_number  = 99887766;
+        record.apn_selection_mode     = Record::Apn_selection_modeValues::subscribed;
+        record.served_msisdn          = "\x91\x44\x77\x00\x90\x00\x00";
+        record.roaming                = false;
+    }
+    return record;
+}
+
+TEST_CASE("Component Performance: Record Decode")
+{
+    component_benchmark_decode(make_record<fast_ber::All::The_Record>(true), "Set (14 Members)");
+    component_benchmark_decode(make_record<fast_ber::All::The_Record>(false), "Set (14 Members, 6 Present)");
+    component_benchmark_decode(make_record<fast_ber::All::The_Record_Sequence>(true), "Sequence (14 Members)");
+    component_benchmark_decode(make_record<fast_ber::All::The_Record_Sequence>(false),
+                               "Sequence (14 Members, 6 Present)");
+}
+
+TEST_CASE("Component Performance: String Decode")
+{
+    component_benchmark_decode_new(fast_ber::OctetString<>("12345678"), "OctetString (Short)");
+    component_benchmark_decode_new(fast_ber::OctetString<>(std::string(100, 'x')), "OctetString (Long)");
+    component_benchmark_decode_new(
+        fast_ber::ObjectIdentifier<>(fast_ber::ObjectIdentifierComponents{1, 2, 840, 113549}), "ObjectIdentifier");
+}
+
 TEST_CASE("Component Performance: Object Construction")
 {
     component_benchmark_construct<fast_ber::Integer<>>(-99999999, "Integer");
+    component_benchmark_construct<NativeInteger>(-99999999, "Integer (Native)");
     component_benchmark_construct<fast_ber::Default<fast_ber::Integer<>, IntegerDefault>>(-99999999, "Default Integer");
     component_benchmark_construct<fast_ber::Boolean<>>(true, "Boolean");
     component_benchmark_construct<fast_ber::OctetString<>>("Test string!", "OctetString");
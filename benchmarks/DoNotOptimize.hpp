@@ -0,0 +1,29 @@
+#pragma once
+
+// Keeps the work of a benchmark loop from being optimised away. A loop whose results are never read can be removed
+// entirely by the compiler, which is then reported as taking no time
+
+#if !defined(__GNUC__)
+#include <atomic>
+#endif
+
+namespace fast_ber
+{
+namespace benchmark
+{
+
+// Prevent the compiler from discarding the computation of a value, or from assuming memory is unchanged
+template <typename T>
+inline void do_not_optimize(const T& value) noexcept
+{
+#if defined(__GNUC__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+} // namespace benchmark
+} // namespace fast_ber
@@ -0,0 +1,169 @@
+#pragma once
+
+// Hardware performance counters of the calling thread, read with Linux perf_event_open. Counters which the kernel or
+// hardware does not provide, for example in a virtual machine or with a restrictive perf_event_paranoid setting, are
+// reported as unavailable rather than failing the benchmark. Only user space is counted
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace fast_ber
+{
+namespace benchmark
+{
+
+enum class PerfEvent
+{
+    cycles,
+    instructions,
+    branch_misses,
+    cache_misses
+};
+
+constexpr size_t perf_event_count = 4;
+
+constexpr std::array<const char*, perf_event_count> perf_event_names = {"cycles", "instructions", "branch_misses",
+                                                                         "cache_misses"};
+
+// Counts of each event, summed over any number of measurements
+struct PerfCounts
+{
+    std::array<double, perf_event_count> values    = {};
+    std::array<bool, perf_event_count>   available = {};
+
+    bool   any_available() const noexcept { return available[0] || available[1] || available[2] || available[3]; }
+    bool   has(PerfEvent event) const noexcept { return available[static_cast<size_t>(event)]; }
+    double operator[](PerfEvent event) const noexcept { return values[static_cast<size_t>(event)]; }
+
+    PerfCounts& operator+=(const PerfCounts& rhs) noexcept
+    {
+        for (size_t i = 0; i < perf_event_count; i++)
+        {
+            values[i] += rhs.values[i];
+            available[i] = rhs.available[i];
+        }
+        return *this;
+    }
+};
+
+class PerfCounters
+{
+  public:
+    PerfCounters() noexcept;
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+    ~PerfCounters() noexcept;
+
+    bool available() const noexcept { return m_descriptors[0] >= 0; }
+
+    void       start() noexcept;
+    PerfCounts stop() noexcept;
+
+  private:
+    std::array<int, perf_event_count> m_descriptors = {-1, -1, -1, -1};
+};
+
+#if defined(__linux__)
+
+namespace detail
+{
+
+inline int open_perf_event(uint64_t config, int group) noexcept
+{
+    perf_event_attr attributes = {};
+    attributes.type            = PERF_TYPE_HARDWARE;
+    attributes.size            = sizeof(attributes);
+    attributes.config          = config;
+    attributes.disabled        = group < 0;
+    attributes.exclude_kernel  = 1;
+    attributes.exclude_hv      = 1;
+    attributes.read_format     = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, group, 0));
+}
+
+} // namespace detail
+
+// The events are opened as one group, so they are counted over the same instructions. Cycles lead the group, if they
+// cannot be counted no counters are used
+inline PerfCounters::PerfCounters() noexcept
+{
+    constexpr std::array<uint64_t, perf_event_count> configs = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                                                PERF_COUNT_HW_BRANCH_MISSES,
+                                                                PERF_COUNT_HW_CACHE_MISSES};
+
+    m_descriptors[0] = detail::open_perf_event(configs[0], -1);
+    for (size_t i = 1; i < perf_event_count && available(); i++)
+    {
+        m_descriptors[i] = detail::open_perf_event(configs[i], m_descriptors[0]);
+    }
+}
+
+inline PerfCounters::~PerfCounters() noexcept
+{
+    for (int descriptor : m_descriptors)
+    {
+        if (descriptor >= 0)
+        {
+            close(descriptor);
+        }
+    }
+}
+
+inline void PerfCounters::start() noexcept
+{
+    if (available())
+    {
+        ioctl(m_descriptors[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(m_descriptors[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+}
+
+inline PerfCounts PerfCounters::stop() noexcept
+{
+    PerfCounts counts;
+    if (!available())
+    {
+        return counts;
+    }
+    ioctl(m_descriptors[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+    // Group read format: number of events, time enabled, time running, then a value per event in the order opened
+    std::array<uint64_t, 3 + perf_event_count> buffer = {};
+    if (read(m_descriptors[0], buffer.data(), sizeof(buffer)) <= 0 || buffer[2] == 0)
+    {
+        return counts;
+    }
+
+    // Scale counts up if the kernel had to multiplex the counters with other events
+    const double scale = static_cast<double>(buffer[1]) / static_cast<double>(buffer[2]);
+    size_t       value = 3;
+    for (size_t i = 0; i < perf_event_count && value < 3 + buffer[0]; i++)
+    {
+        if (m_descriptors[i] >= 0)
+        {
+            counts.values[i]    = static_cast<double>(buffer[value++]) * scale;
+            counts.available[i] = true;
+        }
+    }
+    return counts;
+}
+
+#else
+
+inline PerfCounters::PerfCounters() noexcept {}
+inline PerfCounters::~PerfCounters() noexcept {}
+inline void       PerfCounters::start() noexcept {}
+inline PerfCounts PerfCounters::stop() noexcept { return {}; }
+
+#endif
+
+} // namespace benchmark
+} // namespace fast_ber
@@ -2,12 +2,28 @@
 #include "Collection.h"
 #endif
 
+#include "DoNotOptimize.hpp"
 #include "autogen/simple.hpp"
+#include "fast_ber/util/Arena.hpp"
+#include "fast_ber/util/BatchDecoder.hpp"
+#include "fast_ber/util/BerIndex.hpp"
+#include "fast_ber/util/GatherBuffer.hpp"
+#include "fast_ber/util/ParallelDecoder.hpp"
 
 #include "catch2/catch.hpp"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <thread>
 #include <vector>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
 const std::initializer_list<uint8_t> large_test_collection_packet = {
     0x30, 0x82, 0x08, 0x37, 0x80, 0x0c, 0x48, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64, 0x21, 0x81,
     0x0f, 0x47, 0x6f, 0x6f, 0x64, 0x20, 0x62, 0x79, 0x65, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64, 0x21, 0x82, 0x01, 0x05,
@@ -127,6 +143,8 @@ const std::initializer_list<uint8_t> small_test_collection_packet = {
     0x21, 0x82, 0x01, 0x05, 0x83, 0x01, 0xff, 0xa4, 0x02, 0xa1, 0x00, 0xa6, 0x13, 0x81, 0x11, 0x49,
     0x20, 0x63, 0x68, 0x6f, 0x73, 0x65, 0x20, 0x61, 0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x21};
 
+using fast_ber::benchmark::do_not_optimize;
+
 const int iterations = 1000000;
 
 TEST_CASE("Benchmark: Decode Performance")
@@ -142,6 +160,7 @@ TEST_CASE("Benchmark: Decode Performance")
                           std::span(large_test_collection_packet.begin(), large_test_collection_packet.size()),
                           collection)
                           .success;
+            do_not_optimize(collection);
         }
     }
     REQUIRE(success);
@@ -171,6 +190,7 @@ TEST_CASE("Benchmark: Decode Performance")
                           std::span(small_test_collection_packet.begin(), small_test_collection_packet.size()),
                           collection)
                           .success;
+            do_not_optimize(collection);
         }
     }
     REQUIRE(success);
@@ -191,6 +211,254 @@ TEST_CASE("Benchmark: Decode Performance")
 #endif
 }
 
+TEST_CASE("Benchmark: Malformed Decode Performance")
+{
+    // Copies of a packet with a single byte overwritten, keeping those which fail to decode
+    std::vector<std::vector<uint8_t>> corpus;
+    fast_ber::Simple::Collection      collection;
+    for (size_t i = 0; i < small_test_collection_packet.size(); i++)
+    {
+        for (uint8_t value : {0x00, 0x05, 0x7f, 0xff})
+        {
+            std::vector<uint8_t> packet(small_test_collection_packet);
+            packet[i] = value;
+            if (!fast_ber::decode(std::span(packet), collection).success)
+            {
+                corpus.push_back(std::move(packet));
+            }
+        }
+    }
+    REQUIRE(!corpus.empty());
+
+    const int corpus_iterations = static_cast<int>(iterations / corpus.size());
+    size_t    failures          = 0;
+
+    std::array<size_t, fast_ber::decode_error_kinds> kinds = {};
+    BENCHMARK("fast_ber        - 1,000,000 x decode malformed " + std::to_string(small_test_collection_packet.size()) +
+              "B pdu")
+    {
+        for (int i = 0; i < corpus_iterations; i++)
+        {
+            for (const std::vector<uint8_t>& packet : corpus)
+            {
+                const fast_ber::DecodeResult result = fast_ber::decode(std::span(packet), collection);
+                failures += !result.success;
+                kinds[static_cast<size_t>(result.error)]++;
+            }
+        }
+    }
+    REQUIRE(failures == corpus.size() * static_cast<size_t>(corpus_iterations));
+    REQUIRE(kinds[static_cast<size_t>(fast_ber::DecodeError::none)] == 0);
+}
+
+size_t count_packets(const fast_ber::BerView& view)
+{
+    size_t count = 1;
+    if (view.construction() == fast_ber::Construction::constructed)
+    {
+        for (const fast_ber::BerView& child : view)
+        {
+            count += count_packets(child);
+        }
+    }
+    return count;
+}
+
+TEST_CASE("Benchmark: Structural Index Performance")
+{
+    const auto packet = std::span(large_test_collection_packet.begin(), large_test_collection_packet.size());
+    size_t     count  = 0;
+
+    BENCHMARK("fast_ber        - 1,000,000 x BerView walk " + std::to_string(packet.size()) + "B pdu")
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            count = count_packets(fast_ber::BerView(packet));
+            do_not_optimize(count);
+        }
+    }
+
+    fast_ber::BerIndex index;
+    BENCHMARK("fast_ber        - 1,000,000 x BerIndex build " + std::to_string(packet.size()) + "B pdu")
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            index.build(packet);
+            do_not_optimize(index);
+        }
+    }
+    REQUIRE(index.is_valid());
+    REQUIRE(index.size() == count);
+}
+
+TEST_CASE("Benchmark: Batch Decode Performance")
+{
+    // A file of concatenated records, decoded by a hand written loop and by BatchDecoder
+    const size_t         records = 1000;
+    std::vector<uint8_t> file;
+    for (size_t i = 0; i < records; i++)
+    {
+        file.insert(file.end(), small_test_collection_packet.begin(), small_test_collection_packet.end());
+    }
+    const int batch_iterations = iterations / records;
+
+    fast_ber::Simple::Collection collection;
+    size_t                       decoded = 0;
+    BENCHMARK("fast_ber        - 1,000,000 x decode loop " + std::to_string(small_test_collection_packet.size()) +
+              "B pdu")
+    {
+        for (int i = 0; i < batch_iterations; i++)
+        {
+            std::span<const uint8_t> remaining = file;
+            while (!remaining.empty())
+            {
+                const fast_ber::BerView record(remaining);
+                decoded += fast_ber::decode(record, collection).success;
+                remaining = remaining.subspan(record.ber_length());
+            }
+        }
+    }
+    REQUIRE(decoded == records * batch_iterations);
+
+    decoded = 0;
+    BENCHMARK("fast_ber        - 1,000,000 x batch decode " + std::to_string(small_test_collection_packet.size()) +
+              "B pdu")
+    {
+        for (int i = 0; i < batch_iterations; i++)
+        {
+            fast_ber::BatchDecoder<fast_ber::Simple::Collection> decoder(file);
+            while (decoder.next(collection))
+            {
+                decoded++;
+            }
+        }
+    }
+    REQUIRE(decoded == records * batch_iterations);
+}
+
+TEST_CASE("Benchmark: Parallel Decode Performance")
+{
+    // A file of concatenated records, decoded sequentially and by a pool of 1 to N threads
+    const size_t         records = 10000;
+    std::vector<uint8_t> file;
+    for (size_t i = 0; i < records; i++)
+    {
+        file.insert(file.end(), large_test_collection_packet.begin(), large_test_collection_packet.end());
+    }
+    const int           batch_iterations = iterations / records;
+    const std::string   pdu_size         = std::to_string(large_test_collection_packet.size()) + "B pdu";
+    std::atomic<size_t> decoded          = 0;
+
+    BENCHMARK("fast_ber        - 1,000,000 x batch decode " + pdu_size)
+    {
+        for (int i = 0; i < batch_iterations; i++)
+        {
+            decoded += fast_ber::decode_batch<fast_ber::Simple::Collection>(
+                           file, [](const fast_ber::Simple::Collection&, size_t) {})
+                           .records;
+        }
+    }
+    REQUIRE(decoded == records * batch_iterations);
+
+    // Doubling the number of threads up to the number of hardware threads
+    const size_t        hardware = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    std::vector<size_t> thread_counts;
+    for (size_t threads = 1; threads < hardware; threads *= 2)
+    {
+        thread_counts.push_back(threads);
+    }
+    thread_counts.push_back(hardware);
+
+    for (size_t threads : thread_counts)
+    {
+        for (fast_ber::DeliveryOrder order : {fast_ber::DeliveryOrder::in_order, fast_ber::DeliveryOrder::any_order})
+        {
+            fast_ber::ParallelDecodeOptions options;
+            options.threads = threads;
+            options.order   = order;
+
+            decoded = 0;
+            BENCHMARK("fast_ber        - 1,000,000 x parallel decode, " + std::to_string(threads) + " threads, " +
+                      (order == fast_ber::DeliveryOrder::in_order ? "in order " : "any order ") + pdu_size)
+            {
+                for (int i = 0; i < batch_iterations; i++)
+                {
+                    fast_ber::decode_parallel<fast_ber::Simple::Collection>(
+                        file, [&decoded](const fast_ber::Simple::Collection&, size_t) { decoded++; }, options);
+                }
+            }
+            REQUIRE(decoded == records * batch_iterations);
+        }
+    }
+}
+
+TEST_CASE("Benchmark: Lazy View Performance")
+{
+    // Read three fields of a PDU, through a full decode and through a generated view
+    const auto packet = std::span(large_test_collection_packet.begin(), large_test_collection_packet.size());
+    int64_t    sum    = 0;
+
+    BENCHMARK("fast_ber        - 1,000,000 x decode, read 3 fields " + std::to_string(packet.size()) + "B pdu")
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            fast_ber::Simple::Collection collection;
+            fast_ber::decode(packet, collection);
+            sum += collection.integer.value() + static_cast<int64_t>(collection.goodbye.length()) +
+                   collection.optional_child->meaning_of_life->value();
+        }
+    }
+    const int64_t decode_sum = sum;
+
+    sum = 0;
+    BENCHMARK("fast_ber        - 1,000,000 x view, read 3 fields " + std::to_string(packet.size()) + "B pdu")
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            const fast_ber::Simple::Collection::View view{fast_ber::BerView(packet)};
+            sum += view.integer() + static_cast<int64_t>(view.goodbye().length()) +
+                   view.optional_child()->meaning_of_life().value_or(0);
+        }
+    }
+    REQUIRE(sum == decode_sum);
+}
+
+TEST_CASE("Benchmark: Arena Decode Performance")
+{
+    // Decode and destroy a PDU, with storage taken from the heap when no arena is in scope, and from an arena released
+    // after each message
+    for (const std::initializer_list<uint8_t>& pdu : {large_test_collection_packet, small_test_collection_packet})
+    {
+        const auto packet  = std::span(pdu.begin(), pdu.size());
+        bool       success = false;
+
+        BENCHMARK("fast_ber        - 1,000,000 x decode, destroy (no arena) " + std::to_string(packet.size()) + "B pdu")
+        {
+            for (int i = 0; i < iterations; i++)
+            {
+                fast_ber::Simple::Collection collection;
+                success = fast_ber::decode(packet, collection).success;
+            }
+        }
+        REQUIRE(success);
+
+        fast_ber::Arena arena;
+        BENCHMARK("fast_ber        - 1,000,000 x decode, destroy (arena) " + std::to_string(packet.size()) + "B pdu")
+        {
+            for (int i = 0; i < iterations; i++)
+            {
+                {
+                    fast_ber::ArenaScope         scope(arena);
+                    fast_ber::Simple::Collection collection;
+                    success = fast_ber::decode(packet, collection).success;
+                }
+                arena.reset();
+            }
+        }
+        REQUIRE(success);
+    }
+}
+
 TEST_CASE("Benchmark: Encode Performance")
 {
     const std::string         long_string     = std::string(2000, 'x');
@@ -223,6 +491,65 @@ TEST_CASE("Benchmark: Encode Performance")
     }
     REQUIRE(encode_result.success);
 
+    std::array<uint8_t, 5000> reverse_buffer        = {};
+    fast_ber::EncodeResult    reverse_encode_result = {};
+    BENCHMARK("fast_ber        - 1,000,000 x reverse encode " + std::to_string(fast_ber::encoded_length(collection)) +
+              "B pdu")
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            reverse_encode_result =
+                fast_ber::encode_reverse(std::span(reverse_buffer.data(), reverse_buffer.size()), collection);
+        }
+    }
+    REQUIRE(reverse_encode_result.success);
+    REQUIRE(reverse_encode_result.length == encode_result.length);
+    REQUIRE(std::equal(fast_ber_buffer.begin(), fast_ber_buffer.begin() + encode_result.length,
+                       reverse_buffer.end() - reverse_encode_result.length));
+
+    // Headers are written to scratch, the 2000 byte string is referenced in place rather than copied
+    fast_ber::GatherBuffer gather;
+    fast_ber::EncodeResult gather_encode_result = {};
+    BENCHMARK("fast_ber        - 1,000,000 x gather encode " + std::to_string(fast_ber::encoded_length(collection)) +
+              "B pdu")
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            gather_encode_result = fast_ber::encode(gather, collection);
+        }
+    }
+    REQUIRE(gather_encode_result.success);
+    REQUIRE(gather_encode_result.length == encode_result.length);
+
+#ifndef _WIN32
+    const int null_file = ::open("/dev/null", O_WRONLY);
+    REQUIRE(null_file >= 0);
+    ssize_t written = 0;
+    BENCHMARK("fast_ber        - 1,000,000 x encode, write " + std::to_string(fast_ber::encoded_length(collection)) +
+              "B pdu")
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            encode_result = fast_ber::encode(std::span(fast_ber_buffer.data(), fast_ber_buffer.size()), collection);
+            written       = ::write(null_file, fast_ber_buffer.data(), encode_result.length);
+        }
+    }
+    REQUIRE(written == static_cast<ssize_t>(encode_result.length));
+
+    BENCHMARK("fast_ber        - 1,000,000 x gather encode, writev " +
+              std::to_string(fast_ber::encoded_length(collection)) + "B pdu")
+    {
+        for (int i = 0; i < iterations; i++)
+        {
+            fast_ber::encode(gather, collection);
+            const std::span<const iovec> segments = gather.iovecs();
+            written = ::writev(null_file, segments.data(), static_cast<int>(segments.size()));
+        }
+    }
+    REQUIRE(written == static_cast<ssize_t>(encode_result.length));
+    ::close(null_file);
+#endif
+
 #ifdef INCLUDE_ASN1C
     asn_enc_rval_t rval;
     Collection_t   asn1c_collection = {};
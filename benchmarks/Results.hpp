@@ -0,0 +1,181 @@
+#pragma once
+
+// Results of benchmark runs and their JSON form. Each run is written as one JSON document describing the build and
+// conditions of the run in its context, followed by the results of each benchmark. fast_ber_benchmark_compare reads
+// these documents to track performance between versions
+
+#include "PerfCounters.hpp"
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <iomanip>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace fast_ber
+{
+namespace benchmark
+{
+
+// Percentiles of the time taken by single operations, in nanoseconds. The overhead of reading the clock is measured
+// and subtracted from each sample
+struct Latency
+{
+    size_t samples     = 0;
+    double overhead_ns = 0.0;
+    double min         = 0.0;
+    double p50         = 0.0;
+    double p90         = 0.0;
+    double p99         = 0.0;
+    double p999        = 0.0;
+    double max         = 0.0;
+};
+
+struct Result
+{
+    std::string name;
+    size_t      runs       = 0;
+    size_t      operations = 0; // Total over all runs
+    size_t      bytes      = 0; // Total over all runs, zero if throughput in bytes is not meaningful
+    double      seconds    = 0.0;
+    double      ns_stddev  = 0.0; // Standard deviation of the time per operation between runs, zero if not measured
+
+    PerfCounts             counters; // Total over all runs
+    std::optional<Latency> latency;
+
+    double ns_per_operation() const noexcept { return operations ? seconds * 1e9 / operations : 0.0; }
+    double operations_per_second() const noexcept { return seconds > 0 ? operations / seconds : 0.0; }
+    double megabytes_per_second() const noexcept { return seconds > 0 ? bytes / seconds / 1e6 : 0.0; }
+    double per_operation(PerfEvent event) const noexcept { return operations ? counters[event] / operations : 0.0; }
+
+    // Work taking well under a nanosecond has most likely been optimised away
+    bool suspect() const noexcept { return operations > 0 && ns_per_operation() < 0.25; }
+};
+
+// A value describing the conditions of a run, such as the number of records in a corpus or the compiler used
+using ContextEntry = std::pair<std::string, std::string>;
+
+namespace detail
+{
+
+inline void write_json_string(std::ostream& output, std::string_view value)
+{
+    output << '"';
+    for (const char c : value)
+    {
+        if (c == '"' || c == '\\')
+        {
+            output << '\\' << c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            output << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c) << std::dec
+                   << std::setfill(' ');
+        }
+        else
+        {
+            output << c;
+        }
+    }
+    output << '"';
+}
+
+// Shortest form which reads back as the same value. JSON has no infinities or NaN, so they are written as null
+inline void write_json_number(std::ostream& output, double value)
+{
+    if (!std::isfinite(value))
+    {
+        output << "null";
+        return;
+    }
+    std::array<char, 32> buffer;
+    const auto           end = std::to_chars(buffer.data(), buffer.data() + buffer.size(), value);
+    output.write(buffer.data(), end.ptr - buffer.data());
+}
+
+} // namespace detail
+
+inline void write_json(std::ostream& output, const std::string& suite, const std::vector<ContextEntry>& context,
+                       const std::vector<Result>& results)
+{
+    using detail::write_json_number;
+
+    output << "{\n  \"suite\": ";
+    detail::write_json_string(output, suite);
+    output << ",\n  \"context\": {";
+    for (size_t i = 0; i < context.size(); i++)
+    {
+        output << (i == 0 ? "\n    " : ",\n    ");
+        detail::write_json_string(output, context[i].first);
+        output << ": ";
+        detail::write_json_string(output, context[i].second);
+    }
+    output << (context.empty() ? "},\n" : "\n  },\n") << "  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        const Result& result = results[i];
+        output << (i == 0 ? "\n    {" : ",\n    {") << "\"name\": ";
+        detail::write_json_string(output, result.name);
+        output << ", \"runs\": " << result.runs << ", \"operations\": " << result.operations
+               << ", \"bytes\": " << result.bytes << ", \"seconds\": ";
+        write_json_number(output, result.seconds);
+        output << ", \"ns_per_op\": ";
+        write_json_number(output, result.ns_per_operation());
+        output << ", \"ops_per_second\": ";
+        write_json_number(output, result.operations_per_second());
+        output << ", \"mb_per_second\": ";
+        write_json_number(output, result.megabytes_per_second());
+        if (result.ns_stddev > 0.0)
+        {
+            output << ", \"ns_per_op_stddev\": ";
+            write_json_number(output, result.ns_stddev);
+        }
+        if (result.counters.any_available())
+        {
+            output << ", \"counters_per_op\": {";
+            const char* separator = "";
+            for (size_t event = 0; event < perf_event_count; event++)
+            {
+                if (result.counters.available[event])
+                {
+                    output << separator << '"' << perf_event_names[event] << "\": ";
+                    write_json_number(output, result.per_operation(static_cast<PerfEvent>(event)));
+                    separator = ", ";
+                }
+            }
+            output << "}";
+        }
+        if (result.latency)
+        {
+            const Latency& latency = *result.latency;
+            output << ", \"latency_ns\": {\"samples\": " << latency.samples;
+            const std::array<std::pair<const char*, double>, 7> values = {{{"overhead", latency.overhead_ns},
+                                                                            {"min", latency.min},
+                                                                            {"p50", latency.p50},
+                                                                            {"p90", latency.p90},
+                                                                            {"p99", latency.p99},
+                                                                            {"p99.9", latency.p999},
+                                                                            {"max", latency.max}}};
+            for (const auto& [key, value] : values)
+            {
+                output << ", \"" << key << "\": ";
+                write_json_number(output, value);
+            }
+            output << "}";
+        }
+        if (result.suspect())
+        {
+            output << ", \"suspect\": true";
+        }
+        output << "}";
+    }
+    output << (results.empty() ? "]\n}\n" : "\n  ]\n}\n");
+}
+
+} // namespace benchmark
+} // namespace fast_ber
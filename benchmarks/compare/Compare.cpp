@@ -0,0 +1,350 @@
+#include "Runs.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+
+using fast_ber::benchmark::ContextEntry;
+using fast_ber::benchmark::Result;
+using fast_ber::benchmark::Run;
+
+// Exit status when a benchmark has become slower, distinct from failure to load the runs
+constexpr int exit_regression = 1;
+constexpr int exit_error      = 2;
+
+struct Options
+{
+    double                   min_threshold = 0.05; // Smallest change reported, as a fraction
+    double                   noise_factor  = 3.0;  // Changes within this many times the estimated noise are ignored
+    std::string              filter;
+    std::vector<std::string> paths;
+
+    // Conversion of Catch output to JSON
+    std::string               convert_input;
+    std::string               convert_output;
+    std::vector<ContextEntry> context;
+};
+
+void usage(const char* program)
+{
+    std::cerr << "Usage: " << program
+              << " [--threshold PERCENT] [--noise-factor K] [--filter TEXT] BASELINE... CANDIDATE\n"
+              << "       " << program << " --convert CATCH_OUTPUT JSON_FILE [--context KEY=VALUE]...\n"
+              << "Compares the time per operation of each benchmark in CANDIDATE with the median of the BASELINE\n"
+              << "runs. A change counts when it exceeds both PERCENT (default 5) and K (default 3) times the noise,\n"
+              << "estimated from the spread of the baseline runs and between the repeats within each run. Exits with\n"
+              << "status 1 if any benchmark became slower, 2 on error. Runs are JSON files written by the benchmark\n"
+              << "harness, or the console output of fast_ber_benchmarks, which --convert writes as JSON\n";
+}
+
+bool parse_options(int argc, char** argv, Options& options)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string argument = argv[i];
+        if (argument.rfind("--", 0) != 0)
+        {
+            options.paths.push_back(argument);
+            continue;
+        }
+        if (i + 1 == argc)
+        {
+            return false;
+        }
+        const std::string value = argv[++i];
+        if (argument == "--threshold")
+        {
+            options.min_threshold = std::stod(value) / 100.0;
+        }
+        else if (argument == "--noise-factor")
+        {
+            options.noise_factor = std::stod(value);
+        }
+        else if (argument == "--filter")
+        {
+            options.filter = value;
+        }
+        else if (argument == "--convert")
+        {
+            if (i + 1 == argc)
+            {
+                return false;
+            }
+            options.convert_input  = value;
+            options.convert_output = argv[++i];
+        }
+        else if (argument == "--context")
+        {
+            const size_t equals = value.find('=');
+            if (equals == std::string::npos)
+            {
+                return false;
+            }
+            options.context.emplace_back(value.substr(0, equals), value.substr(equals + 1));
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return options.convert_input.empty() ? options.paths.size() >= 2 : options.paths.empty();
+}
+
+int convert(const Options& options)
+{
+    Run run = fast_ber::benchmark::load_run(options.convert_input);
+    for (const ContextEntry& entry : options.context)
+    {
+        run.context.push_back(entry);
+    }
+
+    std::ofstream file(options.convert_output);
+    fast_ber::benchmark::write_json(file, run.suite, run.context, run.results);
+    if (!file)
+    {
+        std::cerr << "Failed to write " << options.convert_output << "\n";
+        return exit_error;
+    }
+    return EXIT_SUCCESS;
+}
+
+double median(std::vector<double> values)
+{
+    std::sort(values.begin(), values.end());
+    const size_t middle = values.size() / 2;
+    return values.size() % 2 ? values[middle] : (values[middle - 1] + values[middle]) / 2;
+}
+
+// Standard deviation of a result's time per operation relative to its mean, zero if it was not measured
+double relative_stddev(const Result& result)
+{
+    const double ns = result.ns_per_operation();
+    return ns > 0 ? result.ns_stddev / ns : 0.0;
+}
+
+enum class Verdict
+{
+    unchanged,
+    faster,
+    slower,
+    suspect, // Too fast to be measuring real work in one of the runs
+    added,   // Only in the candidate
+    removed  // Only in the baseline
+};
+
+const char* verdict_name(Verdict verdict) noexcept
+{
+    switch (verdict)
+    {
+    case Verdict::unchanged:
+        return "~";
+    case Verdict::faster:
+        return "faster";
+    case Verdict::slower:
+        return "SLOWER";
+    case Verdict::suspect:
+        return "suspect";
+    case Verdict::added:
+        return "new";
+    case Verdict::removed:
+        return "removed";
+    }
+    return "";
+}
+
+struct Comparison
+{
+    std::string         name;
+    std::vector<double> ns_per_operation; // Of each run, NaN where the run does not have the benchmark
+    double              change    = 0.0;  // Of the candidate relative to the baseline median, as a fraction
+    double              threshold = 0.0;
+    Verdict             verdict   = Verdict::unchanged;
+};
+
+Comparison compare(const std::string& name, const std::vector<Run>& runs, const Options& options)
+{
+    Comparison comparison;
+    comparison.name = name;
+
+    std::vector<double> baseline;
+    double              baseline_noise = 0.0;
+    bool                suspect        = false;
+    for (size_t i = 0; i < runs.size(); i++)
+    {
+        const Result* result = runs[i].find(name);
+        comparison.ns_per_operation.push_back(result ? result->ns_per_operation() : std::nan(""));
+        if (result && i + 1 < runs.size())
+        {
+            baseline.push_back(result->ns_per_operation());
+            baseline_noise = relative_stddev(*result);
+        }
+        suspect = suspect || (result && result->suspect());
+    }
+
+    const Result* candidate = runs.back().find(name);
+    if (!candidate || baseline.empty())
+    {
+        comparison.verdict = candidate ? Verdict::added : Verdict::removed;
+        return comparison;
+    }
+
+    const double reference = median(baseline);
+    if (suspect || reference <= 0)
+    {
+        comparison.verdict = Verdict::suspect;
+        return comparison;
+    }
+
+    // Noise from the spread between baseline runs, as a scaled median absolute deviation, and from the repeats
+    // within the latest baseline run and the candidate
+    double spread = 0.0;
+    if (baseline.size() > 1)
+    {
+        std::vector<double> deviations;
+        for (const double value : baseline)
+        {
+            deviations.push_back(std::abs(value - reference));
+        }
+        spread = 1.4826 * median(deviations) / reference;
+    }
+    const double candidate_noise = relative_stddev(*candidate);
+    const double noise =
+        std::sqrt(spread * spread + baseline_noise * baseline_noise + candidate_noise * candidate_noise);
+
+    comparison.change    = candidate->ns_per_operation() / reference - 1.0;
+    comparison.threshold = std::max(options.min_threshold, options.noise_factor * noise);
+    if (comparison.change > comparison.threshold)
+    {
+        comparison.verdict = Verdict::slower;
+    }
+    else if (comparison.change < -comparison.threshold)
+    {
+        comparison.verdict = Verdict::faster;
+    }
+    return comparison;
+}
+
+int compare_runs(const Options& options)
+{
+    std::vector<Run> runs;
+    for (const std::string& path : options.paths)
+    {
+        runs.push_back(fast_ber::benchmark::load_run(path));
+        if (runs.back().suite != runs.front().suite)
+        {
+            std::cerr << "Warning: comparing suite " << runs.back().suite << " of " << path << " with suite "
+                      << runs.front().suite << "\n";
+        }
+    }
+
+    // Benchmarks in the order they first appear, candidate first so that new benchmarks are listed in place
+    std::vector<std::string> names;
+    for (size_t i = runs.size(); i-- > 0;)
+    {
+        for (const Result& result : runs[i].results)
+        {
+            if ((options.filter.empty() || result.name.find(options.filter) != std::string::npos) &&
+                std::find(names.begin(), names.end(), result.name) == names.end())
+            {
+                names.push_back(result.name);
+            }
+        }
+    }
+
+    std::cout << "Runs:\n";
+    for (size_t i = 0; i < runs.size(); i++)
+    {
+        std::cout << "  [" << i + 1 << "] " << runs[i].label() << " (" << runs[i].source << ")";
+        const std::string_view compiler = runs[i].context_value("compiler");
+        if (!compiler.empty())
+        {
+            std::cout << ", " << compiler;
+        }
+        std::cout << (i + 1 == runs.size() ? " (candidate)" : "") << "\n";
+    }
+
+    size_t name_width = std::string_view("benchmark").size();
+    for (const std::string& name : names)
+    {
+        name_width = std::max(name_width, name.size());
+    }
+
+    std::cout << "\n" << std::left << std::setw(static_cast<int>(name_width)) << "benchmark" << std::right;
+    for (size_t i = 0; i < runs.size(); i++)
+    {
+        std::cout << std::setw(14) << "[" + std::to_string(i + 1) + "] ns/op";
+    }
+    std::cout << std::setw(10) << "change" << std::setw(11) << "threshold" << "  verdict\n";
+
+    std::vector<size_t> counts(static_cast<size_t>(Verdict::removed) + 1);
+    for (const std::string& name : names)
+    {
+        const Comparison comparison = compare(name, runs, options);
+        counts[static_cast<size_t>(comparison.verdict)]++;
+
+        std::cout << std::left << std::setw(static_cast<int>(name_width)) << name << std::right << std::fixed;
+        for (const double ns : comparison.ns_per_operation)
+        {
+            if (std::isnan(ns))
+            {
+                std::cout << std::setw(14) << "-";
+            }
+            else
+            {
+                std::cout << std::setw(14) << std::setprecision(ns < 100 ? 2 : 0) << ns;
+            }
+        }
+        if (comparison.verdict == Verdict::added || comparison.verdict == Verdict::removed ||
+            comparison.verdict == Verdict::suspect)
+        {
+            std::cout << std::setw(10) << "" << std::setw(11) << "";
+        }
+        else
+        {
+            std::cout << std::setprecision(1) << std::showpos << " " << std::setw(8) << comparison.change * 100 << "%"
+                      << std::noshowpos << std::setw(10) << comparison.threshold * 100 << "%";
+        }
+        std::cout << "  " << verdict_name(comparison.verdict) << "\n";
+    }
+
+    const size_t slower = counts[static_cast<size_t>(Verdict::slower)];
+    std::cout << "\n"
+              << names.size() << " benchmarks: " << slower << " slower, "
+              << counts[static_cast<size_t>(Verdict::faster)] << " faster, "
+              << counts[static_cast<size_t>(Verdict::unchanged)] << " unchanged, "
+              << counts[static_cast<size_t>(Verdict::suspect)] << " suspect, "
+              << counts[static_cast<size_t>(Verdict::added)] << " new, "
+              << counts[static_cast<size_t>(Verdict::removed)] << " removed\n";
+    return slower ? exit_regression : EXIT_SUCCESS;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    try
+    {
+        if (!parse_options(argc, argv, options))
+        {
+            usage(argv[0]);
+            return exit_error;
+        }
+        return options.convert_input.empty() ? compare_runs(options) : convert(options);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "Error: " << e.what() << "\n";
+        return exit_error;
+    }
+}
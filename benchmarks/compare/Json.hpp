@@ -0,0 +1,350 @@
+#pragma once
+
+// Minimal JSON reader for benchmark results. Supports all of JSON, but keeps objects as lists of members in document
+// order and numbers as doubles, which is all the results need
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace fast_ber
+{
+namespace benchmark
+{
+
+class JsonValue
+{
+  public:
+    using Array  = std::vector<JsonValue>;
+    using Object = std::vector<std::pair<std::string, JsonValue>>;
+
+    JsonValue() noexcept = default;
+    template <typename T>
+    explicit JsonValue(T value) : m_value(std::move(value))
+    {
+    }
+
+    bool is_null() const noexcept { return std::holds_alternative<std::nullptr_t>(m_value); }
+    bool is_bool() const noexcept { return std::holds_alternative<bool>(m_value); }
+    bool is_number() const noexcept { return std::holds_alternative<double>(m_value); }
+    bool is_string() const noexcept { return std::holds_alternative<std::string>(m_value); }
+    bool is_array() const noexcept { return std::holds_alternative<Array>(m_value); }
+    bool is_object() const noexcept { return std::holds_alternative<Object>(m_value); }
+
+    // Throw std::runtime_error if the value is not of the requested type
+    bool               as_bool() const { return get<bool>("boolean"); }
+    double             as_number() const { return get<double>("number"); }
+    const std::string& as_string() const { return get<std::string>("string"); }
+    const Array&       as_array() const { return get<Array>("array"); }
+    const Object&      as_object() const { return get<Object>("object"); }
+
+    // Member of an object with the given key, nullptr if there is none or the value is not an object
+    const JsonValue* find(std::string_view key) const noexcept
+    {
+        if (const Object* object = std::get_if<Object>(&m_value))
+        {
+            for (const auto& member : *object)
+            {
+                if (member.first == key)
+                {
+                    return &member.second;
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    // Number member of an object, or fallback if it is not present
+    double number_or(std::string_view key, double fallback) const
+    {
+        const JsonValue* member = find(key);
+        return member ? member->as_number() : fallback;
+    }
+
+  private:
+    template <typename T>
+    const T& get(const char* type) const
+    {
+        if (const T* value = std::get_if<T>(&m_value))
+        {
+            return *value;
+        }
+        throw std::runtime_error(std::string("Expected a JSON ") + type);
+    }
+
+    std::variant<std::nullptr_t, bool, double, std::string, Array, Object> m_value = nullptr;
+};
+
+namespace detail
+{
+
+class JsonParser
+{
+  public:
+    explicit JsonParser(std::string_view input) noexcept : m_input(input) {}
+
+    JsonValue parse_document()
+    {
+        JsonValue value = parse_value(0);
+        skip_whitespace();
+        if (m_position != m_input.size())
+        {
+            fail("Unexpected content after JSON value");
+        }
+        return value;
+    }
+
+  private:
+    // Documents nested deeper than this are rejected rather than exhausting the stack
+    constexpr static size_t max_depth = 256;
+
+    [[noreturn]] void fail(const std::string& message) const
+    {
+        throw std::runtime_error(message + " at offset " + std::to_string(m_position));
+    }
+
+    void skip_whitespace() noexcept
+    {
+        while (m_position < m_input.size() &&
+               (m_input[m_position] == ' ' || m_input[m_position] == '\t' || m_input[m_position] == '\n' ||
+                m_input[m_position] == '\r'))
+        {
+            m_position++;
+        }
+    }
+
+    bool consume(char c) noexcept
+    {
+        skip_whitespace();
+        if (m_position < m_input.size() && m_input[m_position] == c)
+        {
+            m_position++;
+            return true;
+        }
+        return false;
+    }
+
+    void expect(char c)
+    {
+        if (!consume(c))
+        {
+            fail(std::string("Expected '") + c + "'");
+        }
+    }
+
+    bool consume_literal(std::string_view literal) noexcept
+    {
+        if (m_input.substr(m_position, literal.size()) == literal)
+        {
+            m_position += literal.size();
+            return true;
+        }
+        return false;
+    }
+
+    JsonValue parse_value(size_t depth)
+    {
+        if (depth > max_depth)
+        {
+            fail("JSON nested too deeply");
+        }
+        skip_whitespace();
+        if (m_position == m_input.size())
+        {
+            fail("Unexpected end of JSON");
+        }
+
+        const char c = m_input[m_position];
+        if (c == '{')
+        {
+            return parse_object(depth);
+        }
+        if (c == '[')
+        {
+            return parse_array(depth);
+        }
+        if (c == '"')
+        {
+            return JsonValue(parse_string());
+        }
+        if (consume_literal("true"))
+        {
+            return JsonValue(true);
+        }
+        if (consume_literal("false"))
+        {
+            return JsonValue(false);
+        }
+        if (consume_literal("null"))
+        {
+            return JsonValue();
+        }
+        return JsonValue(parse_number());
+    }
+
+    JsonValue parse_object(size_t depth)
+    {
+        expect('{');
+        JsonValue::Object object;
+        if (consume('}'))
+        {
+            return JsonValue(std::move(object));
+        }
+        do
+        {
+            skip_whitespace();
+            std::string key = parse_string();
+            expect(':');
+            object.emplace_back(std::move(key), parse_value(depth + 1));
+        } while (consume(','));
+        expect('}');
+        return JsonValue(std::move(object));
+    }
+
+    JsonValue parse_array(size_t depth)
+    {
+        expect('[');
+        JsonValue::Array array;
+        if (consume(']'))
+        {
+            return JsonValue(std::move(array));
+        }
+        do
+        {
+            array.push_back(parse_value(depth + 1));
+        } while (consume(','));
+        expect(']');
+        return JsonValue(std::move(array));
+    }
+
+    double parse_number()
+    {
+        // from_chars does not accept a leading '+', which JSON does not allow either
+        double      value = 0.0;
+        const char* begin = m_input.data() + m_position;
+        const auto  end   = std::from_chars(begin, m_input.data() + m_input.size(), value);
+        if (end.ec != std::errc() || end.ptr == begin)
+        {
+            fail("Invalid JSON value");
+        }
+        m_position += static_cast<size_t>(end.ptr - begin);
+        return value;
+    }
+
+    uint32_t parse_hex4()
+    {
+        uint32_t    value = 0;
+        const char* begin = m_input.data() + m_position;
+        if (m_input.size() - m_position < 4 || std::from_chars(begin, begin + 4, value, 16).ptr != begin + 4)
+        {
+            fail("Invalid unicode escape");
+        }
+        m_position += 4;
+        return value;
+    }
+
+    static void append_utf8(std::string& output, uint32_t code_point)
+    {
+        if (code_point < 0x80)
+        {
+            output.push_back(static_cast<char>(code_point));
+        }
+        else if (code_point < 0x800)
+        {
+            output.push_back(static_cast<char>(0xC0 | (code_point >> 6)));
+            output.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+        }
+        else if (code_point < 0x10000)
+        {
+            output.push_back(static_cast<char>(0xE0 | (code_point >> 12)));
+            output.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+            output.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+        }
+        else
+        {
+            output.push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+            output.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+            output.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+            output.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+        }
+    }
+
+    std::string parse_string()
+    {
+        if (m_position == m_input.size() || m_input[m_position] != '"')
+        {
+            fail("Expected a JSON string");
+        }
+        m_position++;
+
+        std::string output;
+        while (m_position < m_input.size() && m_input[m_position] != '"')
+        {
+            const char c = m_input[m_position++];
+            if (c != '\\')
+            {
+                output.push_back(c);
+                continue;
+            }
+            if (m_position == m_input.size())
+            {
+                break;
+            }
+            switch (const char escaped = m_input[m_position++])
+            {
+            case 'b':
+                output.push_back('\b');
+                break;
+            case 'f':
+                output.push_back('\f');
+                break;
+            case 'n':
+                output.push_back('\n');
+                break;
+            case 'r':
+                output.push_back('\r');
+                break;
+            case 't':
+                output.push_back('\t');
+                break;
+            case 'u':
+            {
+                uint32_t code_point = parse_hex4();
+                if (code_point >= 0xD800 && code_point < 0xDC00 && consume_literal("\\u"))
+                {
+                    // Surrogate pair
+                    const uint32_t low = parse_hex4();
+                    code_point         = 0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+                }
+                append_utf8(output, code_point);
+                break;
+            }
+            default:
+                output.push_back(escaped);
+            }
+        }
+        if (m_position == m_input.size())
+        {
+            fail("Unterminated JSON string");
+        }
+        m_position++;
+        return output;
+    }
+
+    std::string_view m_input;
+    size_t           m_position = 0;
+};
+
+} // namespace detail
+
+// Throws std::runtime_error if input is not a JSON document
+inline JsonValue parse_json(std::string_view input) { return detail::JsonParser(input).parse_document(); }
+
+} // namespace benchmark
+} // namespace fast_ber
@@ -0,0 +1,282 @@
+#pragma once
+
+// Loading of benchmark runs, either as written by the benchmark harness in the JSON format of Results.hpp, or from
+// the console output of the Catch benchmarks (fast_ber_benchmarks) as kept in benchmarks/history before that format
+
+#include "../Results.hpp"
+#include "Json.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace fast_ber
+{
+namespace benchmark
+{
+
+struct Run
+{
+    std::string               source; // File the run was loaded from
+    std::string               suite;
+    std::vector<ContextEntry> context;
+    std::vector<Result>       results;
+
+    // Value of a context entry, empty if not present
+    std::string_view context_value(std::string_view key) const noexcept
+    {
+        for (const ContextEntry& entry : context)
+        {
+            if (entry.first == key)
+            {
+                return entry.second;
+            }
+        }
+        return {};
+    }
+
+    const Result* find(std::string_view name) const noexcept
+    {
+        for (const Result& result : results)
+        {
+            if (result.name == name)
+            {
+                return &result;
+            }
+        }
+        return nullptr;
+    }
+
+    // The version the run was made with if known, otherwise its file
+    std::string label() const
+    {
+        const std::string_view describe = context_value("git_describe");
+        return describe.empty() ? source : std::string(describe);
+    }
+};
+
+// Throws std::runtime_error if text is not a JSON run
+inline Run read_json_run(std::string_view text)
+{
+    const JsonValue document = parse_json(text);
+
+    Run run;
+    if (const JsonValue* suite = document.find("suite"))
+    {
+        run.suite = suite->as_string();
+    }
+    if (const JsonValue* context = document.find("context"))
+    {
+        for (const auto& entry : context->as_object())
+        {
+            run.context.emplace_back(entry.first, entry.second.as_string());
+        }
+    }
+
+    const JsonValue* benchmarks = document.find("benchmarks");
+    if (!benchmarks)
+    {
+        throw std::runtime_error("JSON run has no benchmarks");
+    }
+    for (const JsonValue& benchmark : benchmarks->as_array())
+    {
+        const JsonValue* name = benchmark.find("name");
+        if (!name)
+        {
+            throw std::runtime_error("JSON benchmark has no name");
+        }
+
+        Result result;
+        result.name       = name->as_string();
+        result.runs       = static_cast<size_t>(benchmark.number_or("runs", 1));
+        result.operations = static_cast<size_t>(benchmark.number_or("operations", 0));
+        result.bytes      = static_cast<size_t>(benchmark.number_or("bytes", 0));
+        result.seconds    = benchmark.number_or("seconds", 0);
+        result.ns_stddev  = benchmark.number_or("ns_per_op_stddev", 0);
+        if (result.operations == 0)
+        {
+            // Results giving only the time per operation
+            result.operations = 1;
+            result.seconds    = benchmark.number_or("ns_per_op", 0) / 1e9;
+        }
+
+        if (const JsonValue* counters = benchmark.find("counters_per_op"))
+        {
+            for (size_t event = 0; event < perf_event_count; event++)
+            {
+                if (const JsonValue* value = counters->find(perf_event_names[event]))
+                {
+                    result.counters.values[event]    = value->as_number() * static_cast<double>(result.operations);
+                    result.counters.available[event] = true;
+                }
+            }
+        }
+        if (const JsonValue* latency_ns = benchmark.find("latency_ns"))
+        {
+            Latency latency;
+            latency.samples     = static_cast<size_t>(latency_ns->number_or("samples", 0));
+            latency.overhead_ns = latency_ns->number_or("overhead", 0);
+            latency.min         = latency_ns->number_or("min", 0);
+            latency.p50         = latency_ns->number_or("p50", 0);
+            latency.p90         = latency_ns->number_or("p90", 0);
+            latency.p99         = latency_ns->number_or("p99", 0);
+            latency.p999        = latency_ns->number_or("p99.9", 0);
+            latency.max         = latency_ns->number_or("max", 0);
+            result.latency      = latency;
+        }
+        run.results.push_back(std::move(result));
+    }
+    return run;
+}
+
+namespace detail
+{
+
+inline bool is_rule(std::string_view line, char c) noexcept
+{
+    return line.size() >= 40 && line.find_first_not_of(c) == std::string_view::npos;
+}
+
+inline std::string_view trim(std::string_view text) noexcept
+{
+    const size_t begin = text.find_first_not_of(" \t\r");
+    if (begin == std::string_view::npos)
+    {
+        return {};
+    }
+    return text.substr(begin, text.find_last_not_of(" \t\r") - begin + 1);
+}
+
+inline bool is_digits(std::string_view text) noexcept
+{
+    return !text.empty() && text.find_first_not_of("0123456789") == std::string_view::npos;
+}
+
+} // namespace detail
+
+// Reads the console output of Catch 2.4 benchmarks, a table per test case of each benchmark's name, iterations,
+// elapsed nanoseconds and average. Each iteration of a Catch BENCHMARK block counts as one operation, and results are
+// named "test case/benchmark" as benchmark names are repeated between test cases
+inline Run read_catch_run(std::string_view text)
+{
+    std::vector<std::string_view> lines;
+    for (size_t begin = 0; begin < text.size();)
+    {
+        const size_t end = std::min(text.find('\n', begin), text.size());
+        lines.push_back(text.substr(begin, end - begin));
+        begin = end + 1;
+    }
+
+    Run run;
+    run.suite = "fast_ber_benchmarks";
+
+    std::string test_case;
+    std::string pending_name; // Start of a benchmark name wrapped over several lines
+    bool        in_table = false;
+    for (size_t i = 0; i < lines.size(); i++)
+    {
+        const std::string_view line = lines[i];
+        if (const size_t version = line.find("is a Catch v"); version != std::string_view::npos)
+        {
+            const std::string_view rest = line.substr(version + 12);
+            run.context.emplace_back("catch_version", std::string(rest.substr(0, rest.find(' '))));
+        }
+        else if (detail::is_rule(line, '-') && i + 2 < lines.size() && detail::is_rule(lines[i + 2], '-') &&
+                 !detail::trim(lines[i + 1]).empty())
+        {
+            test_case = std::string(detail::trim(lines[i + 1]));
+            in_table  = false;
+            i += 2;
+        }
+        else if (line.rfind("benchmark name", 0) == 0)
+        {
+            in_table = true;
+            pending_name.clear();
+        }
+        else if (detail::trim(line).empty())
+        {
+            in_table = false;
+        }
+        else if (in_table && !detail::is_rule(line, '-'))
+        {
+            // Columns are separated by spaces, but names may contain spaces, so the numbers are found from the right
+            std::vector<std::pair<size_t, std::string_view>> tokens;
+            for (size_t position = 0; position < line.size();)
+            {
+                const size_t begin = line.find_first_not_of(' ', position);
+                if (begin == std::string_view::npos)
+                {
+                    break;
+                }
+                const size_t end = std::min(line.find(' ', begin), line.size());
+                tokens.emplace_back(begin, line.substr(begin, end - begin));
+                position = end;
+            }
+
+            const size_t count = tokens.size();
+            if (count >= 5 && detail::is_digits(tokens[count - 4].second) &&
+                detail::is_digits(tokens[count - 3].second))
+            {
+                // Catch pads names to align them, such as "fast_ber        - decode", so spaces are collapsed
+                std::string name;
+                pending_name += detail::trim(line.substr(0, tokens[count - 4].first));
+                for (const char c : pending_name)
+                {
+                    if (c != ' ' || (!name.empty() && name.back() != ' '))
+                    {
+                        name.push_back(c);
+                    }
+                }
+                pending_name.clear();
+
+                Result result;
+                result.name       = test_case + "/" + name;
+                result.runs       = std::stoull(std::string(tokens[count - 4].second));
+                result.operations = result.runs;
+                result.seconds    = std::stod(std::string(tokens[count - 3].second)) / 1e9;
+                run.results.push_back(std::move(result));
+            }
+            else
+            {
+                pending_name += std::string(detail::trim(line)) + " ";
+            }
+        }
+    }
+    if (run.results.empty())
+    {
+        throw std::runtime_error("No Catch benchmark results found");
+    }
+    return run;
+}
+
+// Reads a run from a file, in either format. Throws std::runtime_error on failure
+inline Run load_run(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        throw std::runtime_error("Failed to open " + path);
+    }
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    const std::string text = contents.str();
+
+    const size_t first = text.find_first_not_of(" \t\r\n");
+    try
+    {
+        Run run    = (first != std::string::npos && text[first] == '{') ? read_json_run(text) : read_catch_run(text);
+        run.source = path;
+        return run;
+    }
+    catch (const std::exception& e)
+    {
+        throw std::runtime_error(path + ": " + e.what());
+    }
+}
+
+} // namespace benchmark
+} // namespace fast_ber
@@ -0,0 +1,387 @@
+#include "BuildInfo.hpp"
+#include "CdrCorpus.hpp"
+#include "Harness.hpp"
+
+#include "fast_ber/ber_types/Integer.hpp"
+#include "fast_ber/ber_types/OctetString.hpp"
+#include "fast_ber/ber_types/SequenceOf.hpp"
+#include "fast_ber/util/EncodeIdentifiers.hpp"
+#include "fast_ber/util/Extract.hpp"
+
+#include <array>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using fast_ber::benchmark::Cdr::CallEventRecord;
+using fast_ber::benchmark::do_not_optimize;
+using fast_ber::benchmark::Harness;
+
+// Number of calls made by each run of a header microbenchmark
+constexpr size_t header_operations = 1000000;
+
+// Number of elements in the sequences of the member decoding benchmarks
+constexpr size_t sequence_elements = 10000;
+
+struct Options
+{
+    size_t      records     = 10000;
+    uint64_t    seed        = 1;
+    double      min_seconds = 1.0;
+    std::string filter;
+    std::string json_path; // "-" for standard output
+};
+
+// Encoded records, stored back to back
+struct Corpus
+{
+    std::vector<uint8_t>                  data;
+    std::vector<std::span<const uint8_t>> records;
+};
+
+void usage(const char* program)
+{
+    std::cerr << "Usage: " << program
+              << " [--records N] [--seed N] [--min-time SECONDS] [--filter TEXT] [--json FILE]\n"
+              << "Benchmarks encoding and decoding of a generated corpus of SGSN charging data records, decoding of\n"
+              << "sequences of small values, and header extraction and encoding. Results are written as JSON to FILE,\n"
+              << "or to standard output if FILE is -\n";
+}
+
+bool parse_options(int argc, char** argv, Options& options)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const std::string argument = argv[i];
+        if (i + 1 == argc)
+        {
+            return false;
+        }
+        const std::string value = argv[++i];
+        if (argument == "--records")
+        {
+            options.records = std::stoul(value);
+        }
+        else if (argument == "--seed")
+        {
+            options.seed = std::stoull(value);
+        }
+        else if (argument == "--min-time")
+        {
+            options.min_seconds = std::stod(value);
+        }
+        else if (argument == "--filter")
+        {
+            options.filter = value;
+        }
+        else if (argument == "--json")
+        {
+            options.json_path = value;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return options.records > 0;
+}
+
+Corpus generate_corpus(const Options& options)
+{
+    fast_ber::benchmark::CdrGenerator generator(options.seed);
+    std::vector<CallEventRecord>      records;
+    records.reserve(options.records);
+
+    size_t total_length = 0;
+    for (size_t i = 0; i < options.records; i++)
+    {
+        records.push_back(generator.record());
+        total_length += fast_ber::encoded_length(records.back());
+    }
+
+    Corpus corpus;
+    corpus.data.resize(total_length);
+    size_t offset = 0;
+    for (const CallEventRecord& record : records)
+    {
+        const fast_ber::EncodeResult result = fast_ber::encode(std::span(corpus.data).subspan(offset), record);
+        if (!result.success)
+        {
+            std::cerr << "Failed to encode generated record\n";
+            std::exit(EXIT_FAILURE);
+        }
+        corpus.records.emplace_back(corpus.data.data() + offset, result.length);
+        offset += result.length;
+    }
+    return corpus;
+}
+
+// Current time as UTC, in ISO 8601 form
+std::string utc_time_now()
+{
+    const std::time_t now = std::time(nullptr);
+    std::tm           utc = {};
+#ifdef _WIN32
+    gmtime_s(&utc, &now);
+#else
+    gmtime_r(&now, &utc);
+#endif
+    std::array<char, 32> buffer = {};
+    return std::string(buffer.data(), std::strftime(buffer.data(), buffer.size(), "%Y-%m-%dT%H:%M:%SZ", &utc));
+}
+
+void check(bool success, const char* operation)
+{
+    if (!success)
+    {
+        std::cerr << operation << " failed\n";
+        std::exit(EXIT_FAILURE);
+    }
+}
+
+void benchmark_corpus(Harness& harness, const Corpus& corpus)
+{
+    const size_t records = corpus.records.size();
+    const size_t bytes   = corpus.data.size();
+
+    // Records must survive a round trip unchanged for the benchmarks to be meaningful
+    std::vector<CallEventRecord> decoded(records);
+    std::vector<uint8_t>         output(bytes);
+    size_t                       offset = 0;
+    for (size_t i = 0; i < records; i++)
+    {
+        check(fast_ber::decode(corpus.records[i], decoded[i]).success, "Decode");
+        offset += fast_ber::encode(std::span(output).subspan(offset), decoded[i]).length;
+    }
+    check(output == corpus.data, "Round trip");
+
+    harness.run("cdr/encode", records, bytes, [&] {
+        size_t offset = 0;
+        for (const CallEventRecord& record : decoded)
+        {
+            const fast_ber::EncodeResult result = fast_ber::encode(std::span(output).subspan(offset), record);
+            offset += result.length;
+        }
+        check(offset == bytes, "Encode");
+        do_not_optimize(output.data());
+    });
+
+    // Decoding into a reused record, as a decoding loop would
+    CallEventRecord record;
+    harness.run("cdr/decode", records, bytes, [&] {
+        bool success = true;
+        for (std::span<const uint8_t> encoded : corpus.records)
+        {
+            success &= fast_ber::decode(encoded, record).success;
+            do_not_optimize(record);
+        }
+        check(success, "Decode");
+    });
+
+    // Decoding into a new record each time, which is constructed and destroyed with each decode
+    harness.run("cdr/decode_new", records, bytes, [&] {
+        bool success = true;
+        for (std::span<const uint8_t> encoded : corpus.records)
+        {
+            CallEventRecord new_record;
+            success &= fast_ber::decode(encoded, new_record).success;
+            do_not_optimize(new_record);
+        }
+        check(success, "Decode");
+    });
+
+    harness.run("cdr/round_trip", records, bytes, [&] {
+        bool   success = true;
+        size_t offset  = 0;
+        for (std::span<const uint8_t> encoded : corpus.records)
+        {
+            success &= fast_ber::decode(encoded, record).success;
+            offset += fast_ber::encode(std::span(output).subspan(offset), record).length;
+        }
+        check(success && offset == bytes, "Round trip");
+        do_not_optimize(output.data());
+    });
+
+    // Single records timed one at a time, for the spread of latencies as well as the mean. Every record is sampled
+    harness.run_latency(
+        "cdr/encode_latency",
+        [&](size_t i) {
+            const size_t length = fast_ber::encode(std::span(output), decoded[i % records]).length;
+            do_not_optimize(output.data());
+            return length;
+        },
+        records);
+    harness.run_latency(
+        "cdr/decode_latency",
+        [&](size_t i) {
+            const std::span<const uint8_t> encoded = corpus.records[i % records];
+            check(fast_ber::decode(encoded, record).success, "Decode");
+            do_not_optimize(record);
+            return encoded.size();
+        },
+        records);
+
+    // Destruction of decoded records, which frees any storage that outgrew its inline capacity
+    std::vector<CallEventRecord> to_destroy;
+    harness.run(
+        "cdr/destroy", records, bytes, [&] { to_destroy = decoded; },
+        [&] {
+            to_destroy.clear();
+            do_not_optimize(to_destroy.data());
+        });
+}
+
+// Valid sequences of small values, where the result returned by the decode of each element is a large part of the cost
+template <typename Value>
+void benchmark_sequence_decode(Harness& harness, const std::string& name, const Value& value)
+{
+    fast_ber::SequenceOf<Value> sequence;
+    sequence.assign(sequence_elements, value);
+    std::vector<uint8_t> encoded(fast_ber::encoded_length(sequence));
+    check(fast_ber::encode(std::span(encoded), sequence).success, "Encode");
+
+    fast_ber::SequenceOf<Value> decoded;
+    harness.run("sequence/decode_" + name, sequence_elements, encoded.size(), [&] {
+        check(fast_ber::decode(std::span<const uint8_t>(encoded), decoded).success, "Decode");
+        do_not_optimize(decoded.data());
+    });
+}
+
+void benchmark_sequences(Harness& harness)
+{
+    benchmark_sequence_decode(harness, "integers", fast_ber::Integer<>(1000));
+    benchmark_sequence_decode(harness, "strings", fast_ber::OctetString<>("value"));
+}
+
+void benchmark_extract_tag(Harness& harness, const std::string& name, std::array<uint8_t, 4> header)
+{
+    harness.run("extract_tag/" + name, header_operations, 0, [&] {
+        for (size_t i = 0; i < header_operations; i++)
+        {
+            do_not_optimize(header);
+            fast_ber::Tag tag    = 0;
+            size_t        length = fast_ber::extract_tag(header, tag);
+            do_not_optimize(tag);
+            do_not_optimize(length);
+        }
+    });
+}
+
+void benchmark_extract_length(Harness& harness, const std::string& name, std::array<uint8_t, 11> header)
+{
+    harness.run("extract_length/" + name, header_operations, 0, [&] {
+        for (size_t i = 0; i < header_operations; i++)
+        {
+            do_not_optimize(header);
+            size_t content_length = 0;
+            bool   indefinite     = false;
+            size_t length         = fast_ber::extract_length(header, content_length, 1, indefinite);
+            do_not_optimize(content_length);
+            do_not_optimize(indefinite);
+            do_not_optimize(length);
+        }
+    });
+}
+
+void benchmark_encode_header(Harness& harness, const std::string& name, fast_ber::Tag tag, size_t content_length)
+{
+    std::array<uint8_t, 16> output = {};
+    harness.run("encode_header/" + name, header_operations, 0, [&] {
+        for (size_t i = 0; i < header_operations; i++)
+        {
+            do_not_optimize(tag);
+            do_not_optimize(content_length);
+            size_t length = fast_ber::encode_header(output, fast_ber::Construction::primitive,
+                                                    fast_ber::Class::context_specific, tag, content_length);
+            do_not_optimize(output);
+            do_not_optimize(length);
+        }
+    });
+}
+
+void benchmark_headers(Harness& harness)
+{
+    // Tags below 31 fit in the identifier octet, larger tags take one more octet per 7 bits
+    benchmark_extract_tag(harness, "short", {0x85, 0x01, 0x00, 0x00});
+    benchmark_extract_tag(harness, "long_1", {0x9F, 0x65, 0x01, 0x00});
+    benchmark_extract_tag(harness, "long_2", {0x9F, 0x87, 0x68, 0x01});
+
+    // Lengths below 128 are a single octet, larger lengths are preceded by a count of length octets
+    benchmark_extract_length(harness, "short", {0x80, 0x64});
+    benchmark_extract_length(harness, "long_1", {0x80, 0x81, 0xC8});
+    benchmark_extract_length(harness, "long_2", {0x80, 0x82, 0x03, 0xE8});
+    benchmark_extract_length(harness, "long_3", {0x80, 0x83, 0x01, 0x86, 0xA0});
+    benchmark_extract_length(harness, "long_4", {0x80, 0x84, 0x05, 0xF5, 0xE1, 0x00});
+    benchmark_extract_length(harness, "long_8", {0x80, 0x88, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00});
+    benchmark_extract_length(harness, "indefinite", {0x80, 0x80});
+
+    benchmark_encode_header(harness, "short", 5, 100);
+    benchmark_encode_header(harness, "long_1", 5, 200);
+    benchmark_encode_header(harness, "long_2", 5, 1000);
+    benchmark_encode_header(harness, "long_3", 5, 100000);
+    benchmark_encode_header(harness, "long_4", 5, 100000000);
+    benchmark_encode_header(harness, "long_tag", 1000, 100);
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Options options;
+    if (!parse_options(argc, argv, options))
+    {
+        usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    // Keep standard output for the results if they are written there
+    std::ostream&     log     = options.json_path == "-" ? std::cerr : std::cout;
+    const std::string started = utc_time_now();
+
+    const Corpus corpus = generate_corpus(options);
+    log << "Corpus of " << corpus.records.size() << " records, " << corpus.data.size() << " bytes\n";
+
+    Harness harness(options.min_seconds, options.filter, log);
+    benchmark_corpus(harness, corpus);
+    benchmark_sequences(harness);
+    benchmark_headers(harness);
+
+    if (!options.json_path.empty())
+    {
+        namespace build_info = fast_ber::benchmark::build_info;
+
+        const std::vector<fast_ber::benchmark::ContextEntry> context = {
+            {"git_describe", build_info::git_describe},
+            {"compiler", build_info::compiler},
+            {"flags", build_info::flags},
+            {"build_type", build_info::build_type},
+            {"date", started},
+            {"records", std::to_string(corpus.records.size())},
+            {"corpus_bytes", std::to_string(corpus.data.size())},
+            {"seed", std::to_string(options.seed)},
+            {"min_time", std::to_string(options.min_seconds)}};
+
+        if (options.json_path == "-")
+        {
+            harness.write_json(std::cout, "sgsn_cdr", context);
+        }
+        else
+        {
+            std::ofstream file(options.json_path);
+            harness.write_json(file, "sgsn_cdr", context);
+            if (!file)
+            {
+                std::cerr << "Failed to write " << options.json_path << "\n";
+                return EXIT_FAILURE;
+            }
+        }
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,511 @@
+#pragma once
+
+// Generation of a corpus of SGSN charging data records (3GPP TS 32.298). Records mix the three record types in
+// proportions typical of an SGSN, with optional members present at varying rates, nested CHOICEs for addresses and
+// diagnostics, and SEQUENCE OFs of traffic volume containers. Generation is seeded, so a corpus is reproducible
+
+#include "autogen/sgsn_cdr.hpp"
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace fast_ber
+{
+namespace benchmark
+{
+
+namespace Cdr = fast_ber::SGSN_2009A_CDR;
+
+class CdrGenerator
+{
+  public:
+    explicit CdrGenerator(uint64_t seed) : m_random(seed) {}
+
+    Cdr::CallEventRecord record();
+
+  private:
+    bool        present(double probability) { return std::bernoulli_distribution(probability)(m_random); }
+    int64_t     integer(int64_t min, int64_t max) { return std::uniform_int_distribution<int64_t>(min, max)(m_random); }
+    std::string octets(size_t min, size_t max);
+    std::string bcd(size_t length); // Telephony numbers, two digits per octet
+    std::string text(size_t min, size_t max);
+    std::string time_stamp(); // YYMMDDhhmmssShhmm, nine octets of BCD
+
+    void fill(Cdr::IPAddress& address);
+    void fill(Cdr::PDPAddress& address);
+    void fill(Cdr::Diagnostics& diagnostics);
+    void fill(Cdr::ChangeOfCharCondition& condition);
+    void fill(Cdr::ManagementExtension& extension);
+    void fill(Cdr::CAMELInformationPDP& camel);
+    void fill(Cdr::CAMELInformationSMS& camel);
+    void fill(Cdr::SGSNPDPRecord& record);
+    void fill(Cdr::SGSNSMORecord& record);
+    void fill(Cdr::SGSNSMTRecord& record);
+
+    std::mt19937_64 m_random;
+};
+
+inline std::string CdrGenerator::octets(size_t min, size_t max)
+{
+    std::string result(static_cast<size_t>(integer(int64_t(min), int64_t(max))), '\0');
+    for (char& c : result)
+    {
+        c = static_cast<char>(integer(0, 255));
+    }
+    return result;
+}
+
+inline std::string CdrGenerator::bcd(size_t length)
+{
+    std::string result(length, '\0');
+    for (char& c : result)
+    {
+        c = static_cast<char>(integer(0, 9) << 4 | integer(0, 9));
+    }
+    return result;
+}
+
+inline std::string CdrGenerator::text(size_t min, size_t max)
+{
+    static constexpr char characters[] = "abcdefghijklmnopqrstuvwxyz0123456789.-";
+
+    std::string result(static_cast<size_t>(integer(int64_t(min), int64_t(max))), '\0');
+    for (char& c : result)
+    {
+        c = characters[integer(0, sizeof(characters) - 2)];
+    }
+    return result;
+}
+
+inline std::string CdrGenerator::time_stamp()
+{
+    const auto to_bcd = [](int64_t value) { return static_cast<char>((value / 10) << 4 | (value % 10)); };
+    return {to_bcd(integer(10, 29)), to_bcd(integer(1, 12)), to_bcd(integer(1, 28)),
+            to_bcd(integer(0, 23)),  to_bcd(integer(0, 59)), to_bcd(integer(0, 59)),
+            present(0.5) ? '+' : '-', to_bcd(integer(0, 12)), to_bcd(integer(0, 1) * 30)};
+}
+
+inline void CdrGenerator::fill(Cdr::IPAddress& address)
+{
+    // Mostly binary IPv4, as seen from operators. Text forms are rare
+    if (present(0.9))
+    {
+        Cdr::IPBinaryAddress& binary = address.emplace<0>();
+        if (present(0.8))
+        {
+            binary.emplace<0>() = octets(4, 4);
+        }
+        else
+        {
+            binary.emplace<1>() = octets(16, 16);
+        }
+    }
+    else
+    {
+        Cdr::IPTextRepresentedAddress& text_address = address.emplace<1>();
+        if (present(0.8))
+        {
+            text_address.emplace<0>() = std::to_string(integer(1, 223)) + "." + std::to_string(integer(0, 255)) +
+                                        "." + std::to_string(integer(0, 255)) + "." + std::to_string(integer(1, 254));
+        }
+        else
+        {
+            text_address.emplace<1>() = "2001:db8:" + text(4, 4) + "::" + text(1, 4);
+        }
+    }
+}
+
+inline void CdrGenerator::fill(Cdr::PDPAddress& address)
+{
+    if (present(0.95))
+    {
+        fill(address.emplace<0>());
+    }
+    else
+    {
+        address.emplace<1>() = bcd(static_cast<size_t>(integer(4, 9)));
+    }
+}
+
+inline void CdrGenerator::fill(Cdr::Diagnostics& diagnostics)
+{
+    if (present(0.5))
+    {
+        diagnostics.emplace<0>() = integer(0, 127);
+    }
+    else
+    {
+        diagnostics.emplace<1>() = integer(0, 255);
+    }
+}
+
+inline void CdrGenerator::fill(Cdr::ChangeOfCharCondition& condition)
+{
+    if (present(0.7))
+    {
+        condition.qosRequested = octets(4, 15);
+    }
+    if (present(0.7))
+    {
+        condition.qosNegotiated = octets(4, 15);
+    }
+    condition.dataVolumeGPRSUplink   = integer(0, int64_t(1) << 32);
+    condition.dataVolumeGPRSDownlink = integer(0, int64_t(1) << 36);
+    condition.changeCondition        = static_cast<Cdr::ChangeConditionValues>(integer(0, 2));
+    condition.changeTime             = time_stamp();
+}
+
+inline void CdrGenerator::fill(Cdr::ManagementExtension& extension)
+{
+    extension.identifier   = ObjectIdentifier<>{0, 4, 0, 127, 0, integer(0, 20), integer(0, 1000)};
+    extension.significance = present(0.2);
+    if (present(0.5))
+    {
+        Cdr::ExtendedDiagnostics& diagnostics = extension.information.extendedDiagnostics.emplace();
+        if (present(0.5))
+        {
+            diagnostics.emplace<0>() = integer(0, 255);
+        }
+        else
+        {
+            diagnostics.emplace<1>() = integer(0, 512);
+        }
+    }
+}
+
+inline void CdrGenerator::fill(Cdr::CAMELInformationPDP& camel)
+{
+    camel.sCFAddress                 = bcd(static_cast<size_t>(integer(4, 9)));
+    camel.serviceKey                 = integer(0, 2147483647);
+    camel.defaultTransactionHandling = static_cast<Cdr::DefaultGPRS_HandlingValues>(integer(0, 1));
+    if (present(0.6))
+    {
+        camel.cAMELAccessPointNameNI = text(8, 30);
+    }
+    if (present(0.3))
+    {
+        camel.cAMELAccessPointNameOI = "mnc0" + std::to_string(integer(10, 99)) + ".mcc" +
+                                       std::to_string(integer(200, 799)) + ".gprs";
+    }
+    if (present(0.5))
+    {
+        camel.numberOfDPEncountered = integer(0, 10);
+    }
+    if (present(0.2))
+    {
+        camel.freeFormatData     = octets(1, 160);
+        camel.fFDAppendIndicator = present(0.5);
+    }
+}
+
+inline void CdrGenerator::fill(Cdr::CAMELInformationSMS& camel)
+{
+    camel.sCFAddress         = bcd(static_cast<size_t>(integer(4, 9)));
+    camel.serviceKey         = integer(0, 2147483647);
+    camel.defaultSMSHandling = static_cast<Cdr::DefaultSMS_HandlingValues>(integer(0, 1));
+    if (present(0.5))
+    {
+        camel.cAMELCallingPartyNumber = bcd(static_cast<size_t>(integer(4, 9)));
+    }
+    if (present(0.5))
+    {
+        camel.cAMELDestinationSubscriberNumber = bcd(static_cast<size_t>(integer(4, 9)));
+    }
+    if (present(0.2))
+    {
+        camel.freeFormatData = octets(1, 160);
+    }
+}
+
+inline void CdrGenerator::fill(Cdr::SGSNPDPRecord& record)
+{
+    record.recordType = 18;
+    record.servedIMSI = bcd(8);
+    if (present(0.9))
+    {
+        record.servedIMEI = bcd(8);
+    }
+    if (present(0.9))
+    {
+        fill(record.sgsnAddress.emplace());
+    }
+    if (present(0.5))
+    {
+        record.msNetworkCapability = octets(1, 8);
+    }
+    if (present(0.8))
+    {
+        record.routingArea = octets(1, 1);
+    }
+    if (present(0.8))
+    {
+        record.locationAreaCode = octets(2, 2);
+    }
+    if (present(0.8))
+    {
+        record.cellIdentifier = octets(2, 2);
+    }
+    record.chargingID = integer(0, 4294967295);
+    fill(record.ggsnAddressUsed);
+    if (present(0.95))
+    {
+        record.accessPointNameNI = text(8, 30);
+    }
+    if (present(0.95))
+    {
+        record.pdpType = octets(2, 2);
+    }
+    if (present(0.9))
+    {
+        fill(record.servedPDPAddress.emplace());
+    }
+    if (present(0.95))
+    {
+        Cdr::SGSNPDPRecord::ListOfTrafficVolumes& volumes = record.listOfTrafficVolumes.emplace();
+        // Usually a single container, long sessions span many tariff periods
+        const int64_t count = present(0.7) ? 1 : integer(2, 12);
+        for (int64_t i = 0; i < count; i++)
+        {
+            fill(volumes.emplace_back());
+        }
+    }
+    record.recordOpeningTime = time_stamp();
+    record.duration          = integer(0, 86400);
+    if (present(0.1))
+    {
+        record.sgsnChange = true;
+    }
+    record.causeForRecClosing = present(0.8) ? 0 : integer(4, 23);
+    if (present(0.2))
+    {
+        fill(record.diagnostics.emplace());
+    }
+    if (present(0.3))
+    {
+        record.recordSequenceNumber = integer(1, 100);
+    }
+    if (present(0.9))
+    {
+        record.nodeID = "SGSN" + std::to_string(integer(1, 99));
+    }
+    if (present(0.05))
+    {
+        Cdr::SGSNPDPRecord::RecordExtensions& extensions = record.recordExtensions.emplace();
+        for (int64_t i = 0, count = integer(1, 3); i < count; i++)
+        {
+            fill(extensions.emplace_back());
+        }
+    }
+    if (present(0.9))
+    {
+        record.localSequenceNumber = integer(0, 4294967295);
+    }
+    if (present(0.8))
+    {
+        record.apnSelectionMode = static_cast<Cdr::APNSelectionModeValues>(integer(0, 2));
+    }
+    if (present(0.8))
+    {
+        record.accessPointNameOI =
+            "mnc0" + std::to_string(integer(10, 99)) + ".mcc" + std::to_string(integer(200, 799)) + ".gprs";
+    }
+    if (present(0.9))
+    {
+        record.servedMSISDN = bcd(9);
+    }
+    record.chargingCharacteristics = octets(2, 2);
+    if (present(0.8))
+    {
+        record.rATType = integer(1, 6);
+    }
+    if (present(0.1))
+    {
+        fill(record.cAMELInformationPDP.emplace());
+    }
+    if (present(0.6))
+    {
+        record.chChSelectionMode = static_cast<Cdr::ChChSelectionModeValues>(integer(1, 4));
+    }
+    if (present(0.3))
+    {
+        record.dynamicAddressFlag = true;
+    }
+    if (present(0.8))
+    {
+        record.pLMNIdentifier = octets(3, 3);
+    }
+    if (present(0.6))
+    {
+        record.mSTimeZone = octets(2, 2);
+    }
+}
+
+inline void CdrGenerator::fill(Cdr::SGSNSMORecord& record)
+{
+    record.recordType = 21;
+    record.servedIMSI = bcd(8);
+    if (present(0.9))
+    {
+        record.servedIMEI = bcd(8);
+    }
+    if (present(0.9))
+    {
+        record.servedMSISDN = bcd(9);
+    }
+    if (present(0.5))
+    {
+        record.msNetworkCapability = octets(1, 8);
+    }
+    if (present(0.9))
+    {
+        record.serviceCentre = bcd(7);
+    }
+    if (present(0.7))
+    {
+        record.recordingEntity = bcd(7);
+    }
+    if (present(0.8))
+    {
+        record.locationArea = octets(2, 2);
+    }
+    if (present(0.8))
+    {
+        record.routingArea = octets(1, 1);
+    }
+    if (present(0.8))
+    {
+        record.cellIdentifier = octets(2, 2);
+    }
+    record.messageReference = octets(1, 1);
+    record.eventTimeStamp   = time_stamp();
+    if (present(0.1))
+    {
+        fill(record.smsResult.emplace());
+    }
+    if (present(0.9))
+    {
+        record.nodeID = "SGSN" + std::to_string(integer(1, 99));
+    }
+    if (present(0.9))
+    {
+        record.localSequenceNumber = integer(0, 4294967295);
+    }
+    record.chargingCharacteristics = octets(2, 2);
+    if (present(0.8))
+    {
+        record.rATType = integer(1, 6);
+    }
+    if (present(0.8))
+    {
+        record.destinationNumber = bcd(static_cast<size_t>(integer(4, 9)));
+    }
+    if (present(0.05))
+    {
+        fill(record.cAMELInformationSMS.emplace());
+    }
+    if (present(0.6))
+    {
+        record.chChSelectionMode = static_cast<Cdr::ChChSelectionModeValues>(integer(1, 4));
+    }
+    if (present(0.8))
+    {
+        record.pLMNIdentifier = octets(3, 3);
+    }
+}
+
+inline void CdrGenerator::fill(Cdr::SGSNSMTRecord& record)
+{
+    record.recordType = 22;
+    record.servedIMSI = bcd(8);
+    if (present(0.9))
+    {
+        record.servedIMEI = bcd(8);
+    }
+    if (present(0.9))
+    {
+        record.servedMSISDN = bcd(9);
+    }
+    if (present(0.5))
+    {
+        record.msNetworkCapability = octets(1, 8);
+    }
+    if (present(0.9))
+    {
+        record.serviceCentre = bcd(7);
+    }
+    if (present(0.7))
+    {
+        record.recordingEntity = bcd(7);
+    }
+    if (present(0.8))
+    {
+        record.locationArea = octets(2, 2);
+    }
+    if (present(0.8))
+    {
+        record.routingArea = octets(1, 1);
+    }
+    if (present(0.8))
+    {
+        record.cellIdentifier = octets(2, 2);
+    }
+    record.eventTimeStamp = time_stamp();
+    if (present(0.1))
+    {
+        fill(record.smsResult.emplace());
+    }
+    if (present(0.9))
+    {
+        record.nodeID = "SGSN" + std::to_string(integer(1, 99));
+    }
+    if (present(0.9))
+    {
+        record.localSequenceNumber = integer(0, 4294967295);
+    }
+    record.chargingCharacteristics = octets(2, 2);
+    if (present(0.8))
+    {
+        record.rATType = integer(1, 6);
+    }
+    if (present(0.6))
+    {
+        record.chChSelectionMode = static_cast<Cdr::ChChSelectionModeValues>(integer(1, 4));
+    }
+    if (present(0.3))
+    {
+        record.numberOfSM           = integer(1, 10);
+        record.locationAreaLastSM   = octets(2, 2);
+        record.routingAreaLastSM    = octets(1, 1);
+        record.cellIdentifierLastSM = octets(2, 2);
+        record.pLMNIdentifierLastSM = octets(3, 3);
+    }
+    if (present(0.8))
+    {
+        record.pLMNIdentifier = octets(3, 3);
+    }
+}
+
+inline Cdr::CallEventRecord CdrGenerator::record()
+{
+    // PDP context records dominate the output of an SGSN, SMS records make up the remainder
+    Cdr::CallEventRecord record;
+    const int64_t        type = integer(0, 99);
+    if (type < 80)
+    {
+        fill(record.emplace<0>());
+    }
+    else if (type < 90)
+    {
+        fill(record.emplace<1>());
+    }
+    else
+    {
+        fill(record.emplace<2>());
+    }
+    return record;
+}
+
+} // namespace benchmark
+} // namespace fast_ber
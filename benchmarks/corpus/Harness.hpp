@@ -0,0 +1,256 @@
+#pragma once
+
+// Minimal benchmark harness for the corpus benchmarks. Each benchmark is run repeatedly until a minimum time has
+// elapsed, and reported as time per operation and throughput, with hardware counters per operation where the system
+// provides them. Latency benchmarks time each operation separately and report percentiles. Results can be written as
+// JSON, see Results.hpp
+
+#include "../DoNotOptimize.hpp"
+#include "../PerfCounters.hpp"
+#include "../Results.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace fast_ber
+{
+namespace benchmark
+{
+
+class Harness
+{
+  public:
+    // Results are printed to log as they complete
+    explicit Harness(double min_seconds, std::string filter = {}, std::ostream& log = std::cout) noexcept
+        : m_min_seconds(min_seconds), m_filter(std::move(filter)), m_log(log)
+    {
+    }
+
+    bool enabled(std::string_view name) const noexcept
+    {
+        return m_filter.empty() || name.find(m_filter) != std::string_view::npos;
+    }
+
+    // Time runs of function, each performing operations_per_run operations over bytes_per_run bytes
+    void run(const std::string& name, size_t operations_per_run, size_t bytes_per_run,
+             const std::function<void()>& function)
+    {
+        run(name, operations_per_run, bytes_per_run, [] {}, function);
+    }
+
+    // As above, with setup called before each run and excluded from the timing
+    void run(const std::string& name, size_t operations_per_run, size_t bytes_per_run,
+             const std::function<void()>& setup, const std::function<void()>& function);
+
+    // Time each call of operation separately, for latency percentiles. Operation is passed the index of the call and
+    // returns the number of bytes it processed. Runs for at least min_samples calls
+    void run_latency(const std::string& name, const std::function<size_t(size_t)>& operation,
+                     size_t min_samples = 1000);
+
+    const std::vector<Result>& results() const noexcept { return m_results; }
+
+    void print(std::ostream& output, const Result& result) const;
+    void write_json(std::ostream& output, const std::string& suite, const std::vector<ContextEntry>& context) const;
+
+  private:
+    double              m_min_seconds;
+    std::string         m_filter;
+    std::ostream&       m_log;
+    std::vector<Result> m_results;
+    PerfCounters        m_counters;
+};
+
+namespace detail
+{
+
+// Sample standard deviation, zero for fewer than two values
+inline double standard_deviation(const std::vector<double>& values)
+{
+    if (values.size() < 2)
+    {
+        return 0.0;
+    }
+    double mean = 0.0;
+    for (const double value : values)
+    {
+        mean += value / static_cast<double>(values.size());
+    }
+    double squares = 0.0;
+    for (const double value : values)
+    {
+        squares += (value - mean) * (value - mean);
+    }
+    return std::sqrt(squares / static_cast<double>(values.size() - 1));
+}
+
+// Median time taken to read the clock twice, subtracted from latency samples
+inline double clock_overhead_ns()
+{
+    std::vector<int64_t> samples(1000);
+    for (int64_t& sample : samples)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const auto end   = std::chrono::steady_clock::now();
+        sample           = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    }
+    std::nth_element(samples.begin(), samples.begin() + samples.size() / 2, samples.end());
+    return static_cast<double>(samples[samples.size() / 2]);
+}
+
+// Nearest rank percentile of sorted samples
+inline double percentile(const std::vector<double>& sorted, double fraction)
+{
+    const size_t rank = static_cast<size_t>(std::ceil(fraction * static_cast<double>(sorted.size())));
+    return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+}
+
+} // namespace detail
+
+inline void Harness::run(const std::string& name, size_t operations_per_run, size_t bytes_per_run,
+                         const std::function<void()>& setup, const std::function<void()>& function)
+{
+    if (!enabled(name))
+    {
+        return;
+    }
+
+    // One untimed run to warm caches and allocators
+    setup();
+    function();
+
+    Result              result;
+    std::vector<double> run_ns; // Time per operation of each run, for the spread between runs
+    result.name = name;
+    while (result.runs == 0 || result.seconds < m_min_seconds)
+    {
+        setup();
+        m_counters.start();
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        const auto end = std::chrono::steady_clock::now();
+        result.counters += m_counters.stop();
+
+        const double seconds = std::chrono::duration<double>(end - start).count();
+        run_ns.push_back(operations_per_run ? seconds * 1e9 / operations_per_run : 0.0);
+        result.seconds += seconds;
+        result.operations += operations_per_run;
+        result.bytes += bytes_per_run;
+        result.runs++;
+    }
+    result.ns_stddev = detail::standard_deviation(run_ns);
+
+    m_results.push_back(result);
+    print(m_log, result);
+}
+
+inline void Harness::run_latency(const std::string& name, const std::function<size_t(size_t)>& operation,
+                                 size_t min_samples)
+{
+    if (!enabled(name))
+    {
+        return;
+    }
+
+    Latency latency;
+    latency.overhead_ns = detail::clock_overhead_ns();
+    operation(0);
+
+    Result result;
+    result.name = name;
+    result.runs = 1;
+
+    std::vector<double> samples;
+    const size_t        required = std::max<size_t>(min_samples, 1);
+    const auto          begin    = std::chrono::steady_clock::now();
+    double              elapsed  = 0.0;
+    for (size_t i = 0; samples.size() < required || elapsed < m_min_seconds; i++)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        result.bytes += operation(i);
+        const auto end = std::chrono::steady_clock::now();
+
+        const std::chrono::duration<double, std::nano> taken = end - start;
+        samples.push_back(std::max(taken.count() - latency.overhead_ns, 0.0));
+        result.seconds += samples.back() / 1e9;
+        elapsed = std::chrono::duration<double>(end - begin).count();
+    }
+
+    // Spread between the means of consecutive batches of samples, comparable to the spread between runs
+    constexpr size_t    batches    = 10;
+    const size_t        batch_size = std::max<size_t>(samples.size() / batches, 1);
+    std::vector<double> batch_ns;
+    for (size_t begin = 0; begin + batch_size <= samples.size(); begin += batch_size)
+    {
+        double total = 0.0;
+        for (size_t i = begin; i < begin + batch_size; i++)
+        {
+            total += samples[i];
+        }
+        batch_ns.push_back(total / static_cast<double>(batch_size));
+    }
+    result.ns_stddev = detail::standard_deviation(batch_ns);
+
+    std::sort(samples.begin(), samples.end());
+    latency.samples   = samples.size();
+    latency.min       = samples.front();
+    latency.p50       = detail::percentile(samples, 0.5);
+    latency.p90       = detail::percentile(samples, 0.9);
+    latency.p99       = detail::percentile(samples, 0.99);
+    latency.p999      = detail::percentile(samples, 0.999);
+    latency.max       = samples.back();
+    result.operations = samples.size();
+    result.latency    = latency;
+
+    m_results.push_back(result);
+    print(m_log, result);
+}
+
+inline void Harness::print(std::ostream& output, const Result& result) const
+{
+    output << std::left << std::setw(40) << result.name << std::right << std::fixed << std::setprecision(2)
+           << std::setw(12) << result.ns_per_operation() << " ns/op" << std::setw(14)
+           << result.operations_per_second() << " op/s";
+    if (result.bytes != 0)
+    {
+        output << std::setw(12) << result.megabytes_per_second() << " MB/s";
+    }
+    if (result.counters.has(PerfEvent::cycles) && result.counters.has(PerfEvent::instructions))
+    {
+        output << std::setw(10) << result.per_operation(PerfEvent::cycles) << " cyc/op" << std::setw(10)
+               << result.per_operation(PerfEvent::instructions) << " ins/op";
+    }
+    if (result.counters.has(PerfEvent::branch_misses) && result.counters.has(PerfEvent::cache_misses))
+    {
+        output << std::setw(8) << result.per_operation(PerfEvent::branch_misses) << " br-miss/op" << std::setw(8)
+               << result.per_operation(PerfEvent::cache_misses) << " cache-miss/op";
+    }
+    if (result.latency)
+    {
+        output << "  p50 " << result.latency->p50 << " p99 " << result.latency->p99 << " p99.9 "
+               << result.latency->p999 << " ns";
+    }
+    if (result.suspect())
+    {
+        output << "  (suspect, check the work is not optimised away)";
+    }
+    output << '\n';
+}
+
+inline void Harness::write_json(std::ostream& output, const std::string& suite,
+                                const std::vector<ContextEntry>& context) const
+{
+    benchmark::write_json(output, suite, context, m_results);
+}
+
+} // namespace benchmark
+} // namespace fast_ber
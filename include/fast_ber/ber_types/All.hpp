@@ -1,6 +1,7 @@
 #pragma once
 
 #include "fast_ber/util/Alias.hpp"
+#include "fast_ber/util/InstrumentationHooks.hpp"
 
 #include "BMPString.hpp"
 #include "BitString.hpp"
@@ -44,3 +45,6 @@
 #include "VisibleString.hpp"
 
 #include "Any.hpp"
+#include "fast_ber/util/LazyView.hpp"
+#include "fast_ber/util/IdentifierTable.hpp"
+#include "fast_ber/util/ObjectIdentifierTable.hpp"
@@ -6,6 +6,7 @@
 #include "fast_ber/ber_types/Construction.hpp"
 #include "fast_ber/util/BerView.hpp"
 #include "fast_ber/util/DecodeHelpers.hpp"
+#include "fast_ber/util/Definitions.hpp"
 #include "fast_ber/util/EncodeHelpers.hpp"
 #include "fast_ber/util/EncodeIdentifiers.hpp"
 #include "fast_ber/util/Extract.hpp"
@@ -18,14 +19,16 @@
 namespace fast_ber
 {
 
-template <typename Identifier = ExplicitId<UniversalTag::boolean>>
+// Boolean stored ber encoded. StorageMode::native stores the value instead, and only produces the encoding when
+// encoded
+template <typename Identifier = ExplicitId<UniversalTag::boolean>, StorageMode storage = StorageMode::static_>
 class Boolean
 {
   public:
     Boolean() noexcept = default;
     Boolean(bool val) noexcept { assign(val); }
-    template <typename Identifier2>
-    Boolean(const Boolean<Identifier2>& rhs) noexcept;
+    template <typename Identifier2, StorageMode storage2>
+    Boolean(const Boolean<Identifier2, storage2>& rhs) noexcept;
     explicit Boolean(BerView view) noexcept { decode(view); }
 
     // Implicit conversion to bool
@@ -34,12 +37,12 @@ class Boolean
     std::span<const uint8_t> ber() const { return std::span<const uint8_t>(m_data); }
 
     Boolean& operator=(bool rhs) noexcept;
-    template <typename Identifier2>
-    Boolean& operator=(const Boolean<Identifier2>& rhs) noexcept;
+    template <typename Identifier2, StorageMode storage2>
+    Boolean& operator=(const Boolean<Identifier2, storage2>& rhs) noexcept;
 
     void assign(bool val) noexcept;
-    template <typename Identifier2>
-    void assign(const Boolean<Identifier2>& rhs) noexcept;
+    template <typename Identifier2, StorageMode storage2>
+    void assign(const Boolean<Identifier2, storage2>& rhs) noexcept;
 
     constexpr static size_t encoded_length() noexcept;
     EncodeResult            encode(std::span<uint8_t> buffer) const noexcept;
@@ -47,7 +50,7 @@ class Boolean
 
     using AsnId = Identifier;
 
-    template <typename Identifier2>
+    template <typename Identifier2, StorageMode storage2>
     friend class Boolean;
 
   private:
@@ -55,48 +58,101 @@ class Boolean
 }; // namespace fast_ber
 
 template <typename Identifier>
-template <typename Identifier2>
-Boolean<Identifier>::Boolean(const Boolean<Identifier2>& rhs) noexcept
+class Boolean<Identifier, StorageMode::native>
 {
-    m_data.back() = rhs.m_data.back();
+  public:
+    Boolean() noexcept = default;
+    Boolean(bool val) noexcept : m_value(val) {}
+    template <typename Identifier2, StorageMode storage2>
+    Boolean(const Boolean<Identifier2, storage2>& rhs) noexcept : m_value(rhs.value())
+    {
+    }
+    explicit Boolean(BerView view) noexcept { decode(view); }
+
+    // Implicit conversion to bool
+         operator bool() const noexcept { return m_value; }
+    bool value() const noexcept { return m_value; }
+
+    Boolean& operator=(bool rhs) noexcept
+    {
+        assign(rhs);
+        return *this;
+    }
+    template <typename Identifier2, StorageMode storage2>
+    Boolean& operator=(const Boolean<Identifier2, storage2>& rhs) noexcept
+    {
+        assign(rhs.value());
+        return *this;
+    }
+
+    void assign(bool val) noexcept { m_value = val; }
+    template <typename Identifier2, StorageMode storage2>
+    void assign(const Boolean<Identifier2, storage2>& rhs) noexcept
+    {
+        m_value = rhs.value();
+    }
+
+    constexpr static size_t encoded_length() noexcept { return fast_ber::encoded_length(1, Identifier{}); }
+    EncodeResult            encode(std::span<uint8_t> buffer) const noexcept;
+    DecodeResult            decode(BerView input) noexcept;
+
+    using AsnId = Identifier;
+
+  private:
+    bool m_value = false;
+};
+
+template <typename Identifier, StorageMode storage>
+template <typename Identifier2, StorageMode storage2>
+Boolean<Identifier, storage>::Boolean(const Boolean<Identifier2, storage2>& rhs) noexcept
+{
+    assign(rhs);
 }
 
-template <typename Identifier>
-inline Boolean<Identifier>& Boolean<Identifier>::operator=(bool rhs) noexcept
+template <typename Identifier, StorageMode storage>
+inline Boolean<Identifier, storage>& Boolean<Identifier, storage>::operator=(bool rhs) noexcept
 {
     assign(rhs);
     return *this;
 }
 
-template <typename Identifier>
-template <typename Identifier2>
-inline Boolean<Identifier>& Boolean<Identifier>::operator=(const Boolean<Identifier2>& rhs) noexcept
+template <typename Identifier, StorageMode storage>
+template <typename Identifier2, StorageMode storage2>
+inline Boolean<Identifier, storage>&
+Boolean<Identifier, storage>::operator=(const Boolean<Identifier2, storage2>& rhs) noexcept
 {
-    m_data.back() = rhs.m_data.back();
+    assign(rhs);
     return *this;
 }
 
-template <typename Identifier>
-inline void Boolean<Identifier>::assign(bool val) noexcept
+template <typename Identifier, StorageMode storage>
+inline void Boolean<Identifier, storage>::assign(bool val) noexcept
 {
     m_data.back() = static_cast<uint8_t>(val ? 0xFF : 0x00);
 }
 
-template <typename Identifier>
-template <typename Identifier2>
-inline void Boolean<Identifier>::assign(const Boolean<Identifier2>& rhs) noexcept
+template <typename Identifier, StorageMode storage>
+template <typename Identifier2, StorageMode storage2>
+inline void Boolean<Identifier, storage>::assign(const Boolean<Identifier2, storage2>& rhs) noexcept
 {
-    m_data.back() = rhs.m_data.back();
+    if constexpr (storage == storage2)
+    {
+        m_data.back() = rhs.m_data.back();
+    }
+    else
+    {
+        assign(rhs.value());
+    }
 }
 
-template <typename Identifier>
-constexpr size_t Boolean<Identifier>::encoded_length() noexcept
+template <typename Identifier, StorageMode storage>
+constexpr size_t Boolean<Identifier, storage>::encoded_length() noexcept
 {
     return fast_ber::encoded_length(1, Identifier{});
 }
 
-template <typename Identifier>
-EncodeResult Boolean<Identifier>::encode(std::span<uint8_t> output) const noexcept
+template <typename Identifier, StorageMode storage>
+EncodeResult Boolean<Identifier, storage>::encode(std::span<uint8_t> output) const noexcept
 {
     if (output.size() < this->ber().size())
     {
@@ -107,12 +163,12 @@ EncodeResult Boolean<Identifier>::encode(std::span<uint8_t> output) const noexce
     return EncodeResult{true, this->ber().size()};
 }
 
-template <typename Identifier>
-DecodeResult Boolean<Identifier>::decode(BerView input) noexcept
+template <typename Identifier, StorageMode storage>
+DecodeResult Boolean<Identifier, storage>::decode(BerView input) noexcept
 {
     if (!has_correct_header(input, Identifier{}, Construction::primitive))
     {
-        return DecodeResult{false};
+        return DecodeResult{false, DecodeError::invalid_header};
     }
 
     if (Identifier::depth() == 1 && input.content_length() == 1)
@@ -125,23 +181,54 @@ DecodeResult Boolean<Identifier>::decode(BerView input) noexcept
         m_data.back() = *input.begin()->content_data();
         return DecodeResult{true};
     }
-    return DecodeResult{false};
+    return DecodeResult{false, DecodeError::invalid_content};
+}
+
+template <typename Identifier>
+EncodeResult Boolean<Identifier, StorageMode::native>::encode(std::span<uint8_t> output) const noexcept
+{
+    constexpr size_t length = encoded_length();
+    if (output.size() < length)
+    {
+        return EncodeResult{false, 0};
+    }
+
+    encode_header(output, 1, Identifier{}, Construction::primitive);
+    output[length - 1] = static_cast<uint8_t>(m_value ? 0xFF : 0x00);
+    return EncodeResult{true, length};
+}
+
+template <typename Identifier>
+DecodeResult Boolean<Identifier, StorageMode::native>::decode(BerView input) noexcept
+{
+    if (!has_correct_header(input, Identifier{}, Construction::primitive))
+    {
+        return DecodeResult{false, DecodeError::invalid_header};
+    }
+
+    const BerView content_view = (Identifier::depth() == 1) ? input : *input.begin();
+    if (content_view.content_length() != 1)
+    {
+        return DecodeResult{false, DecodeError::invalid_content};
+    }
+    m_value = *content_view.content_data() != 0x00;
+    return DecodeResult{true};
 }
 
-template <typename Identifier1, typename Identifier2>
-bool operator==(const Boolean<Identifier1>& lhs, const Boolean<Identifier2>& rhs) noexcept
+template <typename Identifier1, StorageMode storage1, typename Identifier2, StorageMode storage2>
+bool operator==(const Boolean<Identifier1, storage1>& lhs, const Boolean<Identifier2, storage2>& rhs) noexcept
 {
     return lhs.value() == rhs.value();
 }
 
-template <typename Identifier1, typename Identifier2>
-bool operator!=(const Boolean<Identifier1>& lhs, const Boolean<Identifier2>& rhs) noexcept
+template <typename Identifier1, StorageMode storage1, typename Identifier2, StorageMode storage2>
+bool operator!=(const Boolean<Identifier1, storage1>& lhs, const Boolean<Identifier2, storage2>& rhs) noexcept
 {
     return !(lhs == rhs);
 }
 
-template <typename Identifier>
-std::ostream& operator<<(std::ostream& os, const Boolean<Identifier>& object)
+template <typename Identifier, StorageMode storage>
+std::ostream& operator<<(std::ostream& os, const Boolean<Identifier, storage>& object)
 {
     if (object)
     {
@@ -5,6 +5,6 @@
 
 namespace fast_ber
 {
-template <typename Identifier = ExplicitId<UniversalTag::character_string>>
-using CharacterString = fast_ber::StringImpl<UniversalTag::character_string, Identifier>;
+template <typename Identifier = ExplicitId<UniversalTag::character_string>, StorageMode storage = StorageMode::dynamic>
+using CharacterString = fast_ber::StringImpl<UniversalTag::character_string, Identifier, storage>;
 }
@@ -9,6 +9,7 @@
 #include "fast_ber/util/DecodeHelpers.hpp"
 #include "fast_ber/util/DynamicVariant.hpp"
 #include "fast_ber/util/EncodeHelpers.hpp"
+#include "fast_ber/util/GatherBuffer.hpp"
 
 #include <iosfwd>
 #include <tuple>
@@ -46,6 +47,34 @@ EncodeResult wrap_with_ber_header(std::span<uint8_t>, size_t, ChoiceId<Identifie
     return {};
 }
 
+template <typename... Identifiers>
+EncodeResult wrap_with_ber_header_reverse(std::span<uint8_t>, size_t, ChoiceId<Identifiers...>)
+{
+    assert(0);
+    return {};
+}
+
+template <typename... Identifiers>
+EncodeResult encode_gather_header(GatherBuffer&, size_t, ChoiceId<Identifiers...>)
+{
+    assert(0);
+    return {};
+}
+
+template <typename... Identifiers>
+EncodeResult encode_indefinite_header(std::span<uint8_t>, ChoiceId<Identifiers...>)
+{
+    assert(0);
+    return {};
+}
+
+template <typename... Identifiers>
+EncodeResult encode_end_of_contents(std::span<uint8_t>, ChoiceId<Identifiers...>)
+{
+    assert(0);
+    return {};
+}
+
 template <typename... Identifiers>
 bool has_correct_header(BerView, ChoiceId<Identifiers...>, Construction)
 {
@@ -449,6 +478,18 @@ struct Choice<Choices<Types...>, Identifier, storage>
         return m_base.template emplace<i>(il, std::forward<Args>(args)...);
     }
 
+    // Alternative i, constructed only if another alternative is held. Decoding reuses the held alternative, and any
+    // storage it owns, when the same alternative is decoded again
+    template <size_t i>
+    ToType<i>& emplace_or_reuse()
+    {
+        if (index() == i)
+        {
+            return *fast_ber::get_if<i>(this);
+        }
+        return emplace<i>();
+    }
+
     constexpr bool valueless_by_exception() const noexcept { return m_base.valueless_by_exception(); }
 
     constexpr std::size_t index() const noexcept { return m_base.index(); }
@@ -627,7 +668,7 @@ template <int index, int max_depth, typename... Variants, typename Identifier, S
 DecodeResult decode_if(BerView, Choice<Choices<Variants...>, Identifier, storage>&) noexcept
 {
     // No substitutions found, fail
-    return DecodeResult{false};
+    return DecodeResult{false, DecodeError::unknown_alternative};
 }
 
 template <size_t index, size_t max_depth, typename ID, typename... Variants, StorageMode storage,
@@ -638,7 +679,7 @@ DecodeResult decode_if(BerView input, Choice<Choices<Variants...>, ID, storage>&
 
     if (Identifier<T>::check_id_match(input.class_(), input.tag()))
     {
-        T& child = output.template emplace<index>();
+        T& child = output.template emplace_or_reuse<index>();
         return child.decode(input);
     }
     else
@@ -653,7 +694,7 @@ DecodeResult decode_impl(BerView input, Choice<Choices<Variants...>, Identifier,
 {
     if (!input.is_valid())
     {
-        return DecodeResult{false};
+        return DecodeResult{false, DecodeError::invalid_packet};
     }
 
     constexpr auto depth = sizeof...(Variants);
@@ -666,17 +707,22 @@ DecodeResult decode_impl(BerView input, Choice<Choices<Variants...>, Identifier,
 {
     if (!has_correct_header(input, Identifier{}, Construction::constructed))
     {
-        return DecodeResult{false};
+        return DecodeResult{false, DecodeError::invalid_header};
     }
 
     BerViewIterator child = (Identifier::depth() == 1) ? input.begin() : input.begin()->begin();
     if (!child->is_valid())
     {
-        return DecodeResult{false};
+        return DecodeResult{false, DecodeError::invalid_packet, decode_offset(offset_within(input, *child))};
     }
 
     constexpr auto depth = sizeof...(Variants);
-    return decode_if<0, depth>(*child, output);
+    DecodeResult   res   = decode_if<0, depth>(*child, output);
+    if (!res.success)
+    {
+        res.offset = decode_offset(res.offset + offset_within(input, *child));
+    }
+    return res;
 }
 
 template <typename... Variants, typename Identifier, StorageMode storage>
@@ -1,9 +1,69 @@
 #pragma once
 
-#include "fast_ber/ber_types/GeneralizedTime.hpp"
+#include "fast_ber/ber_types/Tag.hpp"
+#include "fast_ber/ber_types/TimeImpl.hpp"
 
 namespace fast_ber
 {
-template <typename Identifier = ExplicitId<UniversalTag::generalized_time>>
-using Date = GeneralizedTime<Identifier>;
+
+namespace detail
+{
+
+inline void write_date(std::chrono::sys_days days, char* output) noexcept
+{
+    const std::chrono::year_month_day date(days);
+    write_digits(output, static_cast<int>(date.year()), 4);
+    output[4] = '-';
+    write_digits(output + 5, static_cast<int>(static_cast<unsigned>(date.month())), 2);
+    output[7] = '-';
+    write_digits(output + 8, static_cast<int>(static_cast<unsigned>(date.day())), 2);
+}
+
+// Input must hold at least the 10 characters of YYYY-MM-DD
+inline bool read_date(const char* input, std::chrono::sys_days& days) noexcept
+{
+    int year  = 0;
+    int month = 0;
+    int day   = 0;
+    if (!read_digits(input, 4, year) || input[4] != '-' || !read_digits(input + 5, 2, month) || input[7] != '-' ||
+        !read_digits(input + 8, 2, day))
+    {
+        return false;
+    }
+    const std::chrono::year_month_day date(std::chrono::year(year), std::chrono::month(static_cast<unsigned>(month)),
+                                           std::chrono::day(static_cast<unsigned>(day)));
+    if (!date.ok())
+    {
+        return false;
+    }
+    days = std::chrono::sys_days(date);
+    return true;
+}
+
+// YYYY-MM-DD, with years limited to 0000-9999
+struct DateFormat
+{
+    using Value = std::chrono::sys_days;
+
+    static constexpr size_t max_length     = 10;
+    static constexpr bool   has_time_zone  = false;
+    static constexpr bool   has_local_time = false;
+
+    static size_t write(std::chrono::sys_days days, const TimeZone&, char* output) noexcept
+    {
+        write_date(std::chrono::floor<std::chrono::days>(clamp_years(days, 0, 9999)), output);
+        return max_length;
+    }
+
+    static bool read(std::string_view input, std::chrono::sys_days& days, TimeZone&) noexcept
+    {
+        return input.size() == max_length && read_date(input.data(), days);
+    }
+};
+
+} // namespace detail
+
+template <typename Identifier = ExplicitId<UniversalTag::date>>
+using Date = TimeImpl<detail::DateFormat, Identifier>;
+
 } // namespace fast_ber
@@ -1,10 +1,51 @@
 #pragma once
 
-#include "fast_ber/ber_types/GeneralizedTime.hpp"
+#include "fast_ber/ber_types/Date.hpp"
 #include "fast_ber/ber_types/Tag.hpp"
+#include "fast_ber/ber_types/TimeOfDay.hpp"
 
 namespace fast_ber
 {
-template <typename Identifier = ExplicitId<UniversalTag::generalized_time>>
-using DateTime = GeneralizedTime<Identifier>;
+
+namespace detail
+{
+
+// YYYY-MM-DDTHH:MM:SS, with years limited to 0000-9999
+struct DateTimeFormat
+{
+    using Value = std::chrono::sys_seconds;
+
+    static constexpr size_t max_length     = 19;
+    static constexpr bool   has_time_zone  = false;
+    static constexpr bool   has_local_time = false;
+
+    static size_t write(std::chrono::sys_seconds time, const TimeZone&, char* output) noexcept
+    {
+        const std::chrono::sys_seconds clamped = std::chrono::floor<std::chrono::seconds>(clamp_years(time, 0, 9999));
+        const std::chrono::sys_days    days    = std::chrono::floor<std::chrono::days>(clamped);
+        write_date(days, output);
+        output[10] = 'T';
+        write_time_of_day(clamped - days, output + 11);
+        return max_length;
+    }
+
+    static bool read(std::string_view input, std::chrono::sys_seconds& time, TimeZone&) noexcept
+    {
+        std::chrono::sys_days days;
+        std::chrono::seconds  time_of_day;
+        if (input.size() != max_length || !read_date(input.data(), days) || input[10] != 'T' ||
+            !read_time_of_day(input.data() + 11, time_of_day))
+        {
+            return false;
+        }
+        time = days + time_of_day;
+        return true;
+    }
+};
+
+} // namespace detail
+
+template <typename Identifier = ExplicitId<UniversalTag::date_time>>
+using DateTime = TimeImpl<detail::DateTimeFormat, Identifier>;
+
 } // namespace fast_ber
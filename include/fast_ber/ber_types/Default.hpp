@@ -2,6 +2,7 @@
 
 #include "fast_ber/util/DecodeHelpers.hpp"
 #include "fast_ber/util/EncodeHelpers.hpp"
+#include "fast_ber/util/GatherBuffer.hpp"
 
 #include <string_view>
 #include <optional>
@@ -47,6 +48,9 @@ struct Default
 
     size_t       encoded_length() const noexcept;
     EncodeResult encode(std::span<uint8_t> buffer) const noexcept;
+    EncodeResult encode_reverse(std::span<uint8_t> buffer) const noexcept;
+    EncodeResult encode_indefinite(std::span<uint8_t> buffer) const noexcept;
+    EncodeResult encode_gather(GatherBuffer& output) const noexcept;
     DecodeResult decode(BerView input) noexcept;
 
   private:
@@ -147,6 +151,45 @@ EncodeResult Default<T, DefaultValue>::encode(std::span<uint8_t> buffer) const n
     }
 }
 
+template <typename T, typename DefaultValue>
+EncodeResult Default<T, DefaultValue>::encode_reverse(std::span<uint8_t> buffer) const noexcept
+{
+    if (is_default())
+    {
+        return {true, 0};
+    }
+    else
+    {
+        return fast_ber::encode_reverse(buffer, *m_item);
+    }
+}
+
+template <typename T, typename DefaultValue>
+EncodeResult Default<T, DefaultValue>::encode_indefinite(std::span<uint8_t> buffer) const noexcept
+{
+    if (is_default())
+    {
+        return {true, 0};
+    }
+    else
+    {
+        return fast_ber::encode_indefinite(buffer, *m_item);
+    }
+}
+
+template <typename T, typename DefaultValue>
+EncodeResult Default<T, DefaultValue>::encode_gather(GatherBuffer& output) const noexcept
+{
+    if (is_default())
+    {
+        return {true, 0};
+    }
+    else
+    {
+        return fast_ber::encode_gather(output, *m_item);
+    }
+}
+
 template <typename T, typename DefaultValue>
 DecodeResult Default<T, DefaultValue>::decode(BerView input) noexcept
 {
@@ -162,7 +205,7 @@ DecodeResult Default<T, DefaultValue>::decode(BerView input) noexcept
     }
     else
     {
-        return DecodeResult{false};
+        return DecodeResult{false, DecodeError::invalid_header};
     }
 }
 
@@ -7,7 +7,9 @@
 namespace fast_ber
 {
 
-template <typename EnumeratedType, typename Identifier = ExplicitId<UniversalTag::enumerated>>
+// Enumerated value, stored as an Integer with the given storage mode
+template <typename EnumeratedType, typename Identifier = ExplicitId<UniversalTag::enumerated>,
+          StorageMode storage = StorageMode::static_>
 class Enumerated
 {
   public:
@@ -15,8 +17,8 @@ class Enumerated
 
     Enumerated() noexcept : m_val() {}
     Enumerated(EnumeratedType val) noexcept { assign(val); }
-    template <typename Identifier2>
-    Enumerated(const Enumerated<EnumeratedType, Identifier2>& rhs) noexcept
+    template <typename Identifier2, StorageMode storage2>
+    Enumerated(const Enumerated<EnumeratedType, Identifier2, storage2>& rhs) noexcept
     {
         assign(rhs);
     }
@@ -26,22 +28,22 @@ class Enumerated
 
     EnumeratedType value() const noexcept { return static_cast<EnumeratedType>(m_val.value()); }
 
-    template <typename Identifier2>
-    Enumerated& operator=(const Enumerated<EnumeratedType, Identifier2>& rhs) noexcept;
+    template <typename Identifier2, StorageMode storage2>
+    Enumerated& operator=(const Enumerated<EnumeratedType, Identifier2, storage2>& rhs) noexcept;
     Enumerated& operator=(EnumeratedType rhs) noexcept
     {
         assign(rhs);
         return *this;
     }
 
-    template <typename Identifier2>
-    bool operator==(const Enumerated<EnumeratedType, Identifier2>& rhs) const
+    template <typename Identifier2, StorageMode storage2>
+    bool operator==(const Enumerated<EnumeratedType, Identifier2, storage2>& rhs) const
     {
         return this->value() == rhs.value();
     }
 
-    template <typename Identifier2>
-    bool operator!=(const Enumerated<EnumeratedType, Identifier2>& rhs) const
+    template <typename Identifier2, StorageMode storage2>
+    bool operator!=(const Enumerated<EnumeratedType, Identifier2, storage2>& rhs) const
     {
         return !(*this == rhs);
     }
@@ -49,8 +51,8 @@ class Enumerated
     bool operator==(EnumeratedType rhs) const noexcept { return this->value() == rhs; }
     bool operator!=(EnumeratedType rhs) const noexcept { return !(*this == rhs); }
 
-    template <typename Identifier2>
-    void assign(const Enumerated<EnumeratedType, Identifier2>& rhs) noexcept
+    template <typename Identifier2, StorageMode storage2>
+    void assign(const Enumerated<EnumeratedType, Identifier2, storage2>& rhs) noexcept
     {
         m_val.assign(rhs.m_val);
     }
@@ -58,7 +60,7 @@ class Enumerated
 
     using AsnId = Identifier;
 
-    template <typename EnumeratedType2, typename Identifier2>
+    template <typename EnumeratedType2, typename Identifier2, StorageMode storage2>
     friend class Enumerated;
 
     size_t       encoded_length() const noexcept;
@@ -66,35 +68,35 @@ class Enumerated
     DecodeResult decode(BerView input) noexcept;
 
   private:
-    Integer<Identifier> m_val;
+    Integer<Identifier, storage> m_val;
 };
 
-template <typename EnumeratedType, typename Identifier>
-size_t Enumerated<EnumeratedType, Identifier>::encoded_length() const noexcept
+template <typename EnumeratedType, typename Identifier, StorageMode storage>
+size_t Enumerated<EnumeratedType, Identifier, storage>::encoded_length() const noexcept
 {
     return this->m_val.encoded_length();
 }
 
-template <typename EnumeratedType, typename Identifier>
-EncodeResult Enumerated<EnumeratedType, Identifier>::encode(std::span<uint8_t> output) const noexcept
+template <typename EnumeratedType, typename Identifier, StorageMode storage>
+EncodeResult Enumerated<EnumeratedType, Identifier, storage>::encode(std::span<uint8_t> output) const noexcept
 {
     return this->m_val.encode(output);
 }
 
-template <typename EnumeratedType, typename Identifier>
-DecodeResult Enumerated<EnumeratedType, Identifier>::decode(BerView input) noexcept
+template <typename EnumeratedType, typename Identifier, StorageMode storage>
+DecodeResult Enumerated<EnumeratedType, Identifier, storage>::decode(BerView input) noexcept
 {
     return this->m_val.decode(input);
 }
 
-template <typename EnumeratedType, typename Identifier>
-const char* to_string(const Enumerated<EnumeratedType, Identifier>& obj)
+template <typename EnumeratedType, typename Identifier, StorageMode storage>
+const char* to_string(const Enumerated<EnumeratedType, Identifier, storage>& obj)
 {
     return to_string(obj.value());
 }
 
-template <typename EnumeratedType, typename Identifier>
-std::ostream& operator<<(std::ostream& os, const Enumerated<EnumeratedType, Identifier>& obj) noexcept
+template <typename EnumeratedType, typename Identifier, StorageMode storage>
+std::ostream& operator<<(std::ostream& os, const Enumerated<EnumeratedType, Identifier, storage>& obj) noexcept
 {
     return os << '"' << obj.value() << '"';
 }
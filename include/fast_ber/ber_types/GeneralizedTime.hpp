@@ -1,206 +1,93 @@
 #pragma once
 
-#include "fast_ber/util/DecodeHelpers.hpp"
-#include "fast_ber/util/EncodeHelpers.hpp"
-#include "fast_ber/util/FixedIdBerContainer.hpp"
-
-#include <boost/date_time.hpp>
-#include <boost/locale.hpp>
+#include "fast_ber/ber_types/TimeImpl.hpp"
 
 namespace fast_ber
 {
-constexpr const int minimum_timestamp_length = 10;
-constexpr const int max_timestamp_length     = 23;
-
-const std::string g_local_time_format                    = "%E4Y%m%d%H%M%S";
-const std::string g_universal_time_format                = "%E4Y%m%d%H%M%SZ";
-const std::string g_universal_time_with_time_zone_format = "%E4Y%m%d%H%M%S";
-
-template <typename Identifier = ExplicitId<UniversalTag::generalized_time>>
-class GeneralizedTime
-{
-  public:
-    enum class TimeFormat
-    {
-        universal,
-        universal_with_timezone,
-        local
-    };
-
-    void set_time(const boost::local_time::local_date_time& cs);
-    void set_time(const boost::posix_time::ptime& time);
-    void set_time(const boost::posix_time::ptime& time, int timezone_offset_minutes);
-
-    boost::posix_time::ptime  time() const;
-    std::string string() const;
-    TimeFormat  format() const;
-
-    GeneralizedTime() noexcept { set_time(boost::posix_time::ptime()); }
-    GeneralizedTime(const GeneralizedTime&)     = default;
-    GeneralizedTime(GeneralizedTime&&) noexcept = default;
-    GeneralizedTime(const boost::posix_time::ptime& time) { set_time(time); }
-    explicit GeneralizedTime(BerView view) { decode(view); }
-    ~GeneralizedTime() noexcept = default;
-
-    GeneralizedTime& operator=(const GeneralizedTime&) = default;
-    GeneralizedTime& operator=(GeneralizedTime&&) noexcept = default;
-
-    size_t       encoded_length() const noexcept;
-    EncodeResult encode(std::span<uint8_t> buffer) const noexcept;
-    DecodeResult decode(BerView buffer) noexcept;
-
-    using AsnId = Identifier;
-
-  private:
-    FixedIdBerContainer<Identifier> m_contents;
-};
 
-template <typename Identifier>
-bool operator==(const GeneralizedTime<Identifier>& lhs, const GeneralizedTime<Identifier>& rhs)
+namespace detail
 {
-    return lhs.time() == rhs.time();
-}
 
-template <typename Identifier>
-bool operator!=(const GeneralizedTime<Identifier>& lhs, const GeneralizedTime<Identifier>& rhs)
+// YYYYMMDDHH[MM[SS]][(.|,)fraction][Z|(+|-)hh[mm]]. Written with seconds, the fraction only when it is non zero, and
+// years limited to 0000-9999
+struct GeneralizedTimeFormat
 {
-    return !(lhs == rhs);
-}
-
-template <typename Identifier>
-void GeneralizedTime<Identifier>::set_time(const boost::posix_time::ptime& time)
-{
-    std::ostringstream       ss;
-    
-    // assumes std::cout's locale has been set appropriately for the entire app
-    ss.imbue(std::locale(std::cout.getloc(), new boost::posix_time::time_facet(g_universal_time_format.c_str())));
-    ss << time;
-
-    std::string time_str = ss.str();
-
-    m_contents.assign_content(
-        std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(time_str.data()), time_str.length()));
-}
-
-template <typename Identifier>
-void GeneralizedTime<Identifier>::set_time(const boost::local_time::local_date_time& cs)
-{
-    std::ostringstream ss;
-
-    // assumes std::cout's locale has been set appropriately for the entire app
-    ss.imbue(std::locale(std::cout.getloc(), new boost::posix_time::time_facet(g_local_time_format.c_str())));
-    ss << cs.local_time();
-
-    std::string time_str = ss.str();
-
-    m_contents.assign_content(
-        std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(time_str.data()), time_str.length()));
-}
-
-template <typename Identifier>
-void GeneralizedTime<Identifier>::set_time(const boost::posix_time::ptime& time, int timezone_offset_minutes)
-{
-    std::ostringstream ss;
-
-    // assumes std::cout's locale has been set appropriately for the entire app
-    ss.imbue(std::locale(std::cout.getloc(), new boost::posix_time::time_facet(g_universal_time_with_time_zone_format.c_str())));
-    ss << time;
-
-    std::string time_str = ss.str();
+    using Value = TimePoint;
 
+    static constexpr size_t max_length     = 26; // YYYYMMDDHHMMSS.ffffff+hhmm
+    static constexpr bool   has_time_zone  = true;
+    static constexpr bool   has_local_time = true;
+    static constexpr bool   hour_offsets   = true;
 
-    std::string timezone_extension = std::string(5, '\0');
-    snprintf(&timezone_extension[0], timezone_extension.length() + 1,
-             "%c%2.2d%2.2d", // NOLINT(cppcoreguidelines-pro-type-vararg)
-             (timezone_offset_minutes >= 0) ? '+' : '-', std::abs(timezone_offset_minutes) / 60,
-             std::abs(timezone_offset_minutes) % 60);
-    time_str += timezone_extension;
-
-    m_contents.assign_content(
-        std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(time_str.data()), time_str.length()));
-}
-
-template <typename Identifier>
-typename GeneralizedTime<Identifier>::TimeFormat GeneralizedTime<Identifier>::format() const
-{
-    if (m_contents.content().back() == 'Z')
-    {
-        return TimeFormat::universal;
-    }
-    else if ((m_contents.content()[m_contents.content_length() - 5] == '-') ||
-             (m_contents.content()[m_contents.content_length() - 5] == '+'))
-    {
-        return TimeFormat::universal_with_timezone;
-    }
-    else
+    static size_t write(TimePoint time, const TimeZone& zone, char* output) noexcept
     {
-        return TimeFormat::local;
+        const CivilTime civil = to_civil(clamp_years(time + std::chrono::minutes(zone.offset_minutes), 0, 9999));
+        write_digits(output, civil.year, 4);
+        write_digits(output + 4, civil.month, 2);
+        write_digits(output + 6, civil.day, 2);
+        write_digits(output + 8, civil.hour, 2);
+        write_digits(output + 10, civil.minute, 2);
+        write_digits(output + 12, civil.second, 2);
+        const size_t length = 14 + write_fraction(output + 14, civil.microsecond);
+        return length + write_time_zone(output + length, zone);
     }
-}
-
-template <typename Identifier>
-boost::posix_time::ptime GeneralizedTime<Identifier>::time() const
-{
-    thread_local std::string s_error_string;
-    boost::posix_time::ptime               time;
-    const TimeFormat         frmt = format();
-
-    if (frmt == TimeFormat::universal)
-    {
-        std::istringstream  iss(this->string());
-        iss.imbue(std::locale(std::locale::classic(), new boost::posix_time::time_input_facet(g_universal_time_format.c_str())));
-        iss >> time;
-    }
-    else if (frmt == TimeFormat::universal_with_timezone)
-    {
-        const auto& time_str = this->string();
 
-        std::istringstream iss(time_str.substr(0, time_str.length() - 5));
-        iss.imbue(std::locale(std::locale::classic(), new boost::posix_time::time_input_facet(g_universal_time_with_time_zone_format.c_str())));
-        iss >> time;
-    }
-    else if (frmt == TimeFormat::local)
+    static bool read(std::string_view input, TimePoint& time, TimeZone& zone) noexcept
     {
-        std::istringstream iss(this->string());
-        iss.imbue(std::locale(std::locale::classic(), new boost::posix_time::time_input_facet(g_local_time_format.c_str())));
-        iss >> time;
+        const char*       position = input.data();
+        const char* const end      = position + input.size();
+
+        CivilTime civil;
+        if (input.size() < 10 || !read_digits(position, 4, civil.year) || !read_digits(position + 4, 2, civil.month) ||
+            !read_digits(position + 6, 2, civil.day) || !read_digits(position + 8, 2, civil.hour))
+        {
+            return false;
+        }
+        position += 10;
+
+        // A fraction is of the last unit present
+        int64_t unit_microseconds = int64_t{3600} * 1000000;
+        if (end - position >= 2 && is_digit(*position))
+        {
+            if (!read_digits(position, 2, civil.minute))
+            {
+                return false;
+            }
+            position += 2;
+            unit_microseconds = int64_t{60} * 1000000;
+            if (end - position >= 2 && is_digit(*position))
+            {
+                if (!read_digits(position, 2, civil.second))
+                {
+                    return false;
+                }
+                position += 2;
+                unit_microseconds = 1000000;
+            }
+        }
+
+        int64_t fraction = 0;
+        if (position != end && (*position == '.' || *position == ','))
+        {
+            position = read_fraction(position + 1, end, unit_microseconds, fraction);
+            if (position == nullptr)
+            {
+                return false;
+            }
+        }
+
+        if (!read_time_zone(position, end, zone, hour_offsets) || !from_civil(civil, time))
+        {
+            return false;
+        }
+        time += std::chrono::microseconds(fraction) - std::chrono::minutes(zone.offset_minutes);
+        return true;
     }
-    return time;
-}
-
-template <typename Identifier>
-std::string GeneralizedTime<Identifier>::string() const
-{
-    return std::string(reinterpret_cast<const char*>(m_contents.content_data()), m_contents.content_length());
-}
-
-template <typename Identifier>
-size_t GeneralizedTime<Identifier>::encoded_length() const noexcept
-{
-    return this->m_contents.ber().size();
-}
-
-template <typename Identifier>
-EncodeResult GeneralizedTime<Identifier>::encode(std::span<uint8_t> output) const noexcept
-{
-    return this->m_contents.encode(output);
-}
+};
 
-template <typename Identifier>
-DecodeResult GeneralizedTime<Identifier>::decode(BerView view) noexcept
-{
-    DecodeResult res = m_contents.decode(view);
-    if (m_contents.content_length() < minimum_timestamp_length || m_contents.content_length() > max_timestamp_length)
-    {
-        return DecodeResult{false};
-    }
-    return res;
-}
+} // namespace detail
 
-template <typename Identifier>
-std::ostream& operator<<(std::ostream& os, const GeneralizedTime<Identifier>& time)
-{
-    return os << time.time();
-}
+template <typename Identifier = ExplicitId<UniversalTag::generalized_time>>
+using GeneralizedTime = TimeImpl<detail::GeneralizedTimeFormat, Identifier>;
 
 } // namespace fast_ber
@@ -5,6 +5,6 @@
 
 namespace fast_ber
 {
-template <typename Identifier = ExplicitId<UniversalTag::ia5_string>>
-using IA5String = fast_ber::StringImpl<UniversalTag::ia5_string, Identifier>;
+template <typename Identifier = ExplicitId<UniversalTag::ia5_string>, StorageMode storage = StorageMode::dynamic>
+using IA5String = fast_ber::StringImpl<UniversalTag::ia5_string, Identifier, storage>;
 }
@@ -5,6 +5,6 @@
 
 namespace fast_ber
 {
-template <typename Identifier = ExplicitId<UniversalTag::iso646_string>>
-using ISO646String = fast_ber::StringImpl<UniversalTag::iso646_string, Identifier>;
+template <typename Identifier = ExplicitId<UniversalTag::iso646_string>, StorageMode storage = StorageMode::dynamic>
+using ISO646String = fast_ber::StringImpl<UniversalTag::iso646_string, Identifier, storage>;
 }
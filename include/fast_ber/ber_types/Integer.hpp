@@ -5,6 +5,7 @@
 #include "fast_ber/ber_types/Construction.hpp"
 #include "fast_ber/util/BerView.hpp"
 #include "fast_ber/util/DecodeHelpers.hpp"
+#include "fast_ber/util/Definitions.hpp"
 #include "fast_ber/util/EncodeHelpers.hpp"
 #include "fast_ber/util/EncodeIdentifiers.hpp"
 #include "fast_ber/util/Extract.hpp"
@@ -12,18 +13,23 @@
 
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <cstdint>
 #include <cstring>
 #include <iosfwd>
 #include <limits>
+#include <type_traits>
 
 namespace fast_ber
 {
 
 inline bool   decode_integer(std::span<const uint8_t> input, int64_t& output) noexcept;
 inline size_t encode_integer(std::span<uint8_t> output, int64_t input) noexcept;
+inline size_t encoded_integer_length(int64_t input) noexcept;
 
-template <typename Identifier = ExplicitId<UniversalTag::integer>>
+// Integer stored ber encoded, value() decodes the stored content. StorageMode::native stores the value instead, and
+// only produces the encoding when encoded
+template <typename Identifier = ExplicitId<UniversalTag::integer>, StorageMode storage = StorageMode::static_>
 class Integer
 {
     static constexpr uint8_t zero_ = 0x00;
@@ -34,22 +40,27 @@ class Integer
     Integer(int64_t num) noexcept { assign(num); }
     Integer(BerView view) noexcept { decode(view); }
     template <typename Identifier2>
-    Integer(const Integer<Identifier2>& rhs) noexcept;
+    Integer(const Integer<Identifier2, storage>& rhs) noexcept;
+    template <typename Identifier2, StorageMode storage2, typename = std::enable_if_t<storage != storage2>>
+    Integer(const Integer<Identifier2, storage2>& rhs) noexcept
+    {
+        assign(rhs.value());
+    }
 
     int64_t value() const noexcept;
 
     Integer& operator=(int64_t rhs) noexcept;
-    template <typename Identifier2>
-    Integer<Identifier>& operator=(const Integer<Identifier2>& rhs) noexcept;
+    template <typename Identifier2, StorageMode storage2>
+    Integer& operator=(const Integer<Identifier2, storage2>& rhs) noexcept;
 
-    template <typename Identifier2>
-    bool operator==(const Integer<Identifier2>& rhs) const noexcept
+    template <typename Identifier2, StorageMode storage2>
+    bool operator==(const Integer<Identifier2, storage2>& rhs) const noexcept
     {
         return this->value() == rhs.value();
     }
 
-    template <typename Identifier2>
-    bool operator!=(const Integer<Identifier2>& rhs) const noexcept
+    template <typename Identifier2, StorageMode storage2>
+    bool operator!=(const Integer<Identifier2, storage2>& rhs) const noexcept
     {
         return !(*this == rhs);
     }
@@ -61,141 +72,263 @@ class Integer
 
     void assign(int64_t val) noexcept;
 
-    template <typename Identifier2>
-    void assign(const Integer<Identifier2>& rhs) noexcept;
+    template <typename Identifier2, StorageMode storage2>
+    void assign(const Integer<Identifier2, storage2>& rhs) noexcept;
 
     size_t       encoded_length() const noexcept { return m_contents.ber_length(); }
     EncodeResult encode(std::span<uint8_t> buffer) const noexcept { return m_contents.encode(buffer); }
     DecodeResult decode(BerView rhs) noexcept { return m_contents.decode(rhs); }
 
-    template <typename Identifier2>
+    template <typename Identifier2, StorageMode storage2>
     friend class Integer;
 
   private:
     SmallFixedIdBerContainer<Identifier, sizeof(int64_t)> m_contents;
 };
 
-inline bool decode_integer(std::span<const uint8_t> input, int64_t& output) noexcept
+template <typename Identifier>
+class Integer<Identifier, StorageMode::native>
 {
-    if (input.size() == 0 || input.size() > 8)
+  public:
+    Integer() noexcept = default;
+    Integer(int64_t num) noexcept : m_value(num) {}
+    Integer(BerView view) noexcept { decode(view); }
+    template <typename Identifier2, StorageMode storage2>
+    Integer(const Integer<Identifier2, storage2>& rhs) noexcept : m_value(rhs.value())
     {
-        return false;
     }
 
-    if (input[0] & 0x80)
+    int64_t value() const noexcept { return m_value; }
+
+    Integer& operator=(int64_t rhs) noexcept
     {
-        output = -1;
+        assign(rhs);
+        return *this;
     }
-    else
+    template <typename Identifier2, StorageMode storage2>
+    Integer& operator=(const Integer<Identifier2, storage2>& rhs) noexcept
     {
-        output = 0;
+        assign(rhs.value());
+        return *this;
     }
 
-    std::array<uint8_t, sizeof(int64_t)> buffer{};
-    const auto                           offset = sizeof(int64_t) - input.size();
-    memcpy(buffer.data(), &output, sizeof(int64_t));
-    for (size_t i = 0; i < input.size(); i++)
+    template <typename Identifier2, StorageMode storage2>
+    bool operator==(const Integer<Identifier2, storage2>& rhs) const noexcept
     {
-        buffer[7 - (offset + i)] = input[i];
+        return m_value == rhs.value();
     }
-    memcpy(&output, buffer.data(), sizeof(int64_t));
 
-    return true;
+    template <typename Identifier2, StorageMode storage2>
+    bool operator!=(const Integer<Identifier2, storage2>& rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+
+    bool operator==(int64_t rhs) const { return m_value == rhs; }
+    bool operator!=(int64_t rhs) const { return !(*this == rhs); }
+
+    using AsnId = Identifier;
+
+    void assign(int64_t val) noexcept { m_value = val; }
+
+    template <typename Identifier2, StorageMode storage2>
+    void assign(const Integer<Identifier2, storage2>& rhs) noexcept
+    {
+        m_value = rhs.value();
+    }
+
+    size_t       encoded_length() const noexcept;
+    EncodeResult encode(std::span<uint8_t> buffer) const noexcept;
+    DecodeResult decode(BerView input) noexcept;
+
+  private:
+    int64_t m_value = 0;
+};
+
+namespace detail
+{
+
+// Conversion between native and big endian byte order. 32 bit words are widened, with their value unchanged
+constexpr uint64_t to_big_endian(uint64_t value) noexcept
+{
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        return std::byteswap(value);
+    }
+    else
+    {
+        return value;
+    }
 }
 
-inline size_t encode_integer(std::span<uint8_t> output, int64_t input) noexcept
+constexpr uint64_t to_big_endian(uint32_t value) noexcept
 {
-    std::array<uint8_t, sizeof(int64_t)> buffer{};
-    std::memcpy(buffer.data(), &input, sizeof(int64_t));
-    std::reverse(buffer.begin(), buffer.end());
+    if constexpr (std::endian::native == std::endian::little)
+    {
+        return std::byteswap(value);
+    }
+    else
+    {
+        return value;
+    }
+}
 
-    size_t to_skip = 0;
-    for (size_t i = 0; i < sizeof(int64_t) - 1; i++)
+// Load 1 to 8 octets as a big endian word, with the first octet in the most significant byte. Four or more octets are
+// loaded as two overlapping 32 bit words, fewer as their first, middle and last octets, so that no more than the input
+// is read
+inline uint64_t load_big_endian(std::span<const uint8_t> input) noexcept
+{
+    const uint8_t* const data   = input.data();
+    const size_t         length = input.size();
+    const size_t         shift  = (sizeof(uint64_t) - length) * 8;
+    if (length >= 4)
     {
-        if (buffer[i] == 0 && !(buffer[i + 1] & 0x80))
-        {
-            to_skip++;
-        }
-        else
-        {
-            break;
-        }
+        uint32_t first = 0;
+        uint32_t last  = 0;
+        std::memcpy(&first, data, sizeof(uint32_t));
+        std::memcpy(&last, data + length - 4, sizeof(uint32_t));
+        return (to_big_endian(first) << 32) | (to_big_endian(last) << shift);
     }
+    return (uint64_t{data[0]} << 56) | (uint64_t{data[length / 2]} << (56 - (length / 2) * 8)) |
+           (uint64_t{data[length - 1]} << shift);
+}
+
+} // namespace detail
 
-    for (size_t i = 0; i < sizeof(int64_t) - 1; i++)
+// The content octets are loaded into the most significant bytes of a word, and sign extended into place with an
+// arithmetic shift
+inline bool decode_integer(std::span<const uint8_t> input, int64_t& output) noexcept
+{
+    if (input.size() == 0 || input.size() > sizeof(int64_t))
     {
-        if (buffer[i] == 0xFF && (buffer[i + 1] & 0x80))
-        {
-            to_skip++;
-        }
-        else
-        {
-            break;
-        }
+        return false;
     }
 
-    size_t encoded_len = sizeof(int64_t) - to_skip;
+    output = static_cast<int64_t>(detail::load_big_endian(input)) >> ((sizeof(int64_t) - input.size()) * 8);
+    return true;
+}
+
+// The value is shifted so that its minimal encoding fills the most significant bytes of a word, which are then
+// written in big endian order
+inline size_t encode_integer(std::span<uint8_t> output, int64_t input) noexcept
+{
+    const size_t encoded_len = encoded_integer_length(input);
     if (output.size() < encoded_len)
     {
         return 0;
     }
 
-    std::memcpy(output.data(), buffer.data() + to_skip, encoded_len);
+    const uint64_t word = detail::to_big_endian(static_cast<uint64_t>(input) << ((sizeof(int64_t) - encoded_len) * 8));
+    std::memcpy(output.data(), &word, encoded_len);
     return encoded_len;
 }
 
-template <typename Identifier>
+// Number of content octets in the minimal two's complement encoding of the input, as written by encode_integer().
+// Flipping the bits of negative values turns redundant leading ones into zeros, leaving the significant bits
+// after the leading zeros, plus a sign bit
+inline size_t encoded_integer_length(int64_t input) noexcept
+{
+    const uint64_t magnitude = static_cast<uint64_t>(input ^ (input >> 63));
+    return static_cast<size_t>(72 - std::countl_zero(magnitude)) / 8;
+}
+
+template <typename Identifier, StorageMode storage>
 template <typename Identifier2>
-Integer<Identifier>::Integer(const Integer<Identifier2>& rhs) noexcept : m_contents(rhs.m_contents)
+Integer<Identifier, storage>::Integer(const Integer<Identifier2, storage>& rhs) noexcept : m_contents(rhs.m_contents)
 {
 }
 
-template <typename Identifier>
-inline int64_t Integer<Identifier>::value() const noexcept
+template <typename Identifier, StorageMode storage>
+inline int64_t Integer<Identifier, storage>::value() const noexcept
 {
     int64_t ret = 0;
     decode_integer(m_contents.content(), ret);
     return ret;
 }
 
-template <typename Identifier>
-inline Integer<Identifier>& Integer<Identifier>::operator=(int64_t rhs) noexcept
+template <typename Identifier, StorageMode storage>
+inline Integer<Identifier, storage>& Integer<Identifier, storage>::operator=(int64_t rhs) noexcept
 {
     assign(rhs);
     return *this;
 }
 
-template <typename Identifier>
-template <typename Identifier2>
-inline Integer<Identifier>& Integer<Identifier>::operator=(const Integer<Identifier2>& rhs) noexcept
+template <typename Identifier, StorageMode storage>
+template <typename Identifier2, StorageMode storage2>
+inline Integer<Identifier, storage>&
+Integer<Identifier, storage>::operator=(const Integer<Identifier2, storage2>& rhs) noexcept
 {
     assign(rhs);
     return *this;
 }
 
-template <typename Identifier>
-inline void Integer<Identifier>::assign(int64_t val) noexcept
+template <typename Identifier, StorageMode storage>
+inline void Integer<Identifier, storage>::assign(int64_t val) noexcept
 {
     m_contents.resize_content(encode_integer(std::span<uint8_t>(m_contents.content_data(), sizeof(int64_t)), val));
 }
 
+template <typename Identifier, StorageMode storage>
+template <typename Identifier2, StorageMode storage2>
+inline void Integer<Identifier, storage>::assign(const Integer<Identifier2, storage2>& rhs) noexcept
+{
+    if constexpr (storage == storage2)
+    {
+        m_contents = rhs.m_contents;
+    }
+    else
+    {
+        assign(rhs.value());
+    }
+}
+
 template <typename Identifier>
-template <typename Identifier2>
-inline void Integer<Identifier>::assign(const Integer<Identifier2>& rhs) noexcept
+size_t Integer<Identifier, StorageMode::native>::encoded_length() const noexcept
 {
-    m_contents = rhs.m_contents;
+    return fast_ber::encoded_length(encoded_integer_length(m_value), Identifier{});
+}
+
+template <typename Identifier>
+EncodeResult Integer<Identifier, StorageMode::native>::encode(std::span<uint8_t> buffer) const noexcept
+{
+    const size_t content_length = encoded_integer_length(m_value);
+    const size_t header_length  = encoded_header_length(content_length, Identifier{});
+    if (buffer.size() < header_length + content_length)
+    {
+        return EncodeResult{false, 0};
+    }
+
+    encode_header(buffer, content_length, Identifier{}, Construction::primitive);
+    encode_integer(buffer.subspan(header_length, content_length), m_value);
+    return EncodeResult{true, header_length + content_length};
 }
 
 template <typename Identifier>
-DecodeResult decode(BerViewIterator& input, Integer<Identifier>& output) noexcept
+DecodeResult Integer<Identifier, StorageMode::native>::decode(BerView input) noexcept
+{
+    if (!has_correct_header(input, Identifier{}, Construction::primitive))
+    {
+        return DecodeResult{false, DecodeError::invalid_header};
+    }
+
+    const BerView content_view = (Identifier::depth() == 1) ? input : *input.begin();
+    if (!decode_integer(content_view.content(), m_value))
+    {
+        return DecodeResult{false, DecodeError::invalid_content};
+    }
+    return DecodeResult{true};
+}
+
+template <typename Identifier, StorageMode storage>
+DecodeResult decode(BerViewIterator& input, Integer<Identifier, storage>& output) noexcept
 {
     DecodeResult res = output.decode(*input);
     ++input;
     return res;
 }
 
-template <typename Identifier>
-std::ostream& operator<<(std::ostream& os, const Integer<Identifier>& object) noexcept
+template <typename Identifier, StorageMode storage>
+std::ostream& operator<<(std::ostream& os, const Integer<Identifier, storage>& object) noexcept
 {
     return os << object.value();
 }
@@ -83,7 +83,7 @@ DecodeResult Null<Identifier>::decode(BerView input) noexcept
 {
     if (!has_correct_header(input, Identifier{}, Construction::primitive))
     {
-        return DecodeResult{false};
+        return DecodeResult{false, DecodeError::invalid_header};
     }
 
     if (Identifier::depth() == 1 && input.content_length() == 0)
@@ -94,7 +94,7 @@ DecodeResult Null<Identifier>::decode(BerView input) noexcept
     {
         return DecodeResult{true};
     }
-    return DecodeResult{false};
+    return DecodeResult{false, DecodeError::invalid_content};
 }
 
 template <typename Identifier>
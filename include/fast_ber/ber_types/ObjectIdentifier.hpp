@@ -3,19 +3,27 @@
 #include "fast_ber/util/DecodeHelpers.hpp"
 #include "fast_ber/util/EncodeHelpers.hpp"
 #include "fast_ber/util/FixedIdBerContainer.hpp"
+#include "fast_ber/util/SmallVector.hpp"
 
-#include <vector>
+#include <initializer_list>
 #include <span>
 
+#include <cstring>
+
 namespace fast_ber
 {
 
-using ObjectIdentifierComponents = std::vector<int64_t>;
+// Components of up to this many arcs are held without allocating, enough for the identifiers used by X.509 and LDAP
+constexpr size_t object_id_inline_components = 16;
+
+using ObjectIdentifierComponents = SmallVector<int64_t, object_id_inline_components>;
 
-size_t       encoded_object_id_length(const ObjectIdentifierComponents& input) noexcept;
-EncodeResult encode_object_id(std::span<uint8_t> output, const ObjectIdentifierComponents& input,
+size_t       encoded_object_id_length(std::span<const int64_t> input) noexcept;
+EncodeResult encode_object_id(std::span<uint8_t> output, std::span<const int64_t> input,
                               size_t encoded_length = 0) noexcept;
 DecodeResult decode_object_id(std::span<const uint8_t> input, ObjectIdentifierComponents& output) noexcept;
+// Compare encoded contents to components without decoding them into a container
+bool object_id_equals(std::span<const uint8_t> input, std::span<const int64_t> components) noexcept;
 // Return -1 on fail
 int64_t get_component_number(std::span<const uint8_t> input, size_t component_number) noexcept;
 size_t  get_number_of_components(std::span<const uint8_t> input) noexcept;
@@ -28,27 +36,31 @@ class ObjectIdentifier
     ObjectIdentifier(const ObjectIdentifier<Identifier>& rhs)     = default;
     ObjectIdentifier(ObjectIdentifier<Identifier>&& rhs) noexcept = default;
     ObjectIdentifier(const ObjectIdentifierComponents& oid) noexcept { assign(oid); }
-    ObjectIdentifier(const std::initializer_list<int64_t>& oid) noexcept { assign(ObjectIdentifierComponents(oid)); }
+    ObjectIdentifier(std::span<const int64_t> oid) noexcept { assign(oid); }
+    ObjectIdentifier(std::initializer_list<int64_t> oid) noexcept { assign(std::span(oid.begin(), oid.size())); }
     explicit ObjectIdentifier(BerView view) { decode(view); }
     ~ObjectIdentifier() noexcept = default;
 
-    ObjectIdentifier<Identifier>& operator=(const ObjectIdentifierComponents& rhs) noexcept;
+    ObjectIdentifier<Identifier>& operator=(std::span<const int64_t> rhs) noexcept;
     ObjectIdentifier&             operator=(const ObjectIdentifier&) = default;
     ObjectIdentifier&             operator=(ObjectIdentifier&&) noexcept = default;
 
+    // Identifiers are equal when their encoded contents are, whatever their tagging
     template <typename Identifier2>
     bool operator==(const ObjectIdentifier<Identifier2>& rhs) const noexcept;
     template <typename Identifier2>
     bool operator!=(const ObjectIdentifier<Identifier2>& rhs) const noexcept;
-    bool operator==(const ObjectIdentifierComponents& rhs) const noexcept { return this->value() == rhs; }
-    bool operator!=(const ObjectIdentifierComponents& rhs) const noexcept { return !(*this == rhs); }
+    bool operator==(std::span<const int64_t> rhs) const noexcept { return object_id_equals(content(), rhs); }
+    bool operator!=(std::span<const int64_t> rhs) const noexcept { return !(*this == rhs); }
 
     size_t  number_of_components() const noexcept;
     int64_t component_number(size_t number_of_component_to_extract) const noexcept;
 
     ObjectIdentifierComponents value() const noexcept;
+    // Encoded contents, suitable as a key for hashing or interning
+    std::span<const uint8_t> content() const noexcept { return m_contents.content(); }
 
-    bool assign(const ObjectIdentifierComponents& oid) noexcept;
+    bool assign(std::span<const int64_t> oid) noexcept;
 
     size_t       encoded_length() const noexcept;
     EncodeResult encode(std::span<uint8_t> buffer) const noexcept;
@@ -60,7 +72,7 @@ class ObjectIdentifier
     FixedIdBerContainer<Identifier> m_contents;
 };
 
-inline size_t encoded_object_id_length(const ObjectIdentifierComponents& input) noexcept
+inline size_t encoded_object_id_length(std::span<const int64_t> input) noexcept
 {
     if (input.size() < 2)
     {
@@ -80,7 +92,7 @@ inline size_t encoded_object_id_length(const ObjectIdentifierComponents& input)
     return output_size;
 }
 
-inline EncodeResult encode_object_id(std::span<uint8_t> output, const ObjectIdentifierComponents& input,
+inline EncodeResult encode_object_id(std::span<uint8_t> output, std::span<const int64_t> input,
                                      size_t encoded_length) noexcept
 {
     if (encoded_length == 0)
@@ -125,29 +137,23 @@ inline EncodeResult encode_object_id(std::span<uint8_t> output, const ObjectIden
     return EncodeResult{true, encoded_length};
 }
 
-inline DecodeResult decode_object_id(std::span<const uint8_t> input, std::vector<int64_t>& output) noexcept
+inline DecodeResult decode_object_id(std::span<const uint8_t> input, ObjectIdentifierComponents& output) noexcept
 {
-    if (!output.empty())
-    {
-        output.clear();
-    }
+    output.clear();
 
     if (input.empty())
     {
-        return DecodeResult{false};
+        return DecodeResult{false, DecodeError::invalid_content};
     }
 
     output.push_back(input[0] / 40);
     output.push_back(input[0] % 40);
 
-    for (size_t i = 1, current_num = 0; i < input.size(); i++)
+    int64_t current_num = 0;
+    for (size_t i = 1; i < input.size(); i++)
     {
-        current_num += 0x7F & input[i];
-        if (0x80 & input[i])
-        {
-            current_num *= 0x80;
-        }
-        else
+        current_num = (current_num << 7) | (0x7F & input[i]);
+        if (!(0x80 & input[i]))
         {
             output.push_back(current_num);
             current_num = 0;
@@ -157,6 +163,36 @@ inline DecodeResult decode_object_id(std::span<const uint8_t> input, std::vector
     return DecodeResult{true};
 }
 
+inline bool object_id_equals(std::span<const uint8_t> input, std::span<const int64_t> components) noexcept
+{
+    if (input.empty() || components.size() < 2)
+    {
+        return input.empty() && components.empty();
+    }
+    if (input[0] / 40 != components[0] || input[0] % 40 != components[1])
+    {
+        return false;
+    }
+
+    size_t  current_component_number = 2;
+    int64_t current_num              = 0;
+    for (size_t i = 1; i < input.size(); i++)
+    {
+        current_num = (current_num << 7) | (0x7F & input[i]);
+        if (!(0x80 & input[i]))
+        {
+            if (current_component_number == components.size() || components[current_component_number] != current_num)
+            {
+                return false;
+            }
+            current_component_number++;
+            current_num = 0;
+        }
+    }
+
+    return current_component_number == components.size();
+}
+
 inline int64_t get_component_number(std::span<const uint8_t> input, size_t number_of_component_to_extract) noexcept
 {
     if (input.empty())
@@ -170,24 +206,21 @@ inline int64_t get_component_number(std::span<const uint8_t> input, size_t numbe
     }
     if (number_of_component_to_extract == 1)
     {
-        return input[1] % 40;
+        return input[0] % 40;
     }
 
-    for (size_t i = 1, current_num = 0, current_component_number = 2; i < static_cast<size_t>(input.size()); i++)
+    int64_t current_num = 0;
+    for (size_t i = 1, current_component_number = 2; i < input.size(); i++)
     {
-        current_num += 0x7F & input[i];
-        if (0x80 & input[i])
-        {
-            current_num *= 0x80;
-        }
-        else
+        current_num = (current_num << 7) | (0x7F & input[i]);
+        if (!(0x80 & input[i]))
         {
-            current_num = 0;
             if (current_component_number == number_of_component_to_extract)
             {
                 return current_num;
             }
             current_component_number++;
+            current_num = 0;
         }
     }
 
@@ -214,7 +247,7 @@ inline size_t get_number_of_components(std::span<const uint8_t> input) noexcept
 }
 
 template <typename Identifier>
-ObjectIdentifier<Identifier>& ObjectIdentifier<Identifier>::operator=(const ObjectIdentifierComponents& rhs) noexcept
+ObjectIdentifier<Identifier>& ObjectIdentifier<Identifier>::operator=(std::span<const int64_t> rhs) noexcept
 {
     assign(rhs);
     return *this;
@@ -224,9 +257,10 @@ template <typename Identifier>
 template <typename Identifier2>
 bool ObjectIdentifier<Identifier>::operator==(const ObjectIdentifier<Identifier2>& rhs) const noexcept
 {
-    auto lhc = this->m_contents.content();
-    auto rhc = rhs.m_contents.content();
-    return std::equal(lhc.begin(), lhc.end(), rhc.begin(), rhc.end());
+    const std::span<const uint8_t> lhs_content = content();
+    const std::span<const uint8_t> rhs_content = rhs.content();
+    return lhs_content.size() == rhs_content.size() &&
+           std::memcmp(lhs_content.data(), rhs_content.data(), lhs_content.size()) == 0;
 }
 
 template <typename Identifier>
@@ -274,7 +308,7 @@ ObjectIdentifierComponents ObjectIdentifier<Identifier>::value() const noexcept
 }
 
 template <typename Identifier>
-bool ObjectIdentifier<Identifier>::assign(const ObjectIdentifierComponents& oid) noexcept
+bool ObjectIdentifier<Identifier>::assign(std::span<const int64_t> oid) noexcept
 {
     const size_t encoded_length = encoded_object_id_length(oid);
     m_contents.resize_content(encoded_length);
@@ -5,6 +5,6 @@
 
 namespace fast_ber
 {
-template <typename Identifier = ExplicitId<UniversalTag::octet_string>>
-using OctetString = fast_ber::StringImpl<UniversalTag::octet_string, Identifier>;
+template <typename Identifier = ExplicitId<UniversalTag::octet_string>, StorageMode storage = StorageMode::dynamic>
+using OctetString = fast_ber::StringImpl<UniversalTag::octet_string, Identifier, storage>;
 }
@@ -10,6 +10,7 @@
 #include "fast_ber/util/DecodeHelpers.hpp"
 #include "fast_ber/util/DynamicOptional.hpp"
 #include "fast_ber/util/EncodeHelpers.hpp"
+#include "fast_ber/util/GatherBuffer.hpp"
 
 namespace fast_ber
 {
@@ -51,8 +52,21 @@ struct Optional : public OptionalImplementation<T, storage>::Type
     Optional& operator                       =(Optional&& rhs) noexcept;
     ~Optional() noexcept                     = default;
 
+    // The held value, default constructed if empty. Decoding reuses the held value and any storage it owns
+    T& emplace_or_reuse()
+    {
+        if (!this->has_value())
+        {
+            this->emplace();
+        }
+        return **this;
+    }
+
     size_t       encoded_length() const noexcept;
     EncodeResult encode(std::span<uint8_t> buffer) const noexcept;
+    EncodeResult encode_reverse(std::span<uint8_t> buffer) const noexcept;
+    EncodeResult encode_indefinite(std::span<uint8_t> buffer) const noexcept;
+    EncodeResult encode_gather(GatherBuffer& output) const noexcept;
     DecodeResult decode(BerView input) noexcept;
 
     template <typename Identifier>
@@ -60,6 +74,12 @@ struct Optional : public OptionalImplementation<T, storage>::Type
     template <typename Identifier>
     EncodeResult encode_with_id(std::span<uint8_t> buffer) const noexcept;
     template <typename Identifier>
+    EncodeResult encode_reverse_with_id(std::span<uint8_t> buffer) const noexcept;
+    template <typename Identifier>
+    EncodeResult encode_indefinite_with_id(std::span<uint8_t> buffer) const noexcept;
+    template <typename Identifier>
+    EncodeResult encode_gather_with_id(GatherBuffer& output) const noexcept;
+    template <typename Identifier>
     DecodeResult decode_with_id(BerView input) noexcept;
 };
 
@@ -107,13 +127,51 @@ EncodeResult Optional<T, s1>::encode(std::span<uint8_t> buffer) const noexcept
     }
 }
 
+template <typename T, StorageMode s1>
+EncodeResult Optional<T, s1>::encode_reverse(std::span<uint8_t> buffer) const noexcept
+{
+    if (this->has_value())
+    {
+        return fast_ber::encode_reverse(buffer, **this);
+    }
+    else
+    {
+        return {true, 0};
+    }
+}
+
+template <typename T, StorageMode s1>
+EncodeResult Optional<T, s1>::encode_indefinite(std::span<uint8_t> buffer) const noexcept
+{
+    if (this->has_value())
+    {
+        return fast_ber::encode_indefinite(buffer, **this);
+    }
+    else
+    {
+        return {true, 0};
+    }
+}
+
+template <typename T, StorageMode s1>
+EncodeResult Optional<T, s1>::encode_gather(GatherBuffer& output) const noexcept
+{
+    if (this->has_value())
+    {
+        return fast_ber::encode_gather(output, **this);
+    }
+    else
+    {
+        return {true, 0};
+    }
+}
+
 template <typename T, StorageMode s1>
 DecodeResult decode(BerViewIterator& input, Optional<T, s1>& output) noexcept
 {
     if (input->is_valid() && Identifier<T>::check_id_match(input->class_(), input->tag()))
     {
-        output.emplace();
-        return decode(input, *output);
+        return decode(input, output.emplace_or_reuse());
     }
     else
     {
@@ -127,8 +185,7 @@ DecodeResult Optional<T, s1>::decode(BerView input) noexcept
 {
     if (input.is_valid() && Identifier<T>::check_id_match(input.class_(), input.tag()))
     {
-        this->emplace();
-        return (*this)->decode(input);
+        return emplace_or_reuse().decode(input);
     }
     else if (!input.is_valid())
     {
@@ -137,7 +194,7 @@ DecodeResult Optional<T, s1>::decode(BerView input) noexcept
     }
     else
     {
-        return DecodeResult{false};
+        return DecodeResult{false, DecodeError::invalid_header};
     }
 }
 
@@ -169,14 +226,55 @@ EncodeResult Optional<T, s1>::encode_with_id(std::span<uint8_t> buffer) const no
     }
 }
 
+template <typename T, StorageMode s1>
+template <typename Identifier>
+EncodeResult Optional<T, s1>::encode_reverse_with_id(std::span<uint8_t> buffer) const noexcept
+{
+    if (this->has_value())
+    {
+        return (*this)->template encode_reverse_with_id<Identifier>(buffer);
+    }
+    else
+    {
+        return {true, 0};
+    }
+}
+
+template <typename T, StorageMode s1>
+template <typename Identifier>
+EncodeResult Optional<T, s1>::encode_indefinite_with_id(std::span<uint8_t> buffer) const noexcept
+{
+    if (this->has_value())
+    {
+        return (*this)->template encode_indefinite_with_id<Identifier>(buffer);
+    }
+    else
+    {
+        return {true, 0};
+    }
+}
+
+template <typename T, StorageMode s1>
+template <typename Identifier>
+EncodeResult Optional<T, s1>::encode_gather_with_id(GatherBuffer& output) const noexcept
+{
+    if (this->has_value())
+    {
+        return (*this)->template encode_gather_with_id<Identifier>(output);
+    }
+    else
+    {
+        return {true, 0};
+    }
+}
+
 template <typename T, StorageMode s1>
 template <typename Identifier>
 DecodeResult Optional<T, s1>::decode_with_id(BerView input) noexcept
 {
     if (input.is_valid() && Identifier::check_id_match(input.class_(), input.tag()))
     {
-        this->emplace();
-        return (*this)->template decode_with_id<Identifier>(input);
+        return emplace_or_reuse().template decode_with_id<Identifier>(input);
     }
     else if (!input.is_valid())
     {
@@ -185,7 +283,7 @@ DecodeResult Optional<T, s1>::decode_with_id(BerView input) noexcept
     }
     else
     {
-        return DecodeResult{false};
+        return DecodeResult{false, DecodeError::invalid_header};
     }
 }
 
@@ -5,6 +5,6 @@
 
 namespace fast_ber
 {
-template <typename Identifier = ExplicitId<UniversalTag::printable_string>>
-using PrintableString = fast_ber::StringImpl<UniversalTag::printable_string, Identifier>;
+template <typename Identifier = ExplicitId<UniversalTag::printable_string>, StorageMode storage = StorageMode::dynamic>
+using PrintableString = fast_ber::StringImpl<UniversalTag::printable_string, Identifier, storage>;
 }
@@ -1,15 +1,19 @@
 #pragma once
 
 #include <span>
+#include "fast_ber/ber_types/Integer.hpp"
 #include "fast_ber/util/BerView.hpp"
 #include "fast_ber/util/DecodeHelpers.hpp"
+#include "fast_ber/util/Definitions.hpp"
 #include "fast_ber/util/EncodeHelpers.hpp"
 #include "fast_ber/util/SmallFixedIdBerContainer.hpp"
 
 #include <algorithm>
 #include <array>
+#include <charconv>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <limits>
 
 #include <bit>
@@ -20,16 +24,31 @@ namespace fast_ber
 namespace detail
 {
 constexpr size_t MaxEncodedLength = 100;
+
+// Longest encoding produced by encode_real(): control octet, two exponent octets and a 53 bit mantissa
+constexpr size_t MaxBinaryEncodedLength = 1 + 2 + 7;
+
+// Layout of an IEEE 754 double: | 1 bit sign | 11 bits biased exponent | 52 bits fraction |
+constexpr int      double_fraction_bits = 52;
+constexpr uint64_t double_fraction_mask = (uint64_t{1} << double_fraction_bits) - 1;
+constexpr int64_t  double_exponent_max  = 0x7FF;
+constexpr int64_t  double_exponent_bias = 1023;
+
+// Real values decoded by both storage modes are compared with a tolerance of one epsilon
+inline bool real_equal(double lhs_value, double rhs_value) noexcept;
 } // namespace detail
 
 inline bool   decode_real(std::span<const uint8_t> input, double& output) noexcept;
 inline bool   decode_real_special(std::span<const uint8_t> input, double& output) noexcept;
 inline bool   decode_real_binary(std::span<const uint8_t> input, double& output) noexcept;
-bool          decode_real_decimal(std::span<const uint8_t> input, double& output) noexcept; // In .cpp due to <regex>
+inline bool   decode_real_decimal(std::span<const uint8_t> input, double& output) noexcept;
 inline bool   check_real_binary(std::span<const uint8_t> input) noexcept;
 inline size_t encode_real(std::span<uint8_t> output, double input) noexcept;
+inline size_t encoded_real_length(double input) noexcept;
 
-template <typename Identifier = ExplicitId<UniversalTag::real>>
+// Real stored ber encoded, value() decodes the stored content. StorageMode::native stores the value as a double
+// instead, and only produces the encoding when encoded
+template <typename Identifier = ExplicitId<UniversalTag::real>, StorageMode storage = StorageMode::static_>
 class Real
 {
   public:
@@ -37,15 +56,20 @@ class Real
     Real(double num) noexcept { assign(num); }
     Real(BerView view) noexcept { decode(view); }
     template <typename Identifier2>
-    Real(const Real<Identifier2>& rhs) noexcept;
+    Real(const Real<Identifier2, storage>& rhs) noexcept;
+    template <typename Identifier2, StorageMode storage2, typename = std::enable_if_t<storage != storage2>>
+    Real(const Real<Identifier2, storage2>& rhs) noexcept
+    {
+        assign(rhs.value());
+    }
 
     explicit operator double() const noexcept { return value(); }
     double   value() const noexcept;
 
     Real& operator=(double rhs) noexcept;
     Real& operator=(const BerView& rhs) noexcept;
-    template <typename Identifier2>
-    Real& operator=(const Real<Identifier2>& rhs) noexcept;
+    template <typename Identifier2, StorageMode storage2>
+    Real& operator=(const Real<Identifier2, storage2>& rhs) noexcept;
 
     void assign(double val) noexcept;
     void assign(const Real& rhs) noexcept;
@@ -59,13 +83,55 @@ class Real
 
     using AsnId = Identifier;
 
-    template <typename Identifier2>
+    template <typename Identifier2, StorageMode storage2>
     friend class Real;
 
   private:
     SmallFixedIdBerContainer<Identifier, detail::MaxEncodedLength> m_contents;
 };
 
+template <typename Identifier>
+class Real<Identifier, StorageMode::native>
+{
+  public:
+    Real() noexcept = default;
+    Real(double num) noexcept : m_value(num) {}
+    Real(BerView view) noexcept { decode(view); }
+    template <typename Identifier2, StorageMode storage2>
+    Real(const Real<Identifier2, storage2>& rhs) noexcept : m_value(rhs.value())
+    {
+    }
+
+    explicit operator double() const noexcept { return m_value; }
+    double   value() const noexcept { return m_value; }
+
+    Real& operator=(double rhs) noexcept
+    {
+        assign(rhs);
+        return *this;
+    }
+    template <typename Identifier2, StorageMode storage2>
+    Real& operator=(const Real<Identifier2, storage2>& rhs) noexcept
+    {
+        assign(rhs.value());
+        return *this;
+    }
+
+    void assign(double val) noexcept { m_value = val; }
+
+    bool operator==(const Real& rhs) const noexcept { return detail::real_equal(m_value, rhs.m_value); }
+    bool operator!=(const Real& rhs) const noexcept { return !(*this == rhs); }
+
+    size_t       encoded_length() const noexcept;
+    EncodeResult encode(std::span<uint8_t> output) const noexcept;
+    DecodeResult decode(BerView input) noexcept;
+
+    using AsnId = Identifier;
+
+  private:
+    double m_value = 0.0;
+};
+
 /**
  * Checks that real binary value conforms to Real ASN.1 specification
  * @param input BER encoded real binary value to check
@@ -76,7 +142,7 @@ inline bool check_real_binary(std::span<const uint8_t> input) noexcept
     /* Minimal binary construction is: | control | exponent | number |  => length is 3 bytes minimum
      * Check that base bits are not set to the reserved value, see X690 Clause 8.5.7.4
      * */
-    if (input.size() > 3 && (input[0] & 0x30) != 0x30)
+    if (input.size() >= 3 && (input[0] & 0x30) != 0x30)
     {
         /* X690 Clause 8.5.7.4 */
         size_t exponent_len    = (input[0] & 0x03) + 1;
@@ -198,6 +264,81 @@ inline bool decode_real_special(std::span<const uint8_t> input, double& output)
     return res;
 }
 
+namespace detail
+{
+
+/**
+ * Rounds mantissa >> shift to the nearest integer, ties to even
+ * @param mantissa value to shift
+ * @param shift number of bits to remove, at least 1
+ * @return the rounded value
+ */
+inline uint64_t shift_right_rounded(uint64_t mantissa, int64_t shift) noexcept
+{
+    if (shift > 64)
+    {
+        return 0;
+    }
+    if (shift == 64)
+    {
+        return mantissa > (uint64_t{1} << 63) ? 1 : 0;
+    }
+
+    const uint64_t kept      = mantissa >> shift;
+    const uint64_t remainder = mantissa & ((uint64_t{1} << shift) - 1);
+    const uint64_t half      = uint64_t{1} << (shift - 1);
+    return kept + ((remainder > half || (remainder == half && (kept & 1))) ? 1 : 0);
+}
+
+/**
+ * Builds the double nearest to mantissa * 2^exponent
+ * @param negative sign of the value
+ * @param mantissa non zero mantissa
+ * @param exponent binary exponent
+ * @return the value, infinite on overflow and zero on underflow
+ */
+inline double make_double(bool negative, uint64_t mantissa, int64_t exponent) noexcept
+{
+    /* Normalise the mantissa so that its top bit is set, the value is then 1.f * 2^(exponent + 63) */
+    const int leading_zeros = std::countl_zero(mantissa);
+    mantissa <<= leading_zeros;
+    int64_t biased_exponent = exponent - leading_zeros + 63 + double_exponent_bias;
+
+    uint64_t bits = 0;
+    if (biased_exponent >= double_exponent_max)
+    {
+        bits = static_cast<uint64_t>(double_exponent_max) << double_fraction_bits;
+    }
+    else
+    {
+        /* 11 bits of the mantissa do not fit in the 53 bit significand. Subnormal values have the minimum exponent,
+         * with the significand shifted further right */
+        int64_t shift = 63 - double_fraction_bits;
+        if (biased_exponent < 1)
+        {
+            shift += 1 - biased_exponent;
+            biased_exponent = 1;
+        }
+
+        /* The significand includes the hidden bit, which is added to the exponent field. Rounding up may carry into
+         * the exponent, giving the next power of two, or infinity */
+        const uint64_t significand = shift_right_rounded(mantissa, shift);
+        bits = (static_cast<uint64_t>(biased_exponent - 1) << double_fraction_bits) + significand;
+    }
+
+    bits |= static_cast<uint64_t>(negative) << 63;
+    return std::bit_cast<double>(bits);
+}
+
+inline bool is_decimal_digit(char c) noexcept { return c >= '0' && c <= '9'; }
+
+inline const char* skip_decimal_digits(const char* it, const char* end) noexcept
+{
+    return std::find_if_not(it, end, is_decimal_digit);
+}
+
+} // namespace detail
+
 /**
  * Decodes a real binary value
  * @param input BER encoded real binary value
@@ -206,13 +347,17 @@ inline bool decode_real_special(std::span<const uint8_t> input, double& output)
  */
 inline bool decode_real_binary(std::span<const uint8_t> input, double& output) noexcept
 {
-    if (!check_real_binary(input))
+    /* Control octet bits: | 1 | S | BB | FF | EE |, X690 Clause 8.5.7. Base 3 is reserved */
+    const uint8_t control = input[0];
+    if (input.size() < 3 || (control & 0x30) == 0x30)
     {
         return false;
     }
-
-    size_t exponent_len    = (input[0] & 0x03) + 1;
-    size_t exponent_offset = 1;
+    const bool    negative        = (control & 0x40) != 0;
+    const int64_t base            = (control & 0x30) >> 4;
+    const int64_t factor          = (control & 0x0C) >> 2;
+    size_t        exponent_len    = (control & 0x03) + 1;
+    size_t        exponent_offset = 1;
 
     /* X690 Clause 8.5.7.4.d */
     if (exponent_len == 4)
@@ -221,430 +366,368 @@ inline bool decode_real_binary(std::span<const uint8_t> input, double& output) n
         exponent_offset = 2;
     }
 
-    /* Verify that the exponent fits into an int */
-    if (exponent_len > sizeof(int))
+    /* The exponent must leave space for the mantissa, and must not start with 9 identical bits. Exponents of more than
+     * 32 bits are far beyond the range of a double */
+    if (exponent_len == 0 || exponent_len > sizeof(int32_t) || exponent_offset + exponent_len >= input.size())
     {
         return false;
     }
-
-    /* Get exponent sign */
-    int exponent = (input[exponent_offset] & 0x80) ? -1 : 0;
-
-    /* X690 Clause 8.5.7.1 */
-    int mantissa_sign = ((input[0] & 0x40) >> 6) & 0x01;
-
-    /* X690 Clause 8.5.7.2 */
-    int base = (input[0] & 0x30) >> 4;
-
-    /* X690 Clause 8.5.7.3 */
-    int factor = (input[0] & 0x0C) >> 2;
-
-    /* Read exponent */
-    for (size_t i = 0; i < exponent_offset; ++i)
+    const std::span<const uint8_t> exponent_octets = input.subspan(exponent_offset, exponent_len);
+    const int64_t                  exponent        = static_cast<int64_t>(detail::load_big_endian(exponent_octets)) >>
+                                 ((sizeof(int64_t) - exponent_len) * 8);
+    if (exponent_len > 1 && (exponent_octets[0] == 0x00 || exponent_octets[0] == 0xFF) &&
+        ((exponent_octets[0] ^ exponent_octets[1]) & 0x80) == 0)
     {
-        exponent = (exponent << 8) | input[exponent_offset + i];
+        return false;
     }
 
-    /* Convert base 8 exponent to base 2 */
-    if (base == 1)
+    /* Leading zero octets of the mantissa are skipped, a zero mantissa is invalid */
+    const std::span<const uint8_t> mantissa_octets = input.subspan(exponent_offset + exponent_len);
+    const std::span<const uint8_t> significant     = mantissa_octets.subspan(static_cast<size_t>(
+        std::find_if(mantissa_octets.begin(), mantissa_octets.end(), [](uint8_t octet) { return octet != 0; }) -
+        mantissa_octets.begin()));
+    if (significant.empty())
     {
-        if (exponent > 0 ? exponent <= std::numeric_limits<int>::max() / 3
-                         : exponent >= std::numeric_limits<int>::min() / 3)
-        {
-            exponent *= 3;
-        }
-        else
-        {
-            return false;
-        }
+        return false;
     }
-    /* Convert base 16 exponent to base 2 */
-    if (base == 2)
+
+    /* The first 8 significant octets are loaded big endian. Any further octets lower the weight of those loaded, and
+     * if non zero set the lowest bit so that the value is rounded correctly */
+    const size_t mantissa_len = std::min(significant.size(), sizeof(uint64_t));
+    uint64_t     mantissa =
+        detail::load_big_endian(significant.first(mantissa_len)) >> ((sizeof(uint64_t) - mantissa_len) * 8);
+
+    constexpr std::array<int64_t, 3> bits_per_digit = {1, 3, 4};
+    int64_t                          scale          = exponent * bits_per_digit[static_cast<size_t>(base)] + factor;
+    if (significant.size() > sizeof(uint64_t))
     {
-        if (exponent > 0 ? exponent <= std::numeric_limits<int>::max() / 4
-                         : exponent >= std::numeric_limits<int>::min() / 4)
+        const std::span<const uint8_t> truncated = significant.subspan(sizeof(uint64_t));
+        scale += static_cast<int64_t>(truncated.size() * 8);
+        if (std::any_of(truncated.begin(), truncated.end(), [](uint8_t octet) { return octet != 0; }))
         {
-            exponent *= 4;
-        }
-        else
-        {
-            return false;
+            mantissa |= 1;
         }
     }
 
-    /* Apply binary factor */
-    if (exponent <= (std::numeric_limits<int>::max() - factor))
-    {
-        exponent += factor;
-    }
-    else
+    output = detail::make_double(negative, mantissa, scale);
+    return true;
+}
+
+/**
+ * Decodes a real decimal value, in ISO 6093 NR1, NR2 or NR3 form. Leading spaces, a sign, and either '.' or ',' as
+ * the decimal mark are accepted. See X690 Clause 8.5.8
+ * @param input BER encoded real decimal value
+ * @param output decoded decimal value
+ * @return true on success, false on failure
+ */
+inline bool decode_real_decimal(std::span<const uint8_t> input, double& output) noexcept
+{
+    const uint8_t form = input[0] & 0x3F;
+    if (form < 1 || form > 3)
     {
         return false;
     }
 
-    /* If exponent overflows, check */
-    if (exponent < -0xFFFFFF || exponent > 0xFFFFFF)
+    const char* const end   = reinterpret_cast<const char*>(input.data() + input.size());
+    const char*       start = std::find_if_not(reinterpret_cast<const char*>(input.data() + 1), end,
+                                               [](char c) { return c == ' '; });
+
+    /* std::from_chars does not accept a leading '+' */
+    if (start != end && *start == '+')
     {
-        /* Exponent too large for a double */
-        if (exponent >= 0)
-        {
-            output =
-                mantissa_sign == 0 ? std::numeric_limits<double>::infinity() : -std::numeric_limits<double>::infinity();
-        }
-        /* Exponent too small for a double */
-        else
+        start++;
+        if (start != end && *start == '-')
         {
-            output = mantissa_sign == 0 ? 0.0 : -0.0;
+            return false;
         }
-
-        return true;
     }
 
-    /* Get Mantissa into a buffer
-     * One more byte is read because there could be a 3 or 4 bits shift, see X690 Clause 8.5.7
-     * */
-    std::array<uint8_t, 9> double_bytes    = {};
-    size_t                 mantissa_offset = exponent_len + exponent_offset;
-    size_t                 mantissa_len    = input.size() - mantissa_offset;
-
-    /* Skip leading zeros */
-    while (mantissa_len > 1 && input[mantissa_offset] == 0)
+    /* Check the grammar of the number: [-]digits[mark digits][(E|e)[+|-]digits], with at least one digit before or
+     * after the mark, and a mark if there is an exponent */
+    const bool  negative       = start != end && *start == '-';
+    const char* integer_start  = negative ? start + 1 : start;
+    const char* integer_end    = detail::skip_decimal_digits(integer_start, end);
+    const char* mark           = nullptr;
+    const char* fraction_start = integer_end;
+    const char* fraction_end   = integer_end;
+    if (fraction_start != end && (*fraction_start == '.' || *fraction_start == ','))
     {
-        mantissa_offset++;
-        mantissa_len--;
+        mark           = fraction_start;
+        fraction_start = mark + 1;
+        fraction_end   = detail::skip_decimal_digits(fraction_start, end);
     }
-
-    /* Put mantissa into bytes 1 to 7 and adapt the exponent */
-    for (size_t i = 0; i < 8; i++)
+    if (integer_start == integer_end && fraction_start == fraction_end)
     {
-        if (i < mantissa_len)
-        {
-            double_bytes[i + 1] = input[mantissa_offset + i];
-        }
+        return false;
     }
 
-    /* IEEE 754 double format is: | 1 bit Sign | 11 bits exponent | 52 bits mantissa |
-     * Exponent bias is 2^(k-1) - 1 where k = exponent size in bits. Here bias = 1023
-     * Add mantissa size to the bias to get an exponent corresponding to the mantissa
-     * bias = 1023 + 52 = 1075
-     * */
-    exponent += ((mantissa_len - 7) << 3) + 1075;
-
-    /* For a normalized value, the mantissa size is 52 bits with an implicit hidden bit which equals 1
-     * Set double_bytes to have b0001 in the first 4 bits of the first double byte
-     * See X690 Clause 8.5.7 */
-    if ((double_bytes[1] & 0xE0) != 0 && exponent < 0x7FF)
+    int64_t exponent = 0;
+    if (fraction_end != end)
     {
-        /* Mantissa is too big - shift right up to 3 bits */
-        int          shift      = 0;
-        unsigned int first_byte = double_bytes[1];
-
-        /* Adapt exponent */
-        while ((first_byte & 0xE0) != 0 && exponent < (0x7FF - shift))
+        const char* exponent_start = fraction_end + 1;
+        if (mark == nullptr || (*fraction_end != 'E' && *fraction_end != 'e') || exponent_start == end)
         {
-            first_byte >>= 1;
-            shift++;
+            return false;
         }
-        exponent += shift;
-
-        /* Adapt double bytes */
-        for (int j = 7; j > 0; --j)
+        /* Out of range exponents are saturated, they are only used to tell overflow from underflow */
+        const bool negative_exponent = *exponent_start == '-';
+        if (negative_exponent || *exponent_start == '+')
         {
-            unsigned int next_byte_shifted = static_cast<unsigned int>(double_bytes[j - 1]) << 8;
-            double_bytes[j]                = (next_byte_shifted | double_bytes[j]) >> shift;
+            exponent_start++;
         }
-    }
-    else if ((double_bytes[1] & 0xF0) == 0 && exponent > 0)
-    {
-        /* Mantissa is too small - shift left up to 4 bits */
-        int          shift      = 8;
-        unsigned int first_byte = double_bytes[1];
-
-        /* Adapt exponent */
-        while ((first_byte & 0xF0) == 0 && exponent > (8 - shift))
+        const char* const exponent_end = detail::skip_decimal_digits(exponent_start, end);
+        if (exponent_end == exponent_start || exponent_end != end)
         {
-            exponent -= 8 - shift;
+            return false;
         }
-
-        for (int j = 1; j < 8; ++j)
+        if (std::from_chars(exponent_start, exponent_end, exponent).ec != std::errc())
         {
-            unsigned int first_byte_shifted = static_cast<unsigned int>(double_bytes[j]) << 8;
-            double_bytes[j]                 = (first_byte_shifted | double_bytes[j + 1]) >> shift;
+            exponent = std::numeric_limits<int32_t>::max();
         }
+        exponent = negative_exponent ? -exponent : exponent;
     }
 
-    /* Verify that exponent does not overflow after modification */
-    if (exponent >= 0x7FF || exponent <= -55)
+    /* A comma decimal mark is replaced with a point in a copy of the number */
+    std::array<char, 128> buffer{};
+    const char*           number_end = end;
+    if (mark != nullptr && *mark == ',')
     {
-        /* Exponent too large for a double */
-        if (exponent >= 0)
-        {
-            output =
-                mantissa_sign == 0 ? std::numeric_limits<double>::infinity() : -std::numeric_limits<double>::infinity();
-        }
-        else
+        if (static_cast<size_t>(end - start) > buffer.size())
         {
-            /* Exponent too small for a double */
-            output = mantissa_sign == 0 ? 0.0 : -0.0;
+            return false;
         }
-
-        return true;
+        number_end                                = std::copy(start, end, buffer.data());
+        buffer[static_cast<size_t>(mark - start)] = '.';
+        start                                     = buffer.data();
     }
 
-    /* Normalize the value if necessary */
-    if (exponent <= 0)
+    const std::from_chars_result result = std::from_chars(start, number_end, output);
+    if (result.ptr != number_end)
     {
-        /* correct the exponent to shift one bit more right */
-        --exponent;
-
-        /* Shift the mantissa right until exponent is 0 */
-        int shift = (-exponent) >> 3;
-        for (int j = 7; j > shift; --j)
-        {
-            double_bytes[j] = double_bytes[j - shift];
-        }
-        for (int j = shift; j > 0; --j)
-        {
-            double_bytes[j] = 0;
-        }
-        /* shift right bit by bit */
-        shift = -exponent & 0x07;
-        for (int j = 7; j > 0; --j)
-        {
-            unsigned int next_byte_shifted = static_cast<unsigned int>(double_bytes[j - 1]) << 8;
-            double_bytes[j]                = (next_byte_shifted | double_bytes[j]) >> shift;
-        }
-
-        /* exponent for a denormalized value */
-        exponent = 0;
+        return false;
     }
-
-    /* Finally add the mantissa sign and the exponent to the double bytes */
-    double_bytes[0] = (mantissa_sign << 7) | (exponent >> 4);
-    double_bytes[1] = (exponent << 4) | (double_bytes[1] & 0x0F);
-
-    if (std::endian::native == std::endian::little)
-    {
-        /* Reverse bytes if needed */
-        std::reverse(double_bytes.begin(), double_bytes.end() - 1);
+    if (result.ec == std::errc::result_out_of_range)
+    {
+        /* The value is too large or too small for a double, depending on the position of its first significant digit
+         * relative to the decimal mark */
+        const char* const first_integer = std::find_if(integer_start, integer_end, [](char c) { return c != '0'; });
+        const int64_t     order         = (first_integer != integer_end)
+                                              ? exponent + (integer_end - first_integer)
+                                              : exponent - (std::find_if(fraction_start, fraction_end,
+                                                                         [](char c) { return c != '0'; }) -
+                                                            fraction_start);
+        output = order > 0 ? std::numeric_limits<double>::infinity() : 0.0;
+        output = negative ? -output : output;
+        return true;
     }
-
-
-    memcpy(&output, double_bytes.data(), sizeof(double));
-    return true;
+    return result.ec == std::errc();
 }
 
+/**
+ * Encodes a double in the binary form with base 2, with a minimal exponent and an odd mantissa as required by DER,
+ * see X690 Clause 11.3.1. Zero has empty content, other special values use a single octet
+ * @param output buffer to encode into, at least detail::MaxBinaryEncodedLength octets
+ * @param input value to encode
+ * @return length of the encoding
+ */
 inline size_t encode_real(std::span<uint8_t> output, double input) noexcept
 {
-    std::array<uint8_t, sizeof(double) + 1> buffer;
-    std::memcpy(buffer.data(), &input, sizeof(double));
-    buffer.back() = 0;
+    const uint64_t bits            = std::bit_cast<uint64_t>(input);
+    const bool     negative        = (bits >> 63) != 0;
+    const int64_t  biased_exponent = static_cast<int64_t>((bits >> detail::double_fraction_bits) & 0x7FF);
+    uint64_t       mantissa        = bits & detail::double_fraction_mask;
 
-    if (std::endian::native == std::endian::little)
+    if (biased_exponent == detail::double_exponent_max)
     {
-        /* Reverse bytes if needed */
-        std::reverse(buffer.begin(), buffer.end() - 1);
+        /* Not a number, plus or minus infinity */
+        output[0] = mantissa != 0 ? 0x42 : (negative ? 0x41 : 0x40);
+        return 1;
     }
-
-    unsigned int sign           = buffer[0] >> 7;
-    size_t       encoded_length = 0;
-    int          exponent       = (buffer[0] & 0x7F) << 4 | (buffer[1] >> 4);
-
-    /* Remove exponent */
-    buffer[1] &= 0x0F;
-
-    if (exponent == 0x7FF)
+    if (biased_exponent == 0 && mantissa == 0)
     {
-        if (std::all_of(buffer.begin() + 1, buffer.end(), [](uint8_t elem) { return elem == 0; }))
+        /* Zero has no content, minus zero is a special value */
+        if (!negative)
         {
-            if (sign == 0)
-            {
-                /* Plus infinity */
-                output[0] = 0x40;
-            }
-            else
-            {
-                /* Minus infinity */
-                output[0] = 0x41;
-            }
-        }
-        else
-        {
-            /* Not a number value */
-            output[0] = 0x42;
+            return 0;
         }
-
+        output[0] = 0x43;
         return 1;
     }
-    else if (exponent == 0)
+
+    /* Normal values have an implicit leading one, subnormal values have the minimum exponent */
+    int64_t exponent = 0;
+    if (biased_exponent == 0)
     {
-        if (std::all_of(buffer.begin() + 1, buffer.end(), [](uint8_t elem) { return elem == 0; }))
-        {
-            if (sign == 0)
-            {
-                /* Zero value - nothing to do */
-                return 0;
-            }
-            else
-            {
-                /* Minus zero */
-                output[0] = 0x43;
-                return 1;
-            }
-        }
-        else
-        {
-            /* Denormalized value - shift left 1 bit at a time */
-            for (size_t i = 1; i < buffer.size() - 1; ++i)
-            {
-                unsigned int current_byte_shifted = static_cast<unsigned int>(buffer[i]) << 8;
-                buffer[i]                         = (current_byte_shifted | buffer[i + 1]) >> 7;
-            }
-            exponent -= 1075;
-        }
+        exponent = 1 - detail::double_exponent_bias - detail::double_fraction_bits;
     }
     else
     {
-        /* Normalized value, implicit first bit */
-        buffer[1] |= 0x10;
-        exponent -= 1075;
+        mantissa |= uint64_t{1} << detail::double_fraction_bits;
+        exponent = biased_exponent - detail::double_exponent_bias - detail::double_fraction_bits;
     }
 
-    /* Encode a binary real value into BER format */
-    if (-128 <= exponent && exponent <= 127)
-    {
-        /* exponent on 1 byte */
-        encoded_length = 1 + 1 + 7;
+    /* Remove trailing zero bits, so that the mantissa is odd */
+    const int trailing_zeros = std::countr_zero(mantissa);
+    mantissa >>= trailing_zeros;
+    exponent += trailing_zeros;
 
-        /* Control byte bits: | 1 | S | BB | FF | EE |
-         * S  = sign
-         * BB = base 2 = 00
-         * FF = 0      = 00
-         * EE = 1 byte = 00
-         * */
-        output[0] = static_cast<uint8_t>(0x80 | (sign << 6));
+    /* Control octet bits: | 1 | S | BB | FF | EE |, base 2, no factor. The exponent is one or two octets */
+    const size_t exponent_len = encode_integer(output.subspan(1, 2), exponent);
+    output[0]                 = static_cast<uint8_t>(0x80 | (negative ? 0x40 : 0x00) | (exponent_len - 1));
 
-        /* Assign exponent */
-        output[1] = static_cast<uint8_t>(exponent);
-    }
-    else
-    {
-        /* exponent on two signed bytes */
-        encoded_length = 1 + 2 + 7;
+    /* Mantissa, big endian in the minimum number of octets */
+    const size_t   mantissa_len = static_cast<size_t>(64 - std::countl_zero(mantissa) + 7) / 8;
+    const uint64_t word = detail::to_big_endian(mantissa << ((sizeof(uint64_t) - mantissa_len) * 8));
+    std::memcpy(output.data() + 1 + exponent_len, &word, mantissa_len);
 
-        /* Control byte bits: | 1 | S | BB | FF | EE |
-         * S  = sign
-         * BB = base 2  = 00
-         * FF = 0       = 00
-         * EE = 2 bytes = 01
-         * */
-        output[0] = static_cast<uint8_t>(0x81 | (sign << 6));
+    return 1 + exponent_len + mantissa_len;
+}
 
-        /* Assign exponent */
-        output[1] = static_cast<uint8_t>(exponent >> 8);
-        output[2] = static_cast<uint8_t>(exponent & 0xFF);
+inline size_t encoded_real_length(double input) noexcept
+{
+    std::array<uint8_t, detail::MaxBinaryEncodedLength> buffer{};
+    return encode_real(buffer, input);
+}
+
+inline bool detail::real_equal(double lhs_value, double rhs_value) noexcept
+{
+    /* Inspired from https://www.embeddeduse.com/2019/08/26/qt-compare-two-floats/ */
+
+    /* Cannot compare NAN */
+    if (std::isnan(lhs_value) || std::isnan(rhs_value))
+    {
+        return false;
     }
 
-    /* Mantissa on 7 bytes */
-    for (size_t i = 1; i < 8; ++i)
+    /* According to https://www.gnu.org/software/libc/manual/html_node/Infinity-and-NaN.html
+     * In comparison operations, positive infinity is larger than all values except itself and NaN */
+    if (std::isinf(lhs_value) && std::isinf(rhs_value))
     {
-        output[encoded_length + i - 8] = buffer[i];
+        return std::signbit(lhs_value) == std::signbit(rhs_value);
     }
 
-    return encoded_length;
+    if (std::abs(lhs_value - rhs_value) <= std::numeric_limits<double>::epsilon())
+    {
+        return true;
+    }
+
+    return std::abs(lhs_value - rhs_value) <=
+           std::numeric_limits<double>::epsilon() * std::max(std::abs(lhs_value), std::abs(rhs_value));
 }
 
-template <typename Identifier>
+template <typename Identifier, StorageMode storage>
 template <typename Identifier2>
-Real<Identifier>::Real(const Real<Identifier2>& rhs) noexcept : m_contents(rhs.m_contents)
+Real<Identifier, storage>::Real(const Real<Identifier2, storage>& rhs) noexcept : m_contents(rhs.m_contents)
 {
 }
 
-template <typename Identifier>
-inline double Real<Identifier>::value() const noexcept
+template <typename Identifier, StorageMode storage>
+inline double Real<Identifier, storage>::value() const noexcept
 {
     double ret = 0;
     decode_real(m_contents.content(), ret);
     return ret;
 }
 
-template <typename Identifier>
-inline Real<Identifier>& Real<Identifier>::operator=(double rhs) noexcept
+template <typename Identifier, StorageMode storage>
+inline Real<Identifier, storage>& Real<Identifier, storage>::operator=(double rhs) noexcept
 {
     assign(rhs);
     return *this;
 }
 
-template <typename Identifier>
-template <typename Identifier2>
-inline Real<Identifier>& Real<Identifier>::operator=(const Real<Identifier2>& rhs) noexcept
+template <typename Identifier, StorageMode storage>
+template <typename Identifier2, StorageMode storage2>
+inline Real<Identifier, storage>& Real<Identifier, storage>::operator=(const Real<Identifier2, storage2>& rhs) noexcept
 {
-    assign(rhs);
+    if constexpr (storage == storage2)
+    {
+        m_contents = rhs.m_contents;
+    }
+    else
+    {
+        assign(rhs.value());
+    }
     return *this;
 }
 
-template <typename Identifier>
-inline void Real<Identifier>::assign(double val) noexcept
+template <typename Identifier, StorageMode storage>
+inline void Real<Identifier, storage>::assign(double val) noexcept
 {
     m_contents.resize_content(
         encode_real(std::span<uint8_t>(m_contents.content_data(), detail::MaxEncodedLength), val));
 }
 
-template <typename Identifier>
-inline void Real<Identifier>::assign(const Real<Identifier>& rhs) noexcept
+template <typename Identifier, StorageMode storage>
+inline void Real<Identifier, storage>::assign(const Real& rhs) noexcept
 {
     m_contents = rhs.m_contents;
 }
 
-template <typename Identifier>
-inline bool Real<Identifier>::operator==(const Real& rhs) const noexcept
+template <typename Identifier, StorageMode storage>
+inline bool Real<Identifier, storage>::operator==(const Real& rhs) const noexcept
 {
-    /* Inspired from https://www.embeddeduse.com/2019/08/26/qt-compare-two-floats/ */
-    const double lhs_value = this->value();
-    const double rhs_value = rhs.value();
-
-    /* Cannot compare NAN */
-    if (std::isnan(lhs_value) || std::isnan(rhs_value))
-    {
-        return false;
-    }
+    return detail::real_equal(this->value(), rhs.value());
+}
 
-    /* According to https://www.gnu.org/software/libc/manual/html_node/Infinity-and-NaN.html
-     * In comparison operations, positive infinity is larger than all values except itself and NaN */
-    if (std::isinf(lhs_value) && std::isinf(rhs_value))
-    {
-        return std::signbit(lhs_value) == std::signbit(rhs_value);
-    }
+template <typename Identifier, StorageMode storage>
+size_t Real<Identifier, storage>::encoded_length() const noexcept
+{
+    return m_contents.ber_length();
+}
 
-    if (std::abs(lhs_value - rhs_value) <= std::numeric_limits<double>::epsilon())
-    {
-        return true;
-    }
+template <typename Identifier, StorageMode storage>
+EncodeResult Real<Identifier, storage>::encode(std::span<uint8_t> output) const noexcept
+{
+    return m_contents.encode(output);
+}
 
-    return std::abs(lhs_value - rhs_value) <=
-           std::numeric_limits<double>::epsilon() * std::max(std::abs(lhs_value), std::abs(rhs_value));
+template <typename Identifier, StorageMode storage>
+DecodeResult Real<Identifier, storage>::decode(BerView input) noexcept
+{
+    return m_contents.decode(input);
 }
 
 template <typename Identifier>
-size_t Real<Identifier>::encoded_length() const noexcept
+size_t Real<Identifier, StorageMode::native>::encoded_length() const noexcept
 {
-    return m_contents.ber_length();
+    return fast_ber::encoded_length(encoded_real_length(m_value), Identifier{});
 }
 
 template <typename Identifier>
-EncodeResult Real<Identifier>::encode(std::span<uint8_t> output) const noexcept
+EncodeResult Real<Identifier, StorageMode::native>::encode(std::span<uint8_t> output) const noexcept
 {
-    return m_contents.encode(output);
+    std::array<uint8_t, detail::MaxBinaryEncodedLength> content{};
+    const size_t content_length = encode_real(content, m_value);
+    const size_t header_length  = encoded_header_length(content_length, Identifier{});
+    if (output.size() < header_length + content_length)
+    {
+        return EncodeResult{false, 0};
+    }
+
+    encode_header(output, content_length, Identifier{}, Construction::primitive);
+    std::copy_n(content.begin(), content_length, output.begin() + static_cast<std::ptrdiff_t>(header_length));
+    return EncodeResult{true, header_length + content_length};
 }
 
 template <typename Identifier>
-DecodeResult Real<Identifier>::decode(BerView input) noexcept
+DecodeResult Real<Identifier, StorageMode::native>::decode(BerView input) noexcept
 {
-    return m_contents.decode(input);
+    if (!has_correct_header(input, Identifier{}, Construction::primitive))
+    {
+        return DecodeResult{false, DecodeError::invalid_header};
+    }
+
+    const BerView content_view = (Identifier::depth() == 1) ? input : *input.begin();
+    if (!decode_real(content_view.content(), m_value))
+    {
+        return DecodeResult{false, DecodeError::invalid_content};
+    }
+    return DecodeResult{true};
 }
 
-template <typename Identifier>
-std::ostream& operator<<(std::ostream& os, const Real<Identifier>& object) noexcept
+template <typename Identifier, StorageMode storage>
+std::ostream& operator<<(std::ostream& os, const Real<Identifier, storage>& object) noexcept
 {
     return os << object.value();
 }
@@ -1,8 +1,11 @@
 #pragma once
 
+#include "fast_ber/util/Arena.hpp"
 #include "fast_ber/util/DecodeHelpers.hpp"
 #include "fast_ber/util/Definitions.hpp"
 #include "fast_ber/util/EncodeHelpers.hpp"
+#include "fast_ber/util/GatherBuffer.hpp"
+#include "fast_ber/util/SmallVector.hpp"
 
 #include <vector>
 
@@ -13,29 +16,32 @@
 namespace fast_ber
 {
 
-template <typename T, StorageMode storage>
+// Small buffer optimised sequences store up to inline_capacity elements without allocating. An inline capacity of zero
+// selects a default based on the size of the element type. Element storage is taken from the active arena, if any
+template <typename T, StorageMode storage, size_t inline_capacity>
 struct SequenceOfImplementation
 {
-    using Type = std::vector<T>;
+    using Type = std::vector<T, ArenaAllocator<T>>;
 };
 
-template <typename T>
-struct SequenceOfImplementation<T, StorageMode::small_buffer_optimised>
+template <typename T, size_t inline_capacity>
+struct SequenceOfImplementation<T, StorageMode::small_buffer_optimised, inline_capacity>
 {
-    using Type = std::vector<T>;
+    using Type = SmallVector<T, (inline_capacity == 0) ? default_inline_capacity<T>() : inline_capacity,
+                             ArenaAllocator<T>>;
 };
 
-template <typename T>
-struct SequenceOfImplementation<T, StorageMode::dynamic>
+template <typename T, size_t inline_capacity>
+struct SequenceOfImplementation<T, StorageMode::dynamic, inline_capacity>
 {
-    using Type = std::vector<T>;
+    using Type = std::vector<T, ArenaAllocator<T>>;
 };
 
 template <typename T, typename I = ExplicitId<UniversalTag::sequence>,
-          StorageMode s = StorageMode::small_buffer_optimised>
-struct SequenceOf : public SequenceOfImplementation<T, s>::Type
+          StorageMode s = StorageMode::small_buffer_optimised, size_t n = 0>
+struct SequenceOf : public SequenceOfImplementation<T, s, n>::Type
 {
-    using Implementation = typename SequenceOfImplementation<T, s>::Type;
+    using Implementation = typename SequenceOfImplementation<T, s, n>::Type;
 
     using Implementation::Implementation;
     SequenceOf()                  = default;
@@ -43,8 +49,8 @@ struct SequenceOf : public SequenceOfImplementation<T, s>::Type
     SequenceOf(SequenceOf&&) noexcept;
     SequenceOf(const Implementation& t) : Implementation(t) {}
     SequenceOf(Implementation&& t) noexcept : Implementation(std::move(t)) {}
-    template <typename I2, StorageMode s2>
-    SequenceOf(const SequenceOf<T, I2, s2>& t) : Implementation(t.begin(), t.end())
+    template <typename I2, StorageMode s2, size_t n2>
+    SequenceOf(const SequenceOf<T, I2, s2, n2>& t) : Implementation(t.begin(), t.end())
     {
     }
     ~SequenceOf() noexcept = default;
@@ -54,45 +60,48 @@ struct SequenceOf : public SequenceOfImplementation<T, s>::Type
 
     size_t       encoded_length() const noexcept;
     EncodeResult encode(std::span<uint8_t> buffer) const noexcept;
+    EncodeResult encode_reverse(std::span<uint8_t> buffer) const noexcept;
+    EncodeResult encode_indefinite(std::span<uint8_t> buffer) const noexcept;
+    EncodeResult encode_gather(GatherBuffer& output) const noexcept;
     DecodeResult decode(BerView input) noexcept;
 
     using AsnId = I;
 };
 
-template <typename T, typename I, StorageMode s>
-SequenceOf<T, I, s>::SequenceOf(SequenceOf<T, I, s>&& rhs) noexcept : Implementation(std::move(rhs))
+template <typename T, typename I, StorageMode s, size_t n>
+SequenceOf<T, I, s, n>::SequenceOf(SequenceOf<T, I, s, n>&& rhs) noexcept : Implementation(std::move(rhs))
 {
 }
 
-template <typename T, typename I, StorageMode s>
-SequenceOf<T, I, s>& SequenceOf<T, I, s>::operator=(SequenceOf<T, I, s>&& rhs) noexcept
+template <typename T, typename I, StorageMode s, size_t n>
+SequenceOf<T, I, s, n>& SequenceOf<T, I, s, n>::operator=(SequenceOf<T, I, s, n>&& rhs) noexcept
 {
-    Implementation::operator=(rhs);
+    Implementation::operator=(std::move(rhs));
     return *this;
 }
 
-template <typename T, typename I1, StorageMode s1, typename I2, StorageMode s2>
-bool operator==(const SequenceOf<T, I1, s1>& lhs, const SequenceOf<T, I2, s2>& rhs) noexcept
+template <typename T, typename I1, StorageMode s1, size_t n1, typename I2, StorageMode s2, size_t n2>
+bool operator==(const SequenceOf<T, I1, s1, n1>& lhs, const SequenceOf<T, I2, s2, n2>& rhs) noexcept
 {
     return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
-template <typename T, typename I1, StorageMode s1, typename I2, StorageMode s2>
-bool operator!=(const SequenceOf<T, I1, s1>& lhs, const SequenceOf<T, I2, s2>& rhs) noexcept
+template <typename T, typename I1, StorageMode s1, size_t n1, typename I2, StorageMode s2, size_t n2>
+bool operator!=(const SequenceOf<T, I1, s1, n1>& lhs, const SequenceOf<T, I2, s2, n2>& rhs) noexcept
 {
     return !(lhs == rhs);
 }
 
-template <typename T, typename I, StorageMode s>
-size_t SequenceOf<T, I, s>::encoded_length() const noexcept
+template <typename T, typename I, StorageMode s, size_t n>
+size_t SequenceOf<T, I, s, n>::encoded_length() const noexcept
 {
     const size_t content_length = std::accumulate(this->begin(), this->end(), size_t(0),
                                                   [](size_t count, const T& t) { return count + t.encoded_length(); });
     return fast_ber::encoded_length(content_length, I{});
 }
 
-template <typename T, typename I, StorageMode s>
-EncodeResult SequenceOf<T, I, s>::encode(const std::span<uint8_t> buffer) const noexcept
+template <typename T, typename I, StorageMode s, size_t n>
+EncodeResult SequenceOf<T, I, s, n>::encode(const std::span<uint8_t> buffer) const noexcept
 {
     constexpr size_t header_length_guess = fast_ber::encoded_length(0, I{});
     auto             content_buffer      = buffer;
@@ -117,30 +126,116 @@ EncodeResult SequenceOf<T, I, s>::encode(const std::span<uint8_t> buffer) const
     return wrap_with_ber_header(buffer, combined_length, I{}, header_length_guess);
 }
 
-template <typename T, typename I, StorageMode s>
-DecodeResult SequenceOf<T, I, s>::decode(BerView input) noexcept
+template <typename T, typename I, StorageMode s, size_t n>
+EncodeResult SequenceOf<T, I, s, n>::encode_reverse(const std::span<uint8_t> buffer) const noexcept
+{
+    auto   content_buffer  = buffer;
+    size_t combined_length = 0;
+
+    for (auto element = this->rbegin(); element != this->rend(); ++element)
+    {
+        const auto element_encode_result = fast_ber::encode_reverse(content_buffer, *element);
+        if (!element_encode_result.success)
+        {
+            return {false, 0};
+        }
+        combined_length += element_encode_result.length;
+        content_buffer = content_buffer.first(content_buffer.size() - element_encode_result.length);
+    }
+
+    return wrap_with_ber_header_reverse(buffer, combined_length, I{});
+}
+
+template <typename T, typename I, StorageMode s, size_t n>
+EncodeResult SequenceOf<T, I, s, n>::encode_indefinite(const std::span<uint8_t> buffer) const noexcept
+{
+    auto header_encode_result = encode_indefinite_header(buffer, I{});
+    if (!header_encode_result.success)
+    {
+        return {false, 0};
+    }
+
+    size_t combined_length = header_encode_result.length;
+    for (const T& element : *this)
+    {
+        const auto element_encode_result = fast_ber::encode_indefinite(buffer.subspan(combined_length), element);
+        if (!element_encode_result.success)
+        {
+            return {false, 0};
+        }
+        combined_length += element_encode_result.length;
+    }
+
+    auto end_encode_result = encode_end_of_contents(buffer.subspan(combined_length), I{});
+    return {end_encode_result.success, combined_length + end_encode_result.length};
+}
+
+template <typename T, typename I, StorageMode s, size_t n>
+EncodeResult SequenceOf<T, I, s, n>::encode_gather(GatherBuffer& output) const noexcept
+{
+    size_t combined_length = 0;
+    for (auto element = this->rbegin(); element != this->rend(); ++element)
+    {
+        const auto element_encode_result = fast_ber::encode_gather(output, *element);
+        if (!element_encode_result.success)
+        {
+            return {false, 0};
+        }
+        combined_length += element_encode_result.length;
+    }
+
+    return encode_gather_header(output, combined_length, I{});
+}
+
+// Elements are decoded into the existing elements of the sequence, keeping their storage, so decoding packets of the
+// same shape into one object allocates nothing once it has grown to fit
+template <typename T, typename I, StorageMode s, size_t n>
+DecodeResult SequenceOf<T, I, s, n>::decode(BerView input) noexcept
 {
-    this->clear();
     if (!has_correct_header(input, I{}, Construction::constructed))
     {
-        return DecodeResult{false};
+        this->clear();
+        return DecodeResult{false, DecodeError::invalid_header};
     }
 
     BerView child_range = (I::depth() == 1) ? input : *input.begin();
+    size_t  count       = 0;
+    size_t  consumed    = 0;
+    for (auto child = child_range.begin(); child != child_range.end(); ++child)
+    {
+        count++;
+        consumed += child->ber_length();
+    }
+
+    // Iteration also ends at a malformed element, which must not be taken for the end of the sequence
+    if (!child_range.is_valid())
+    {
+        this->clear();
+        return DecodeResult{false, DecodeError::invalid_packet, decode_offset(input.header_length())};
+    }
+    if (!child_range.ends_after(consumed))
+    {
+        this->clear();
+        return DecodeResult{false, DecodeError::invalid_packet,
+                            decode_offset(offset_within(input, child_range) + child_range.header_length() + consumed)};
+    }
+    this->resize(count);
+
+    auto element = this->begin();
     for (const BerView child : child_range)
     {
-        this->emplace_back();
-        bool success = this->back().decode(child).success;
-        if (!success)
+        DecodeResult res = (element++)->decode(child);
+        if (!res.success)
         {
-            return DecodeResult{false};
+            res.offset = decode_offset(res.offset + offset_within(input, child));
+            return res;
         }
     }
     return DecodeResult{true};
 }
 
-template <typename T, typename I, StorageMode s1>
-std::ostream& operator<<(std::ostream& os, const SequenceOf<T, I, s1>& sequence)
+template <typename T, typename I, StorageMode s1, size_t n>
+std::ostream& operator<<(std::ostream& os, const SequenceOf<T, I, s1, n>& sequence)
 {
     bool first = true;
 
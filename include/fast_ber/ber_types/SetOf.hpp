@@ -6,7 +6,7 @@ namespace fast_ber
 {
 
 template <typename T, typename I = fast_ber::ExplicitId<fast_ber::UniversalTag::set>,
-          StorageMode s = StorageMode::dynamic>
-using SetOf = SequenceOf<T, I, s>;
+          StorageMode s = StorageMode::dynamic, size_t n = 0>
+using SetOf = SequenceOf<T, I, s, n>;
 
 } // namespace fast_ber
@@ -1,8 +1,11 @@
 #pragma once
 
+#include "fast_ber/util/BorrowedFixedIdBerContainer.hpp"
 #include "fast_ber/util/DecodeHelpers.hpp"
+#include "fast_ber/util/Definitions.hpp"
 #include "fast_ber/util/EncodeHelpers.hpp"
 #include "fast_ber/util/FixedIdBerContainer.hpp"
+#include "fast_ber/util/GatherBuffer.hpp"
 
 #include <string_view>
 #include <span>
@@ -10,23 +13,44 @@
 #include <algorithm>
 #include <cctype>
 #include <string>
+#include <type_traits>
 
 namespace fast_ber
 {
 
+template <typename Identifier, StorageMode storage>
+struct StringImplementation
+{
+    using Type = FixedIdBerContainer<Identifier>;
+};
+
+template <typename Identifier>
+struct StringImplementation<Identifier, StorageMode::borrowed>
+{
+    using Type = BorrowedFixedIdBerContainer<Identifier>;
+};
+
 // A string with data stored with ber encoding. Interface mimics std::string
-template <UniversalTag tag, typename Identifier>
+// Borrowed strings reference the buffer they were decoded from, which must outlive the string unless make_owned() is
+// called. They are modified only by assignment, their contents are read through const accessors
+template <UniversalTag tag, typename Identifier, StorageMode storage = StorageMode::dynamic>
 class StringImpl
 {
   public:
     StringImpl() noexcept = default;
     template <UniversalTag tag2, typename Identifier2>
-    StringImpl(const StringImpl<tag2, Identifier2>& rhs) noexcept : m_contents(rhs.m_contents)
+    StringImpl(const StringImpl<tag2, Identifier2, storage>& rhs) noexcept : m_contents(rhs.m_contents)
     {
     }
     template <UniversalTag tag2, typename Identifier2>
-    StringImpl(StringImpl<tag2, Identifier2>&& rhs) noexcept : m_contents(std::move(rhs.m_contents))
+    StringImpl(StringImpl<tag2, Identifier2, storage>&& rhs) noexcept : m_contents(std::move(rhs.m_contents))
+    {
+    }
+    template <UniversalTag tag2, typename Identifier2, StorageMode storage2,
+              typename = std::enable_if_t<storage != storage2>>
+    StringImpl(const StringImpl<tag2, Identifier2, storage2>& rhs) noexcept
     {
+        assign(rhs.span());
     }
 
     StringImpl(const char* input_data) noexcept { assign(std::string_view(input_data)); }
@@ -37,8 +61,8 @@ class StringImpl
     explicit StringImpl(std::span<const uint8_t> input_data) noexcept { assign(input_data); }
     explicit StringImpl(BerView view) noexcept { decode(view); }
 
-    template <UniversalTag tag2, typename Identifier2>
-    StringImpl& operator=(const StringImpl<tag2, Identifier2>& rhs) noexcept;
+    template <UniversalTag tag2, typename Identifier2, StorageMode storage2>
+    StringImpl& operator=(const StringImpl<tag2, Identifier2, storage2>& rhs) noexcept;
     StringImpl& operator=(const char* rhs) noexcept;
     StringImpl& operator=(const std::string& rhs) noexcept;
     StringImpl& operator=(std::string_view rhs) noexcept;
@@ -54,106 +78,120 @@ class StringImpl
     bool           operator!=(const StringImpl& rhs) const noexcept { return !((*this) == rhs); }
     bool           operator!=(const std::string& rhs) const noexcept { return !((*this) == rhs); }
     bool           operator!=(const char* rhs) const noexcept { return !((*this) == rhs); }
-    uint8_t&       operator[](size_t n) noexcept { return data()[n]; }
+    uint8_t&       operator[](size_t n) noexcept requires(storage != StorageMode::borrowed) { return data()[n]; }
     const uint8_t& operator[](size_t n) const noexcept { return data()[n]; }
-    explicit       operator std::string_view() const noexcept { return {c_str(), length()}; }
+    explicit operator std::string_view() const noexcept
+    {
+        return {reinterpret_cast<const char*>(data()), length()};
+    }
 
-    uint8_t*                  data() noexcept { return m_contents.content_data(); }
-    const uint8_t*            data() const noexcept { return m_contents.content_data(); }
-    char*                     c_str() noexcept { return reinterpret_cast<char*>(data()); }
-    const char*               c_str() const noexcept { return reinterpret_cast<const char*>(data()); }
-    std::span<uint8_t>       span() noexcept { return m_contents.content(); }
+    uint8_t*       data() noexcept requires(storage != StorageMode::borrowed) { return m_contents.content_data(); }
+    const uint8_t* data() const noexcept { return m_contents.content_data(); }
+    // Owned contents are followed by a zero byte. Borrowed contents are followed by the rest of the decoded buffer, so
+    // borrowed strings have no c_str() and are read through their std::string_view conversion instead
+    char*       c_str() noexcept requires(storage != StorageMode::borrowed) { return reinterpret_cast<char*>(data()); }
+    const char* c_str() const noexcept requires(storage != StorageMode::borrowed)
+    {
+        return reinterpret_cast<const char*>(data());
+    }
+    std::span<uint8_t>       span() noexcept requires(storage != StorageMode::borrowed) { return m_contents.content(); }
     std::span<const uint8_t> span() const noexcept { return m_contents.content(); }
-    uint8_t*                  begin() noexcept { return data(); }
+    uint8_t*                  begin() noexcept requires(storage != StorageMode::borrowed) { return data(); }
     const uint8_t*            begin() const noexcept { return data(); }
-    uint8_t*                  end() noexcept { return data() + length(); }
+    uint8_t*                  end() noexcept requires(storage != StorageMode::borrowed) { return data() + length(); }
     const uint8_t*            end() const noexcept { return data() + length(); }
     size_t                    size() const noexcept { return m_contents.content_length(); }
     size_t                    length() const noexcept { return m_contents.content_length(); }
-    std::string               value() const noexcept { return std::string(c_str(), length()); }
+    std::string               value() const noexcept { return std::string(std::string_view(*this)); }
     bool                      empty() const noexcept { return length() == 0; }
 
-    template <UniversalTag tag2, typename Identifier2>
-    void assign(const StringImpl<tag2, Identifier2>& rhs) noexcept;
+    template <UniversalTag tag2, typename Identifier2, StorageMode storage2>
+    void assign(const StringImpl<tag2, Identifier2, storage2>& rhs) noexcept;
     void assign(std::string_view buffer) noexcept;
     void assign(std::span<const uint8_t> buffer) noexcept;
     void resize(size_t i) noexcept { m_contents.resize_content(i); }
 
-    template <UniversalTag tag2, typename Identifier2>
+    // Copies the contents of a borrowed string out of the decoded buffer
+    void make_owned() requires(storage == StorageMode::borrowed) { m_contents.make_owned(); }
+
+    template <UniversalTag tag2, typename Identifier2, StorageMode storage2>
     friend class StringImpl;
 
     using AsnId = Identifier;
 
     size_t       encoded_length() const noexcept { return m_contents.ber().size(); }
     EncodeResult encode(std::span<uint8_t> output) const noexcept { return m_contents.encode(output); }
+    EncodeResult encode_gather(GatherBuffer& output) const noexcept { return output.add_encoding(m_contents.ber()); }
     DecodeResult decode(BerView input) noexcept { return m_contents.decode(input); }
 
   private:
-    FixedIdBerContainer<Identifier> m_contents;
+    typename StringImplementation<Identifier, storage>::Type m_contents;
 }; // namespace fast_ber
 
-template <UniversalTag tag, typename Identifier>
-struct IdentifierType<StringImpl<tag, Identifier>>
+template <UniversalTag tag, typename Identifier, StorageMode storage>
+struct IdentifierType<StringImpl<tag, Identifier, storage>>
 {
     using type = Identifier;
 };
 
-template <UniversalTag tag, typename Identifier>
-StringImpl<tag, Identifier>& StringImpl<tag, Identifier>::operator=(std::span<const uint8_t> rhs) noexcept
+template <UniversalTag tag, typename Identifier, StorageMode storage>
+StringImpl<tag, Identifier, storage>&
+StringImpl<tag, Identifier, storage>::operator=(std::span<const uint8_t> rhs) noexcept
 {
     assign(rhs);
     return *this;
 }
 
-template <UniversalTag tag, typename Identifier>
-StringImpl<tag, Identifier>& StringImpl<tag, Identifier>::operator=(const char* rhs) noexcept
+template <UniversalTag tag, typename Identifier, StorageMode storage>
+StringImpl<tag, Identifier, storage>& StringImpl<tag, Identifier, storage>::operator=(const char* rhs) noexcept
 {
     assign(std::string_view(rhs));
     return *this;
 }
 
-template <UniversalTag tag, typename Identifier>
-StringImpl<tag, Identifier>& StringImpl<tag, Identifier>::operator=(const std::string& rhs) noexcept
+template <UniversalTag tag, typename Identifier, StorageMode storage>
+StringImpl<tag, Identifier, storage>& StringImpl<tag, Identifier, storage>::operator=(const std::string& rhs) noexcept
 {
     assign(std::string_view(rhs));
     return *this;
 }
 
-template <UniversalTag tag, typename Identifier>
-StringImpl<tag, Identifier>& StringImpl<tag, Identifier>::operator=(std::string_view rhs) noexcept
+template <UniversalTag tag, typename Identifier, StorageMode storage>
+StringImpl<tag, Identifier, storage>& StringImpl<tag, Identifier, storage>::operator=(std::string_view rhs) noexcept
 {
     assign(rhs);
     return *this;
 }
 
-template <UniversalTag tag, typename Identifier>
-template <UniversalTag tag2, typename Identifier2>
-StringImpl<tag, Identifier>& StringImpl<tag, Identifier>::operator=(const StringImpl<tag2, Identifier2>& rhs) noexcept
+template <UniversalTag tag, typename Identifier, StorageMode storage>
+template <UniversalTag tag2, typename Identifier2, StorageMode storage2>
+StringImpl<tag, Identifier, storage>&
+StringImpl<tag, Identifier, storage>::operator=(const StringImpl<tag2, Identifier2, storage2>& rhs) noexcept
 {
     assign(rhs);
     return *this;
 }
 
-template <UniversalTag tag, typename Identifier>
-bool StringImpl<tag, Identifier>::operator==(const StringImpl<tag, Identifier>& rhs) const noexcept
+template <UniversalTag tag, typename Identifier, StorageMode storage>
+bool StringImpl<tag, Identifier, storage>::operator==(const StringImpl<tag, Identifier, storage>& rhs) const noexcept
 {
     return std::string_view(*this) == std::string_view(rhs);
 }
 
-template <UniversalTag tag, typename Identifier>
-bool StringImpl<tag, Identifier>::operator==(const std::string& rhs) const noexcept
+template <UniversalTag tag, typename Identifier, StorageMode storage>
+bool StringImpl<tag, Identifier, storage>::operator==(const std::string& rhs) const noexcept
 {
     return std::string_view(*this) == std::string_view(rhs);
 }
 
-template <UniversalTag tag, typename Identifier>
-bool StringImpl<tag, Identifier>::operator==(const char* rhs) const noexcept
+template <UniversalTag tag, typename Identifier, StorageMode storage>
+bool StringImpl<tag, Identifier, storage>::operator==(const char* rhs) const noexcept
 {
     return std::string_view(*this) == std::string_view(rhs);
 }
 
-template <UniversalTag tag, typename Identifier>
-std::ostream& operator<<(std::ostream& os, const StringImpl<tag, Identifier>& str) noexcept
+template <UniversalTag tag, typename Identifier, StorageMode storage>
+std::ostream& operator<<(std::ostream& os, const StringImpl<tag, Identifier, storage>& str) noexcept
 {
     if (std::all_of(str.begin(), str.end(), [](char c) { return std::isprint(c); }))
     {
@@ -165,21 +203,21 @@ std::ostream& operator<<(std::ostream& os, const StringImpl<tag, Identifier>& st
     }
 }
 
-template <UniversalTag tag, typename Identifier>
-void StringImpl<tag, Identifier>::assign(std::string_view buffer) noexcept
+template <UniversalTag tag, typename Identifier, StorageMode storage>
+void StringImpl<tag, Identifier, storage>::assign(std::string_view buffer) noexcept
 {
     m_contents.assign_content(std::span(reinterpret_cast<const uint8_t*>(buffer.data()), buffer.length()));
 }
 
-template <UniversalTag tag, typename Identifier>
-void StringImpl<tag, Identifier>::assign(std::span<const uint8_t> buffer) noexcept
+template <UniversalTag tag, typename Identifier, StorageMode storage>
+void StringImpl<tag, Identifier, storage>::assign(std::span<const uint8_t> buffer) noexcept
 {
     m_contents.assign_content(buffer);
 }
 
-template <UniversalTag tag, typename Identifier>
-template <UniversalTag tag2, typename Identifier2>
-void StringImpl<tag, Identifier>::assign(const StringImpl<tag2, Identifier2>& rhs) noexcept
+template <UniversalTag tag, typename Identifier, StorageMode storage>
+template <UniversalTag tag2, typename Identifier2, StorageMode storage2>
+void StringImpl<tag, Identifier, storage>::assign(const StringImpl<tag2, Identifier2, storage2>& rhs) noexcept
 {
     assign(rhs.span());
 }
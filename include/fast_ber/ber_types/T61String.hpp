@@ -6,6 +6,6 @@
 
 namespace fast_ber
 {
-template <typename Identifier = ExplicitId<UniversalTag::visible_string>>
-using T61String = fast_ber::StringImpl<UniversalTag::visible_string, Identifier>;
+template <typename Identifier = ExplicitId<UniversalTag::visible_string>, StorageMode storage = StorageMode::dynamic>
+using T61String = fast_ber::StringImpl<UniversalTag::visible_string, Identifier, storage>;
 }
@@ -1,7 +1,7 @@
 #pragma once
 
 #include <cstdint>
-#include <iostream>
+#include <ostream>
 
 namespace fast_ber
 {
@@ -25,6 +25,7 @@ enum class UniversalTag : Tag
     embedded_pdv      = 11,
     utf8_string       = 12,
     relative_oid      = 13,
+    time              = 14,
     sequence          = 16,
     sequence_of       = 16,
     set               = 17,
@@ -43,7 +44,11 @@ enum class UniversalTag : Tag
     general_string    = 27,
     universal_string  = 28,
     character_string  = 29,
-    bmp_string        = 30
+    bmp_string        = 30,
+    date              = 31,
+    time_of_day       = 32,
+    date_time         = 33,
+    duration          = 34
 };
 
 template <typename T>
@@ -84,6 +89,8 @@ inline std::ostream& operator<<(std::ostream& os, const UniversalTag& t) noexcep
         return os << "UTF8 String";
     case UniversalTag::relative_oid:
         return os << "Relative OID";
+    case UniversalTag::time:
+        return os << "Time";
     case UniversalTag::sequence:
         return os << "Sequence / Sequence Of";
     case UniversalTag::set:
@@ -114,6 +121,14 @@ inline std::ostream& operator<<(std::ostream& os, const UniversalTag& t) noexcep
         return os << "Character String";
     case UniversalTag::bmp_string:
         return os << "BMP String";
+    case UniversalTag::date:
+        return os << "Date";
+    case UniversalTag::time_of_day:
+        return os << "Time Of Day";
+    case UniversalTag::date_time:
+        return os << "Date Time";
+    case UniversalTag::duration:
+        return os << "Duration";
     default:
         return os << "Unknown Universal Tag";
     }
@@ -5,6 +5,6 @@
 
 namespace fast_ber
 {
-template <typename Identifier = ExplicitId<UniversalTag::teletex_string>>
-using TeletexString = fast_ber::StringImpl<UniversalTag::teletex_string, Identifier>;
+template <typename Identifier = ExplicitId<UniversalTag::teletex_string>, StorageMode storage = StorageMode::dynamic>
+using TeletexString = fast_ber::StringImpl<UniversalTag::teletex_string, Identifier, storage>;
 }
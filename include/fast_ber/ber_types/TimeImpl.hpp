@@ -0,0 +1,349 @@
+#pragma once
+
+#include "fast_ber/util/DecodeHelpers.hpp"
+#include "fast_ber/util/EncodeHelpers.hpp"
+#include "fast_ber/util/FixedIdBerContainer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <ostream>
+#include <span>
+#include <string_view>
+
+#include <cstdint>
+#include <cstdlib>
+
+namespace fast_ber
+{
+
+// An instant in UTC, to the microsecond
+using TimePoint = std::chrono::sys_time<std::chrono::microseconds>;
+
+enum class TimeFormat
+{
+    universal,               // UTC, such as 20190319210942Z
+    universal_with_timezone, // Local time followed by its offset from UTC, such as 20190319230942+0200
+    local                    // Local time in an unknown time zone, such as 20190319230942
+};
+
+namespace detail
+{
+
+// Encodings of times are short strings, stored without allocating
+constexpr size_t time_inline_length = 32;
+
+constexpr int max_timezone_offset_minutes = 23 * 60 + 59;
+
+struct TimeZone
+{
+    TimeFormat format         = TimeFormat::universal;
+    int        offset_minutes = 0;
+};
+
+// Fields of a date and time as they are written
+struct CivilTime
+{
+    int year        = 1970;
+    int month       = 1;
+    int day         = 1;
+    int hour        = 0;
+    int minute      = 0;
+    int second      = 0;
+    int microsecond = 0;
+};
+
+template <typename T>
+constexpr bool is_sys_time = false;
+
+template <typename Duration>
+constexpr bool is_sys_time<std::chrono::sys_time<Duration>> = true;
+
+inline bool is_digit(char c) noexcept { return static_cast<unsigned>(c - '0') <= 9; }
+
+// Write value as exactly count decimal digits
+inline void write_digits(char* output, int value, int count) noexcept
+{
+    for (int i = count - 1; i >= 0; i--)
+    {
+        output[i] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+}
+
+// Read exactly count decimal digits, input must hold at least count characters
+inline bool read_digits(const char* input, int count, int& value) noexcept
+{
+    value = 0;
+    for (int i = 0; i < count; i++)
+    {
+        if (!is_digit(input[i]))
+        {
+            return false;
+        }
+        value = value * 10 + (input[i] - '0');
+    }
+    return true;
+}
+
+// Write a fraction of a second with trailing zeros removed, nothing if it is zero
+inline size_t write_fraction(char* output, int microsecond) noexcept
+{
+    if (microsecond == 0)
+    {
+        return 0;
+    }
+    output[0] = '.';
+    write_digits(output + 1, microsecond, 6);
+    size_t length = 7;
+    while (output[length - 1] == '0')
+    {
+        length--;
+    }
+    return length;
+}
+
+// Read the digits of a fraction of a unit of unit_microseconds. Digits beyond the first nine are checked but ignored.
+// Returns the end of the digits, nullptr if there are none
+inline const char* read_fraction(const char* input, const char* end, int64_t unit_microseconds,
+                                 int64_t& microseconds) noexcept
+{
+    const char* const begin       = input;
+    int64_t           numerator   = 0;
+    int64_t           denominator = 1;
+    for (; input != end && is_digit(*input); input++)
+    {
+        if (denominator < 1000000000)
+        {
+            numerator = numerator * 10 + (*input - '0');
+            denominator *= 10;
+        }
+    }
+    microseconds = unit_microseconds * numerator / denominator;
+    return input == begin ? nullptr : input;
+}
+
+// Write Z, an offset such as +0200, or nothing for local times
+inline size_t write_time_zone(char* output, const TimeZone& zone) noexcept
+{
+    if (zone.format == TimeFormat::universal)
+    {
+        output[0] = 'Z';
+        return 1;
+    }
+    if (zone.format == TimeFormat::universal_with_timezone)
+    {
+        const int offset = std::abs(zone.offset_minutes);
+        output[0]        = zone.offset_minutes < 0 ? '-' : '+';
+        write_digits(output + 1, offset / 60, 2);
+        write_digits(output + 3, offset % 60, 2);
+        return 5;
+    }
+    return 0;
+}
+
+// Read the remainder of the input as Z, an offset of the form +hhmm, or +hh where hour_offsets is set, or nothing for
+// local times
+inline bool read_time_zone(const char* input, const char* end, TimeZone& zone, bool hour_offsets) noexcept
+{
+    const ptrdiff_t length = end - input;
+    if (length == 0)
+    {
+        zone = TimeZone{TimeFormat::local, 0};
+        return true;
+    }
+    if (length == 1 && input[0] == 'Z')
+    {
+        zone = TimeZone{TimeFormat::universal, 0};
+        return true;
+    }
+
+    int hours   = 0;
+    int minutes = 0;
+    if ((input[0] != '+' && input[0] != '-') || (length != 5 && (length != 3 || !hour_offsets)) ||
+        !read_digits(input + 1, 2, hours) || (length == 5 && !read_digits(input + 3, 2, minutes)) || hours > 23 ||
+        minutes > 59)
+    {
+        return false;
+    }
+    const int offset = hours * 60 + minutes;
+    zone             = TimeZone{TimeFormat::universal_with_timezone, input[0] == '-' ? -offset : offset};
+    return true;
+}
+
+inline CivilTime to_civil(TimePoint time) noexcept
+{
+    const std::chrono::sys_days                            days = std::chrono::floor<std::chrono::days>(time);
+    const std::chrono::year_month_day                      date(days);
+    const std::chrono::hh_mm_ss<std::chrono::microseconds> time_of_day(time - days);
+    return CivilTime{static_cast<int>(date.year()),
+                     static_cast<int>(static_cast<unsigned>(date.month())),
+                     static_cast<int>(static_cast<unsigned>(date.day())),
+                     static_cast<int>(time_of_day.hours().count()),
+                     static_cast<int>(time_of_day.minutes().count()),
+                     static_cast<int>(time_of_day.seconds().count()),
+                     static_cast<int>(time_of_day.subseconds().count())};
+}
+
+// False if the fields are not a valid date and time. A leap second is accepted, as the first second of the next minute
+inline bool from_civil(const CivilTime& civil, TimePoint& time) noexcept
+{
+    const std::chrono::year_month_day date(std::chrono::year(civil.year),
+                                           std::chrono::month(static_cast<unsigned>(civil.month)),
+                                           std::chrono::day(static_cast<unsigned>(civil.day)));
+    if (!date.ok() || civil.hour > 23 || civil.minute > 59 || civil.second > 60)
+    {
+        return false;
+    }
+    time = std::chrono::sys_days(date) + std::chrono::hours(civil.hour) + std::chrono::minutes(civil.minute) +
+           std::chrono::seconds(civil.second) + std::chrono::microseconds(civil.microsecond);
+    return true;
+}
+
+// Limit a time to the years that a format can represent
+inline TimePoint clamp_years(TimePoint time, int first_year, int last_year) noexcept
+{
+    const TimePoint first = std::chrono::sys_days(std::chrono::year(first_year) / 1 / 1);
+    const TimePoint last =
+        std::chrono::sys_days(std::chrono::year(last_year + 1) / 1 / 1) - std::chrono::microseconds(1);
+    return std::clamp(time, first, last);
+}
+
+} // namespace detail
+
+// A time stored ber encoded. Format converts between the encoded string and a std::chrono value, with neither
+// conversion allocating
+template <typename Format, typename Identifier>
+class TimeImpl
+{
+  public:
+    using Value      = typename Format::Value;
+    using TimeFormat = fast_ber::TimeFormat;
+
+    TimeImpl() noexcept { set_time(Value{}); }
+    TimeImpl(const TimeImpl&) noexcept = default;
+    TimeImpl(TimeImpl&&) noexcept      = default;
+    TimeImpl(const Value& time) noexcept { set_time(time); }
+    template <typename Duration>
+    TimeImpl(std::chrono::sys_time<Duration> time) noexcept requires(detail::is_sys_time<Value>)
+    {
+        set_time(std::chrono::floor<typename Value::duration>(time));
+    }
+    explicit TimeImpl(BerView view) noexcept { decode(view); }
+    ~TimeImpl() noexcept = default;
+
+    TimeImpl& operator=(const TimeImpl&) noexcept = default;
+    TimeImpl& operator=(TimeImpl&&) noexcept = default;
+
+    void set_time(const Value& time) noexcept { assign(time, detail::TimeZone{}); }
+    // Written as the local time at an offset of up to +-23:59 from UTC, such as 20190319230942+0200
+    void set_time(const Value& time, int timezone_offset_minutes) noexcept requires(Format::has_time_zone);
+    // Written without a time zone, such as 20190319230942
+    template <typename Duration>
+    void set_time(std::chrono::local_time<Duration> time) noexcept requires(Format::has_local_time);
+
+    // Local times, whose time zone is unknown, are returned as if they were UTC
+    Value            time() const noexcept;
+    TimeFormat       format() const noexcept requires(Format::has_time_zone);
+    std::string_view string() const noexcept
+    {
+        return std::string_view(reinterpret_cast<const char*>(m_contents.content_data()), m_contents.content_length());
+    }
+
+    size_t       encoded_length() const noexcept { return m_contents.ber_length(); }
+    EncodeResult encode(std::span<uint8_t> output) const noexcept { return m_contents.encode(output); }
+    DecodeResult decode(BerView input) noexcept;
+
+    using AsnId = Identifier;
+
+  private:
+    void assign(const Value& time, const detail::TimeZone& zone) noexcept;
+
+    FixedIdBerContainer<Identifier, detail::time_inline_length> m_contents;
+};
+
+template <typename Format, typename Identifier>
+bool operator==(const TimeImpl<Format, Identifier>& lhs, const TimeImpl<Format, Identifier>& rhs) noexcept
+{
+    return lhs.time() == rhs.time();
+}
+
+template <typename Format, typename Identifier>
+bool operator!=(const TimeImpl<Format, Identifier>& lhs, const TimeImpl<Format, Identifier>& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+template <typename Format, typename Identifier>
+void TimeImpl<Format, Identifier>::set_time(const Value& time, int timezone_offset_minutes) noexcept
+    requires(Format::has_time_zone)
+{
+    assign(time, detail::TimeZone{TimeFormat::universal_with_timezone,
+                                  std::clamp(timezone_offset_minutes, -detail::max_timezone_offset_minutes,
+                                             detail::max_timezone_offset_minutes)});
+}
+
+template <typename Format, typename Identifier>
+template <typename Duration>
+void TimeImpl<Format, Identifier>::set_time(std::chrono::local_time<Duration> time) noexcept
+    requires(Format::has_local_time)
+{
+    assign(Value(std::chrono::floor<typename Value::duration>(time.time_since_epoch())),
+           detail::TimeZone{TimeFormat::local, 0});
+}
+
+template <typename Format, typename Identifier>
+typename TimeImpl<Format, Identifier>::Value TimeImpl<Format, Identifier>::time() const noexcept
+{
+    Value            time{};
+    detail::TimeZone zone;
+    Format::read(string(), time, zone);
+    return time;
+}
+
+template <typename Format, typename Identifier>
+TimeFormat TimeImpl<Format, Identifier>::format() const noexcept requires(Format::has_time_zone)
+{
+    Value            time{};
+    detail::TimeZone zone;
+    Format::read(string(), time, zone);
+    return zone.format;
+}
+
+template <typename Format, typename Identifier>
+DecodeResult TimeImpl<Format, Identifier>::decode(BerView input) noexcept
+{
+    // Decoded into a copy, so the value is unchanged when the contents are not a valid time
+    FixedIdBerContainer<Identifier, detail::time_inline_length> contents;
+    const DecodeResult                                          result = contents.decode(input);
+    if (!result.success)
+    {
+        return result;
+    }
+
+    const std::string_view content(reinterpret_cast<const char*>(contents.content_data()), contents.content_length());
+    Value                  time{};
+    detail::TimeZone       zone;
+    if (!Format::read(content, time, zone))
+    {
+        return DecodeResult{false, DecodeError::invalid_content};
+    }
+    m_contents = std::move(contents);
+    return result;
+}
+
+template <typename Format, typename Identifier>
+void TimeImpl<Format, Identifier>::assign(const Value& time, const detail::TimeZone& zone) noexcept
+{
+    std::array<char, Format::max_length> buffer;
+    const size_t                         length = Format::write(time, zone, buffer.data());
+    m_contents.assign_content(std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(buffer.data()), length));
+}
+
+template <typename Format, typename Identifier>
+std::ostream& operator<<(std::ostream& os, const TimeImpl<Format, Identifier>& time)
+{
+    return os << time.string();
+}
+
+} // namespace fast_ber
@@ -1,9 +1,63 @@
 #pragma once
 
-#include "fast_ber/ber_types/GeneralizedTime.hpp"
+#include "fast_ber/ber_types/Tag.hpp"
+#include "fast_ber/ber_types/TimeImpl.hpp"
 
 namespace fast_ber
 {
-template <typename Identifier = ExplicitId<UniversalTag::utc_time>>
-using TimeOfDay = GeneralizedTime<Identifier>;
+
+namespace detail
+{
+
+inline void write_time_of_day(std::chrono::seconds time, char* output) noexcept
+{
+    const std::chrono::hh_mm_ss<std::chrono::seconds> time_of_day(time);
+    write_digits(output, static_cast<int>(time_of_day.hours().count()), 2);
+    output[2] = ':';
+    write_digits(output + 3, static_cast<int>(time_of_day.minutes().count()), 2);
+    output[5] = ':';
+    write_digits(output + 6, static_cast<int>(time_of_day.seconds().count()), 2);
+}
+
+// Input must hold at least the 8 characters of HH:MM:SS
+inline bool read_time_of_day(const char* input, std::chrono::seconds& time) noexcept
+{
+    int hours   = 0;
+    int minutes = 0;
+    int seconds = 0;
+    if (!read_digits(input, 2, hours) || input[2] != ':' || !read_digits(input + 3, 2, minutes) || input[5] != ':' ||
+        !read_digits(input + 6, 2, seconds) || hours > 23 || minutes > 59 || seconds > 59)
+    {
+        return false;
+    }
+    time = std::chrono::hours(hours) + std::chrono::minutes(minutes) + std::chrono::seconds(seconds);
+    return true;
+}
+
+// HH:MM:SS, the value is the time since midnight and is limited to a single day
+struct TimeOfDayFormat
+{
+    using Value = std::chrono::seconds;
+
+    static constexpr size_t max_length     = 8;
+    static constexpr bool   has_time_zone  = false;
+    static constexpr bool   has_local_time = false;
+
+    static size_t write(std::chrono::seconds time, const TimeZone&, char* output) noexcept
+    {
+        write_time_of_day(std::clamp(time, std::chrono::seconds(0), std::chrono::seconds(86399)), output);
+        return max_length;
+    }
+
+    static bool read(std::string_view input, std::chrono::seconds& time, TimeZone&) noexcept
+    {
+        return input.size() == max_length && read_time_of_day(input.data(), time);
+    }
+};
+
+} // namespace detail
+
+template <typename Identifier = ExplicitId<UniversalTag::time_of_day>>
+using TimeOfDay = TimeImpl<detail::TimeOfDayFormat, Identifier>;
+
 } // namespace fast_ber
@@ -1,10 +1,74 @@
 #pragma once
 
-#include "fast_ber/ber_types/GeneralizedTime.hpp"
 #include "fast_ber/ber_types/Tag.hpp"
+#include "fast_ber/ber_types/TimeImpl.hpp"
 
 namespace fast_ber
 {
+
+namespace detail
+{
+
+// YYMMDDhhmm[ss](Z|(+|-)hhmm). Two digit years 50-99 are 1950-1999, 00-49 are 2000-2049. Written with seconds, and
+// without a fraction of a second, which cannot be represented
+struct UTCTimeFormat
+{
+    using Value = TimePoint;
+
+    static constexpr size_t max_length     = 17; // YYMMDDhhmmss+hhmm
+    static constexpr bool   has_time_zone  = true;
+    static constexpr bool   has_local_time = false;
+    static constexpr bool   hour_offsets   = false; // Offsets are always hhmm
+
+    static size_t write(TimePoint time, const TimeZone& zone, char* output) noexcept
+    {
+        const CivilTime civil = to_civil(clamp_years(time + std::chrono::minutes(zone.offset_minutes), 1950, 2049));
+        write_digits(output, civil.year % 100, 2);
+        write_digits(output + 2, civil.month, 2);
+        write_digits(output + 4, civil.day, 2);
+        write_digits(output + 6, civil.hour, 2);
+        write_digits(output + 8, civil.minute, 2);
+        write_digits(output + 10, civil.second, 2);
+        return 12 + write_time_zone(output + 12, zone);
+    }
+
+    static bool read(std::string_view input, TimePoint& time, TimeZone& zone) noexcept
+    {
+        const char*       position = input.data();
+        const char* const end      = position + input.size();
+
+        CivilTime civil;
+        if (input.size() < 11 || !read_digits(position, 2, civil.year) || !read_digits(position + 2, 2, civil.month) ||
+            !read_digits(position + 4, 2, civil.day) || !read_digits(position + 6, 2, civil.hour) ||
+            !read_digits(position + 8, 2, civil.minute))
+        {
+            return false;
+        }
+        position += 10;
+        civil.year += civil.year < 50 ? 2000 : 1900;
+
+        if (end - position >= 2 && is_digit(*position))
+        {
+            if (!read_digits(position, 2, civil.second))
+            {
+                return false;
+            }
+            position += 2;
+        }
+
+        if (!read_time_zone(position, end, zone, hour_offsets) || zone.format == TimeFormat::local ||
+            !from_civil(civil, time))
+        {
+            return false;
+        }
+        time -= std::chrono::minutes(zone.offset_minutes);
+        return true;
+    }
+};
+
+} // namespace detail
+
 template <typename Identifier = ExplicitId<UniversalTag::utc_time>>
-using UTCTime = GeneralizedTime<Identifier>;
+using UTCTime = TimeImpl<detail::UTCTimeFormat, Identifier>;
+
 } // namespace fast_ber
@@ -5,6 +5,6 @@
 
 namespace fast_ber
 {
-template <typename Identifier = ExplicitId<UniversalTag::universal_string>>
-using UniversalString = fast_ber::StringImpl<UniversalTag::universal_string, Identifier>;
+template <typename Identifier = ExplicitId<UniversalTag::universal_string>, StorageMode storage = StorageMode::dynamic>
+using UniversalString = fast_ber::StringImpl<UniversalTag::universal_string, Identifier, storage>;
 }
@@ -5,6 +5,6 @@
 
 namespace fast_ber
 {
-template <typename Identifier = ExplicitId<UniversalTag::visible_string>>
-using VisibleString = fast_ber::StringImpl<UniversalTag::visible_string, Identifier>;
+template <typename Identifier = ExplicitId<UniversalTag::visible_string>, StorageMode storage = StorageMode::dynamic>
+using VisibleString = fast_ber::StringImpl<UniversalTag::visible_string, Identifier, storage>;
 }
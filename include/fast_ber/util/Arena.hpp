@@ -0,0 +1,191 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace fast_ber
+{
+
+// Memory owned by fast_ber types (SequenceOf, Optional and Choice of dynamic storage, and the contents of
+// FixedIdBerContainer and BerContainer) is allocated through ArenaAllocator. By default this is the global heap.
+// Objects constructed on a thread while an ArenaScope is active take their storage from its memory resource instead,
+// so a decoded message can be released with a single Arena::reset().
+//
+// Each object keeps the resource it was constructed with, so storage is always returned to the right place whichever
+// scope is active when it is freed. Moving assigns the resource of the source along with its storage, while copies take
+// the resource of the scope active when they are made. Memory taken from an arena must not be used after the arena is
+// reset or destroyed.
+
+namespace detail
+{
+
+inline thread_local std::pmr::memory_resource* current_memory_resource = nullptr;
+
+// Without a resource memory is taken directly from the global heap
+inline void* arena_allocate(std::pmr::memory_resource* resource, size_t size, size_t alignment)
+{
+    if (resource != nullptr)
+    {
+        return resource->allocate(size, alignment);
+    }
+    if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+    {
+        return ::operator new(size);
+    }
+    return ::operator new(size, std::align_val_t(alignment));
+}
+
+inline void arena_deallocate(std::pmr::memory_resource* resource, void* memory, size_t size, size_t alignment) noexcept
+{
+    if (resource != nullptr)
+    {
+        resource->deallocate(memory, size, alignment);
+    }
+    else if (alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+    {
+        ::operator delete(memory, size);
+    }
+    else
+    {
+        ::operator delete(memory, size, std::align_val_t(alignment));
+    }
+}
+
+} // namespace detail
+
+// Memory resource of the active ArenaScope of the calling thread, nullptr for the global heap
+inline std::pmr::memory_resource* current_arena_resource() noexcept { return detail::current_memory_resource; }
+
+// Allocator taking memory from the resource of the ArenaScope active on the calling thread when it was constructed,
+// or from the global heap
+template <typename T>
+class ArenaAllocator
+{
+  public:
+    using value_type                             = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+
+    ArenaAllocator() noexcept : m_resource(current_arena_resource()) {}
+    explicit ArenaAllocator(std::pmr::memory_resource* resource) noexcept : m_resource(resource) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& rhs) noexcept : m_resource(rhs.resource())
+    {
+    }
+
+    T* allocate(size_t n) { return static_cast<T*>(detail::arena_allocate(m_resource, n * sizeof(T), alignof(T))); }
+    void deallocate(T* p, size_t n) noexcept { detail::arena_deallocate(m_resource, p, n * sizeof(T), alignof(T)); }
+
+    // Copies of a container take memory from the scope active when they are made
+    ArenaAllocator select_on_container_copy_construction() const noexcept { return ArenaAllocator(); }
+
+    std::pmr::memory_resource* resource() const noexcept { return m_resource; }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& rhs) const noexcept
+    {
+        return m_resource == rhs.resource();
+    }
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& rhs) const noexcept
+    {
+        return m_resource != rhs.resource();
+    }
+
+  private:
+    std::pmr::memory_resource* m_resource;
+};
+
+// Create and destroy single objects, with memory taken from resource as by ArenaAllocator
+template <typename T, typename... Args>
+T* arena_new(std::pmr::memory_resource* resource, Args&&... args)
+{
+    void* const memory = detail::arena_allocate(resource, sizeof(T), alignof(T));
+    try
+    {
+        return ::new (memory) T(std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        detail::arena_deallocate(resource, memory, sizeof(T), alignof(T));
+        throw;
+    }
+}
+
+template <typename T>
+void arena_delete(std::pmr::memory_resource* resource, T* t) noexcept
+{
+    if (t != nullptr)
+    {
+        t->~T();
+        detail::arena_deallocate(resource, t, sizeof(T), alignof(T));
+    }
+}
+
+// Deleter of objects created by arena_new, keeping the resource of the scope active when it was constructed
+template <typename T>
+class ArenaDeleter
+{
+  public:
+    ArenaDeleter() noexcept : m_resource(current_arena_resource()) {}
+
+    void operator()(T* t) const noexcept { arena_delete(m_resource, t); }
+
+    std::pmr::memory_resource* resource() const noexcept { return m_resource; }
+
+  private:
+    std::pmr::memory_resource* m_resource;
+};
+
+// Monotonic memory resource for the types decoded from one message. Allocation is a pointer increment, freeing an
+// individual object is a no-op, and all memory is released at once by reset(). The initial block is owned by the
+// arena, further blocks are taken from the upstream resource as required.
+class Arena
+{
+  public:
+    constexpr static size_t default_initial_size = 64 * 1024;
+
+    explicit Arena(size_t                     initial_size = default_initial_size,
+                   std::pmr::memory_resource* upstream     = std::pmr::get_default_resource())
+        : m_buffer(std::make_unique_for_overwrite<std::byte[]>(initial_size)),
+          m_resource(m_buffer.get(), initial_size, upstream)
+    {
+    }
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    // Release all memory taken from the arena. Objects allocated from the arena must be destroyed, or no longer used,
+    // beforehand
+    void reset() noexcept { m_resource.release(); }
+
+    std::pmr::memory_resource& resource() noexcept { return m_resource; }
+
+  private:
+    std::unique_ptr<std::byte[]>        m_buffer;
+    std::pmr::monotonic_buffer_resource m_resource;
+};
+
+// Direct the allocations of fast_ber types made on this thread to an arena (or any memory resource) for the lifetime
+// of the scope. Scopes may be nested, the previous resource is restored on destruction.
+class ArenaScope
+{
+  public:
+    explicit ArenaScope(Arena& arena) noexcept : ArenaScope(arena.resource()) {}
+    explicit ArenaScope(std::pmr::memory_resource& resource) noexcept
+        : m_previous(std::exchange(detail::current_memory_resource, &resource))
+    {
+    }
+    ArenaScope(const ArenaScope&) = delete;
+    ArenaScope& operator=(const ArenaScope&) = delete;
+    ~ArenaScope() noexcept { detail::current_memory_resource = m_previous; }
+
+  private:
+    std::pmr::memory_resource* m_previous;
+};
+
+} // namespace fast_ber
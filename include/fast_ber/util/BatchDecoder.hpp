@@ -0,0 +1,212 @@
+#pragma once
+
+#include "fast_ber/ber_types/Identifier.hpp"
+#include "fast_ber/util/BerView.hpp"
+#include "fast_ber/util/DecodeHelpers.hpp"
+#include "fast_ber/util/Extract.hpp"
+
+#include <algorithm>
+#include <span>
+#include <vector>
+
+#include <cstdint>
+
+namespace fast_ber
+{
+
+// Range of input which could not be decoded as a record
+struct BatchDecodeError
+{
+    size_t offset;
+    size_t length;
+
+    bool operator==(const BatchDecodeError&) const = default;
+};
+
+// Decodes a buffer of concatenated top level records of type T, such as a file of CDRs, in order.
+// A record which is a well formed packet but fails to decode is skipped as a whole. Where no well formed packet can
+// be read, the decoder resynchronizes by scanning forward for the next offset holding a packet with the identifier of
+// T which is followed by another packet or by the end of the input. Only the identifier and length octets of each
+// offset are read while scanning, and records of indefinite length are not taken as resynchronization points, as
+// their end could only be found by walking their content. Each skipped range is reported as an error, consecutive
+// skipped ranges are merged. The input must outlive the decoder.
+template <typename T>
+class BatchDecoder
+{
+  public:
+    BatchDecoder() noexcept = default;
+    explicit BatchDecoder(std::span<const uint8_t> input) noexcept : m_input(input) {}
+
+    // Decode the next record into output, which may be reused between calls. Return false once the input is exhausted
+    bool next(T& output)
+    {
+        return next_impl([&output](BerView packet) { return output.decode(packet).success; });
+    }
+
+    // Locate the next record without decoding it, for example to construct a View. Records are only checked to be
+    // well formed packets with the identifier of T
+    bool next_packet(BerView& packet)
+    {
+        return next_impl([&packet](BerView candidate) {
+            packet = candidate;
+            return true;
+        });
+    }
+
+    size_t                   record_offset() const noexcept { return m_record_offset; } // Of the last record read
+    size_t                   offset() const noexcept { return m_offset; } // From which the next record is read
+    size_t                   records() const noexcept { return m_records; }
+    bool                     at_end() const noexcept { return m_offset >= m_input.size(); }
+    std::span<const uint8_t> input() const noexcept { return m_input; }
+
+    const std::vector<BatchDecodeError>& errors() const noexcept { return m_errors; }
+    void                                 clear_errors() noexcept { m_errors.clear(); }
+
+  private:
+    struct Header
+    {
+        Class  class_         = Class::universal;
+        Tag    tag            = 0;
+        size_t length         = 0; // Of the identifier and length octets
+        size_t content_length = 0;
+        bool   indefinite     = false;
+    };
+
+    // Longer identifiers overflow Tag
+    static constexpr size_t max_header_length = 32;
+
+    template <typename Accept>
+    bool next_impl(Accept&& accept);
+
+    bool   read_header(size_t offset, Header& header) const noexcept;
+    bool   is_record_start(size_t offset) const noexcept;
+    size_t resynchronize(size_t offset) const noexcept;
+    void   add_error(size_t offset, size_t length);
+
+    std::span<const uint8_t>      m_input;
+    size_t                        m_offset        = 0;
+    size_t                        m_record_offset = 0;
+    size_t                        m_records       = 0;
+    std::vector<BatchDecodeError> m_errors;
+};
+
+template <typename T>
+template <typename Accept>
+bool BatchDecoder<T>::next_impl(Accept&& accept)
+{
+    while (m_offset < m_input.size())
+    {
+        // Read once, a packet without length could otherwise never be passed
+        const BerView packet(m_input.subspan(m_offset));
+        const size_t  length = packet.is_valid() ? packet.ber_length() : 0;
+        if (length != 0)
+        {
+            const size_t offset = m_offset;
+            m_offset += length;
+            if (Identifier<T>::check_id_match(packet.class_(), packet.tag()) && accept(packet))
+            {
+                m_record_offset = offset;
+                m_records++;
+                return true;
+            }
+            add_error(offset, length);
+        }
+        else
+        {
+            const size_t next = resynchronize(m_offset);
+            add_error(m_offset, next - m_offset);
+            m_offset = next;
+        }
+    }
+    return false;
+}
+
+template <typename T>
+bool BatchDecoder<T>::read_header(size_t offset, Header& header) const noexcept
+{
+    const std::span<const uint8_t> input = m_input.subspan(offset, std::min(m_input.size() - offset, max_header_length));
+
+    const size_t tag_length = extract_tag(input, header.tag);
+    if (tag_length == 0)
+    {
+        return false;
+    }
+    const size_t length_length = extract_length(input, header.content_length, tag_length, header.indefinite);
+    if (length_length == 0)
+    {
+        return false;
+    }
+    header.class_ = get_class(input[0]);
+    header.length = tag_length + length_length;
+    return true;
+}
+
+// Costs the reading of two headers, however the input continues
+template <typename T>
+bool BatchDecoder<T>::is_record_start(size_t offset) const noexcept
+{
+    Header header;
+    if (!read_header(offset, header) || header.indefinite ||
+        !Identifier<T>::check_id_match(header.class_, header.tag) ||
+        header.content_length > m_input.size() - offset - header.length)
+    {
+        return false;
+    }
+
+    const size_t end = offset + header.length + header.content_length;
+    if (end == m_input.size())
+    {
+        return true;
+    }
+
+    Header next;
+    return read_header(end, next) &&
+           (next.indefinite || next.content_length <= m_input.size() - end - next.length);
+}
+
+template <typename T>
+size_t BatchDecoder<T>::resynchronize(size_t offset) const noexcept
+{
+    for (size_t candidate = offset + 1; candidate < m_input.size(); candidate++)
+    {
+        if (is_record_start(candidate))
+        {
+            return candidate;
+        }
+    }
+    return m_input.size();
+}
+
+template <typename T>
+void BatchDecoder<T>::add_error(size_t offset, size_t length)
+{
+    if (!m_errors.empty() && m_errors.back().offset + m_errors.back().length == offset)
+    {
+        m_errors.back().length += length;
+        return;
+    }
+    m_errors.push_back(BatchDecodeError{offset, length});
+}
+
+// Summary of a call to decode_batch
+struct BatchDecodeResult
+{
+    size_t                        records;
+    std::vector<BatchDecodeError> errors;
+};
+
+// Decode each record of type T in the input, calling function(const T& record, size_t offset) for each in order.
+// A single T is reused for every record
+template <typename T, typename Function>
+BatchDecodeResult decode_batch(std::span<const uint8_t> input, Function&& function)
+{
+    BatchDecoder<T> decoder(input);
+    T               record;
+    while (decoder.next(record))
+    {
+        function(static_cast<const T&>(record), decoder.record_offset());
+    }
+    return BatchDecodeResult{decoder.records(), decoder.errors()};
+}
+
+} // namespace fast_ber
@@ -1,5 +1,6 @@
 ﻿#pragma once
 
+#include "fast_ber/util/Arena.hpp"
 #include "fast_ber/util/BerView.hpp"
 #include "fast_ber/util/DecodeHelpers.hpp"
 #include "fast_ber/util/EncodeHelpers.hpp"
@@ -66,8 +67,8 @@ class BerContainer
     DecodeResult decode(const BerView input_data) noexcept;
 
   private:
-    std::vector<uint8_t> m_data;
-    MutableBerView                     m_view;
+    std::vector<uint8_t, ArenaAllocator<uint8_t>> m_data;
+    MutableBerView                                m_view;
 };
 
 inline BerContainer::BerContainer() noexcept
@@ -101,14 +102,16 @@ inline BerContainer::BerContainer(Construction input_construction, Class input_c
 inline BerContainer& BerContainer::operator=(const BerContainer& container) noexcept
 {
     m_data = container.m_data;
-    m_view.assign(m_data, container.tag(), container.header_length(), container.content_length());
+    m_view.assign(m_data, container.tag(), container.header_length(), container.content_length(),
+                  container.view().is_indefinite_length());
     return *this;
 }
 
 inline BerContainer& BerContainer::operator=(BerContainer&& container) noexcept
 {
     m_data = std::move(container.m_data);
-    m_view.assign(m_data, container.tag(), container.header_length(), container.content_length());
+    m_view.assign(m_data, container.tag(), container.header_length(), container.content_length(),
+                  container.view().is_indefinite_length());
     return *this;
 }
 
@@ -169,12 +172,12 @@ inline DecodeResult BerContainer::decode(const BerView input_view) noexcept
         m_data = {};
         m_view.assign(std::span<uint8_t>(m_data));
         assert(!m_view.is_valid());
-        return DecodeResult{false};
+        return DecodeResult{false, DecodeError::invalid_packet};
     }
 
     m_data.assign(input_view.ber().begin(), input_view.ber().end());
     m_view.assign(std::span(m_data.data(), m_data.size()), input_view.tag(), input_view.header_length(),
-                  input_view.content_length());
+                  input_view.content_length(), input_view.is_indefinite_length());
 
     return DecodeResult{true};
 }
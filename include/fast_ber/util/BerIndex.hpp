@@ -0,0 +1,209 @@
+#pragma once
+
+#include "fast_ber/util/BerView.hpp"
+#include "fast_ber/util/Extract.hpp"
+
+#include <span>
+#include <vector>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+namespace fast_ber
+{
+
+// Location of a single packet within an indexed buffer
+struct BerIndexEntry
+{
+    uint32_t offset;           // Offset of the identifier octets from the start of the buffer
+    uint32_t content_length;   // Excludes the end-of-contents octets of indefinite length packets
+    uint32_t tag;
+    uint32_t next;             // Index of the first entry after this packet and all of its children
+    uint16_t depth;            // Zero for top level packets
+    uint8_t  header_length;    // Also content offset, relative to offset
+    uint8_t  identifier_octet; // First identifier octet, holds class and construction
+    bool     indefinite_length;
+
+    Class        class_() const noexcept { return get_class(identifier_octet); }
+    Construction construction() const noexcept { return get_construction(identifier_octet); }
+    size_t       content_offset() const noexcept { return size_t{offset} + header_length; }
+    size_t       ber_length() const noexcept
+    {
+        return size_t{header_length} + content_length + (indefinite_length ? BerView::end_of_contents_length : 0);
+    }
+};
+
+// Flat structural index ("tape") of every packet in a buffer, built in a single scan without recursion
+// Entries are stored depth first, each packet is immediately followed by its children. The buffer may contain
+// several concatenated top level packets, up to 4GiB in total. Views taken from the index do not parse any headers.
+class BerIndex
+{
+  public:
+    BerIndex() noexcept = default;
+    explicit BerIndex(std::span<const uint8_t> input) { build(input); }
+
+    // Index the provided buffer, which must outlive the index
+    // Return true if the whole buffer consists of well formed packets, on failure the index is not valid
+    bool build(std::span<const uint8_t> input);
+
+    bool                            is_valid() const noexcept { return m_valid; }
+    size_t                          size() const noexcept { return m_size; }
+    bool                            empty() const noexcept { return m_size == 0; }
+    const BerIndexEntry&            operator[](size_t index) const noexcept { return m_entries[index]; }
+    std::span<const BerIndexEntry> entries() const noexcept { return std::span(m_entries).first(m_size); }
+    std::span<const uint8_t>       buffer() const noexcept { return m_buffer; }
+
+    // Navigation, a result equal to next_sibling(parent) indicates there are no more children
+    size_t first_child(size_t index) const noexcept { return index + 1; }
+    size_t next_sibling(size_t index) const noexcept { return m_entries[index].next; }
+
+    BerView view(size_t index) const noexcept;
+
+  private:
+    struct OpenPacket
+    {
+        size_t index;
+        size_t end; // End of the content for definite length packets, otherwise the limit inherited from the parent
+        bool   indefinite_length;
+    };
+
+    // Entries are written through a raw pointer, storing via the vector forces its end pointer to be reloaded after
+    // every octet read from the buffer. Storage is kept between builds, only the first m_size entries are in use.
+    std::span<const uint8_t>  m_buffer;
+    std::vector<BerIndexEntry> m_entries;
+    size_t                     m_size = 0;
+    std::vector<OpenPacket>    m_open;
+    bool                       m_valid = false;
+};
+
+inline bool BerIndex::build(std::span<const uint8_t> input)
+{
+    m_buffer = input;
+    m_size   = 0;
+    m_open.clear();
+    m_valid = false;
+
+    if (input.size() > std::numeric_limits<uint32_t>::max())
+    {
+        return false;
+    }
+
+    const uint8_t* data    = input.data();
+    BerIndexEntry* entries = m_entries.data();
+    size_t         size    = 0;
+    size_t         offset  = 0;
+    size_t         limit   = input.size();
+    while (true)
+    {
+        // Close any constructed packets ending at the current offset
+        while (!m_open.empty())
+        {
+            const OpenPacket& open = m_open.back();
+            if (open.indefinite_length)
+            {
+                if (offset + BerView::end_of_contents_length > open.end || data[offset] != 0x00 ||
+                    data[offset + 1] != 0x00)
+                {
+                    break;
+                }
+                BerIndexEntry& entry = entries[open.index];
+                entry.content_length = static_cast<uint32_t>(offset - entry.content_offset());
+                offset += BerView::end_of_contents_length;
+            }
+            else if (offset != open.end)
+            {
+                break;
+            }
+
+            entries[open.index].next = static_cast<uint32_t>(size);
+            m_open.pop_back();
+            limit = m_open.empty() ? input.size() : m_open.back().end;
+        }
+
+        if (offset == limit)
+        {
+            // Reaching the limit of an indefinite length packet means its end-of-contents octets are missing
+            if (!m_open.empty())
+            {
+                return false;
+            }
+            m_size  = size;
+            m_valid = true;
+            return true;
+        }
+
+        if (size == m_entries.size())
+        {
+            if (size >= std::numeric_limits<uint32_t>::max())
+            {
+                return false;
+            }
+            m_entries.resize(std::max(size * 2, size_t{64}));
+            entries = m_entries.data();
+        }
+
+        // Short form headers, a low tag number and a single length octet, are by far the most common. They are
+        // decoded from two octets without branching on each octet, other forms use the general extraction functions
+        const size_t available      = limit - offset;
+        size_t       tag_length     = 1;
+        size_t       length_length  = 1;
+        Tag          tag            = data[offset] & 0x1F;
+        size_t       content_length = available > 1 ? data[offset + 1] : 0x80;
+        bool         indefinite     = false;
+        if (tag == 0x1F || content_length >= 0x80)
+        {
+            const auto header = std::span(data + offset, available);
+            tag_length        = extract_tag(header, tag);
+            length_length     = (tag_length == 0) ? 0 : extract_length(header, content_length, tag_length, indefinite);
+            if (length_length == 0 || tag > std::numeric_limits<uint32_t>::max())
+            {
+                return false;
+            }
+        }
+
+        const size_t header_length = tag_length + length_length;
+        const bool   constructed   = get_construction(data[offset]) == Construction::constructed;
+        if (indefinite ? !constructed : content_length > available - header_length)
+        {
+            return false;
+        }
+
+        const size_t index = size++;
+        entries[index]     = BerIndexEntry{static_cast<uint32_t>(offset),
+                                       static_cast<uint32_t>(indefinite ? 0 : content_length),
+                                       static_cast<uint32_t>(tag),
+                                       static_cast<uint32_t>(index + 1),
+                                       static_cast<uint16_t>(m_open.size()),
+                                       static_cast<uint8_t>(header_length),
+                                       data[offset],
+                                       indefinite};
+
+        offset += header_length;
+        if (constructed)
+        {
+            if (m_open.size() == std::numeric_limits<uint16_t>::max())
+            {
+                return false;
+            }
+            if (!indefinite)
+            {
+                limit = offset + content_length;
+            }
+            m_open.push_back(OpenPacket{index, limit, indefinite});
+        }
+        else
+        {
+            offset += content_length;
+        }
+    }
+}
+
+inline BerView BerIndex::view(size_t index) const noexcept
+{
+    const BerIndexEntry& entry = m_entries[index];
+    return BerView(m_buffer.subspan(entry.offset), entry.tag, entry.header_length, entry.content_length,
+                   entry.indefinite_length);
+}
+
+} // namespace fast_ber
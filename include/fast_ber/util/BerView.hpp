@@ -27,13 +27,13 @@ class BerView
     BerView(std::span<const uint8_t> input_ber_data) noexcept { assign(input_ber_data); }
     BerView(std::span<const uint8_t> input_ber_data, size_t input_header_length, size_t input_content_length) noexcept;
     BerView(std::span<const uint8_t> input_ber_data, Tag input_tag, size_t input_header_length,
-            size_t content_length) noexcept;
+            size_t content_length, bool input_indefinite_length = false) noexcept;
 
     void assign(std::span<const uint8_t> input_ber_data) noexcept;
     void assign(std::span<const uint8_t> input_ber_data, size_t input_header_length,
                 size_t input_content_length) noexcept;
     void assign(std::span<const uint8_t> input_ber_data, Tag input_tag, size_t input_header_length,
-                size_t content_length) noexcept;
+                size_t content_length, bool input_indefinite_length = false) noexcept;
 
     bool         is_valid() const noexcept { return m_data != nullptr; }
     Construction construction() const noexcept { return get_construction(m_data[0]); }
@@ -42,24 +42,59 @@ class BerView
     Tag          tag() const noexcept { return m_tag; }
     size_t       identifier_length() const noexcept { return encoded_tag_length(tag()); }
     size_t       header_length() const noexcept { return m_header_length; }
+    bool         is_indefinite_length() const noexcept { return m_indefinite_length; }
 
-    std::span<const uint8_t> content() const noexcept { return std::span(content_data(), m_content_length); }
+    // The end-of-contents octets of an indefinite length packet are located on the first call to content(),
+    // content_length(), ber_length() or ber(), which is not thread safe. If they are missing the view becomes invalid
+    std::span<const uint8_t> content() const noexcept;
     const uint8_t*            content_data() const noexcept { return m_data + m_header_length; }
-    size_t                    content_length() const noexcept { return m_content_length; }
-    std::span<const uint8_t> ber() const noexcept { return std::span(ber_data(), ber_length()); }
+    size_t                    content_length() const noexcept
+    {
+        locate_end();
+        return m_content_length;
+    }
+    std::span<const uint8_t> ber() const noexcept;
     const uint8_t*            ber_data() const noexcept { return m_data; }
-    size_t                    ber_length() const noexcept { return m_header_length + m_content_length; }
+    size_t                    ber_length() const noexcept
+    {
+        locate_end();
+        return m_header_length + m_content_length + (m_indefinite_length ? end_of_contents_length : 0);
+    }
 
     BerViewIterator begin() const noexcept;
     BerViewIterator end() const noexcept;
 
+    // Whether the content ends after the given length, as found by iterating the elements. Iteration of an indefinite
+    // length packet ends at its end-of-contents octets, which locates them without searching the content again
+    bool ends_after(size_t length) const noexcept;
+
     EncodeResult encode(std::span<uint8_t> buffer) const noexcept;
 
+    static constexpr size_t end_of_contents_length = 2;
+
+  protected:
+    // Length of the content to iterate, until located the end of an indefinite length packet is the end-of-contents
+    // octets found while iterating
+    size_t iterated_length() const noexcept { return m_content_length; }
+    bool   end_located() const noexcept { return m_end_located; }
+
   private:
-    const uint8_t* m_data           = nullptr;
-    Tag            m_tag            = 0;
-    size_t         m_header_length  = 0; // Also content offset
-    size_t         m_content_length = 0;
+    void locate_end() const noexcept
+    {
+        if (!m_end_located)
+        {
+            locate_end_of_contents();
+        }
+    }
+    void locate_end_of_contents() const noexcept;
+
+    // Members other than the tag are updated when the end of an indefinite length packet is located
+    mutable const uint8_t* m_data              = nullptr;
+    Tag                    m_tag               = 0;
+    mutable size_t         m_header_length     = 0; // Also content offset
+    mutable size_t         m_content_length    = 0; // Excludes end-of-contents octets, until located all that fits
+    mutable bool           m_indefinite_length = false;
+    mutable bool           m_end_located       = true;
 };
 
 class MutableBerView : public BerView
@@ -84,20 +119,30 @@ class MutableBerView : public BerView
     std::span<const uint8_t> content() const noexcept { return BerView::content(); }
 };
 
+// Iterates the packets in a buffer. Within the content of an indefinite length packet iteration ends at the
+// end-of-contents octets, so the content may be iterated before its length is known
 class BerViewIterator
 {
   public:
-    BerViewIterator(std::span<const uint8_t> buffer) noexcept : m_buffer(buffer), m_view(buffer) {}
+    BerViewIterator(std::span<const uint8_t> buffer, bool until_end_of_contents = false) noexcept
+        : m_buffer(buffer), m_until_end_of_contents(until_end_of_contents)
+    {
+        assign_view();
+    }
     BerViewIterator(End) noexcept : m_buffer(), m_view() {}
 
     BerViewIterator& operator++() noexcept
     {
-        if (!m_view.is_valid())
+        // A view without a length, invalid or found to be unterminated, ends iteration rather than advance by zero
+        const size_t length = m_view.ber_length();
+        if (length == 0)
         {
-            assert(m_view.ber_length() == 0);
+            m_buffer = {};
+            m_view   = BerView();
+            return *this;
         }
-        m_buffer = m_buffer.subspan(m_view.ber_length());
-        m_view.assign(m_buffer);
+        m_buffer = m_buffer.subspan(length);
+        assign_view();
 
         return *this;
     }
@@ -126,24 +171,43 @@ class BerViewIterator
     using iterator_category = std::forward_iterator_tag;
 
   private:
+    void assign_view() noexcept
+    {
+        if (m_until_end_of_contents && is_end_of_contents(m_buffer))
+        {
+            m_view = BerView();
+            return;
+        }
+        m_view.assign(m_buffer);
+    }
+
     std::span<const uint8_t> m_buffer;
     BerView                   m_view;
+    bool                      m_until_end_of_contents = false;
 };
 
 class MutableBerViewIterator
 {
   public:
-    MutableBerViewIterator(std::span<uint8_t> buffer) noexcept : m_buffer(buffer), m_view(buffer) {}
+    MutableBerViewIterator(std::span<uint8_t> buffer, bool until_end_of_contents = false) noexcept
+        : m_buffer(buffer), m_until_end_of_contents(until_end_of_contents)
+    {
+        assign_view();
+    }
     MutableBerViewIterator(End) noexcept : m_buffer(), m_view() {}
 
     MutableBerViewIterator& operator++() noexcept
     {
-        if (!m_view.is_valid())
+        // A view without a length, invalid or found to be unterminated, ends iteration rather than advance by zero
+        const size_t length = m_view.ber_length();
+        if (length == 0)
         {
-            assert(m_view.ber_length() == 0);
+            m_buffer = {};
+            m_view   = MutableBerView();
+            return *this;
         }
-        m_buffer = m_buffer.subspan(m_view.ber_length());
-        m_view.assign(m_buffer);
+        m_buffer = m_buffer.subspan(length);
+        assign_view();
 
         return *this;
     }
@@ -175,8 +239,19 @@ class MutableBerViewIterator
     using iterator_category = std::forward_iterator_tag;
 
   private:
+    void assign_view() noexcept
+    {
+        if (m_until_end_of_contents && is_end_of_contents(m_buffer))
+        {
+            m_view = MutableBerView();
+            return;
+        }
+        m_view.assign(m_buffer);
+    }
+
     std::span<uint8_t> m_buffer;
     MutableBerView      m_view;
+    bool                m_until_end_of_contents = false;
 };
 
 inline BerView::BerView(std::span<const uint8_t> input_ber_data, size_t input_header_length,
@@ -186,31 +261,55 @@ inline BerView::BerView(std::span<const uint8_t> input_ber_data, size_t input_he
 }
 
 inline BerView::BerView(std::span<const uint8_t> input_ber_data, Tag input_tag, size_t input_header_length,
-                        size_t input_content_length) noexcept
+                        size_t input_content_length, bool input_indefinite_length) noexcept
 {
-    assign(input_ber_data, input_tag, input_header_length, input_content_length);
+    assign(input_ber_data, input_tag, input_header_length, input_content_length, input_indefinite_length);
 }
 
 inline void BerView::assign(std::span<const uint8_t> input_ber_data) noexcept
 {
     size_t input_content_length = 0;
+    bool   input_indefinite     = false;
+
+    size_t input_tag_length = extract_tag(input_ber_data, m_tag);
+    size_t input_len_length =
+        extract_length(input_ber_data, input_content_length, input_tag_length, input_indefinite);
+    size_t input_header_length = input_tag_length + input_len_length;
+
+    // The end of an indefinite length packet is located when first needed, until then the content is taken to extend
+    // to the end of the input
+    if (input_len_length != 0 && input_indefinite)
+    {
+        if (get_construction(input_ber_data[0]) != Construction::constructed ||
+            input_header_length + end_of_contents_length > input_ber_data.size())
+        {
+            input_len_length = 0;
+        }
+        else
+        {
+            input_content_length = input_ber_data.size() - input_header_length - end_of_contents_length;
+        }
+    }
 
-    size_t input_tag_length      = extract_tag(input_ber_data, m_tag);
-    size_t input_len_length      = extract_length(input_ber_data, input_content_length, input_tag_length);
-    size_t input_header_length   = input_tag_length + input_len_length;
-    size_t input_complete_length = input_header_length + input_content_length;
+    // Compared without overflow, the content length may be as large as SIZE_MAX
+    size_t input_frame_length = input_header_length + (input_indefinite ? end_of_contents_length : 0);
 
-    if (input_tag_length == 0 || input_len_length == 0 || input_complete_length > input_ber_data.size())
+    if (input_tag_length == 0 || input_len_length == 0 || input_frame_length > input_ber_data.size() ||
+        input_content_length > input_ber_data.size() - input_frame_length)
     {
-        m_header_length  = 0;
-        m_content_length = 0;
-        m_data           = nullptr;
+        m_header_length     = 0;
+        m_content_length    = 0;
+        m_indefinite_length = false;
+        m_end_located       = true;
+        m_data              = nullptr;
         return;
     }
 
-    m_data           = input_ber_data.data();
-    m_header_length  = input_header_length;
-    m_content_length = input_content_length;
+    m_data              = input_ber_data.data();
+    m_header_length     = input_header_length;
+    m_content_length    = input_content_length;
+    m_indefinite_length = input_indefinite;
+    m_end_located       = !input_indefinite;
 }
 
 inline void BerView::assign(std::span<const uint8_t> input_ber_data, size_t input_header_length,
@@ -221,21 +320,75 @@ inline void BerView::assign(std::span<const uint8_t> input_ber_data, size_t inpu
 }
 
 inline void BerView::assign(std::span<const uint8_t> input_ber_data, Tag input_tag, size_t input_header_length,
-                            size_t input_content_length) noexcept
+                            size_t input_content_length, bool input_indefinite_length) noexcept
 {
-    m_data           = input_ber_data.data();
-    m_header_length  = input_header_length;
-    m_content_length = input_content_length;
-    m_tag            = input_tag;
+    m_data              = input_ber_data.data();
+    m_header_length     = input_header_length;
+    m_content_length    = input_content_length;
+    m_indefinite_length = input_indefinite_length;
+    m_end_located       = true;
+    m_tag               = input_tag;
+}
+
+inline std::span<const uint8_t> BerView::content() const noexcept
+{
+    const size_t length = content_length();
+    return std::span(content_data(), length);
+}
+
+inline std::span<const uint8_t> BerView::ber() const noexcept
+{
+    const size_t length = ber_length();
+    return std::span(ber_data(), length);
+}
+
+inline void BerView::locate_end_of_contents() const noexcept
+{
+    m_end_located = true;
+
+    size_t length = 0;
+    if (!extract_indefinite_content_length(std::span(content_data(), m_content_length + end_of_contents_length),
+                                           length))
+    {
+        m_header_length     = 0;
+        m_content_length    = 0;
+        m_indefinite_length = false;
+        m_data              = nullptr;
+        return;
+    }
+    m_content_length = length;
+}
+
+inline bool BerView::ends_after(size_t length) const noexcept
+{
+    if (m_end_located)
+    {
+        return is_valid() && length == m_content_length;
+    }
+    if (length > m_content_length || !is_end_of_contents(std::span(content_data() + length, end_of_contents_length)))
+    {
+        return false;
+    }
+    m_content_length = length;
+    m_end_located    = true;
+    return true;
 }
 
-inline BerViewIterator        BerView::begin() const noexcept { return BerViewIterator{content()}; }
 inline BerViewIterator        BerView::end() const noexcept { return BerViewIterator{End::end}; }
 inline BerViewIterator        MutableBerView::cbegin() const noexcept { return BerView::begin(); }
 inline BerViewIterator        MutableBerView::cend() const noexcept { return BerView::end(); }
-inline MutableBerViewIterator MutableBerView::begin() noexcept { return MutableBerViewIterator{content()}; }
 inline MutableBerViewIterator MutableBerView::end() noexcept { return MutableBerViewIterator{End::end}; }
 
+inline BerViewIterator BerView::begin() const noexcept
+{
+    return BerViewIterator{std::span(content_data(), iterated_length()), !end_located()};
+}
+
+inline MutableBerViewIterator MutableBerView::begin() noexcept
+{
+    return MutableBerViewIterator{std::span(content_data(), iterated_length()), !end_located()};
+}
+
 inline EncodeResult BerView::encode(std::span<uint8_t> buffer) const noexcept
 {
     if (ber_length() > buffer.size())
@@ -0,0 +1,25 @@
+#pragma once
+
+// Conversions between the time values of fast_ber and Boost.Date_Time. This header is not included by All.hpp, Boost is
+// only needed by code which includes it
+
+#include "fast_ber/ber_types/TimeImpl.hpp"
+
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+namespace fast_ber
+{
+
+inline TimePoint to_time_point(const boost::posix_time::ptime& time)
+{
+    const boost::posix_time::ptime epoch(boost::gregorian::date(1970, 1, 1));
+    return TimePoint(std::chrono::microseconds((time - epoch).total_microseconds()));
+}
+
+inline boost::posix_time::ptime to_ptime(TimePoint time)
+{
+    const boost::posix_time::ptime epoch(boost::gregorian::date(1970, 1, 1));
+    return epoch + boost::posix_time::microseconds(time.time_since_epoch().count());
+}
+
+} // namespace fast_ber
@@ -0,0 +1,276 @@
+#pragma once
+
+#include "fast_ber/ber_types/Identifier.hpp"
+#include "fast_ber/util/Arena.hpp"
+#include "fast_ber/util/BerView.hpp"
+#include "fast_ber/util/DecodeHelpers.hpp"
+#include "fast_ber/util/EncodeHelpers.hpp"
+#include "fast_ber/util/Error.hpp"
+
+#include <span>
+#include <vector>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace fast_ber
+{
+
+// Container of a ber packet which references the buffer it was decoded from instead of copying it. The decoded buffer
+// must outlive the container, unless the contents are first copied with make_owned(). Contents assigned by the user
+// are held in an owned vector, so decoding allocates nothing while assignment behaves as in FixedIdBerContainer.
+// Contents are only accessed as const, borrowed contents are never copied implicitly.
+
+template <typename Identifier>
+class BorrowedFixedIdBerContainer
+{
+  public:
+    BorrowedFixedIdBerContainer() noexcept = default;
+    BorrowedFixedIdBerContainer(const BorrowedFixedIdBerContainer& rhs) noexcept;
+    BorrowedFixedIdBerContainer(BorrowedFixedIdBerContainer&& rhs) noexcept;
+    BorrowedFixedIdBerContainer(BerView input_view) noexcept { decode(input_view); }
+    template <typename Identifier2>
+    BorrowedFixedIdBerContainer(const BorrowedFixedIdBerContainer<Identifier2>& rhs) noexcept
+    {
+        assign_content(rhs.content());
+    }
+    ~BorrowedFixedIdBerContainer() noexcept = default;
+
+    BorrowedFixedIdBerContainer& operator=(BerView input_view) noexcept;
+    BorrowedFixedIdBerContainer& operator=(const BorrowedFixedIdBerContainer& rhs) noexcept;
+    BorrowedFixedIdBerContainer& operator=(BorrowedFixedIdBerContainer&& rhs) noexcept;
+    template <typename Identifier2>
+    BorrowedFixedIdBerContainer& operator=(const BorrowedFixedIdBerContainer<Identifier2>& rhs) noexcept
+    {
+        assign_content(rhs.content());
+        return *this;
+    }
+
+    void assign_content(const std::span<const uint8_t> input_content) noexcept;
+    void resize_content(size_t size);
+
+    constexpr static Class class_() noexcept { return Identifier::class_(); }
+    constexpr static Tag   tag() noexcept { return Identifier::tag(); }
+
+    std::span<const uint8_t> content() const noexcept { return std::span(content_data(), m_content_length); }
+    const uint8_t*            content_data() const noexcept { return ber_data() + m_ber_length - m_content_length; }
+    size_t                    content_length() const noexcept { return m_content_length; }
+
+    std::span<const uint8_t> ber() const noexcept { return std::span(ber_data(), m_ber_length); }
+    const uint8_t*            ber_data() const noexcept { return m_ber_data ? m_ber_data : empty_ber.data(); }
+    size_t                    ber_length() const noexcept { return m_ber_length; }
+
+    // True if the contents reference a decoded buffer
+    bool is_borrowed() const noexcept { return m_ber_data != nullptr && m_ber_data != m_owned.data(); }
+
+    // Copies borrowed contents into owned storage, after which the decoded buffer may be released
+    void make_owned();
+
+    bool operator==(const BorrowedFixedIdBerContainer& rhs) const
+    {
+        return std::ranges::equal(content(), rhs.content());
+    }
+    bool operator!=(const BorrowedFixedIdBerContainer& rhs) const { return !(*this == rhs); }
+
+    BerView view() const noexcept { return BerView(ber()); }
+
+    size_t       encoded_length() const noexcept { return m_ber_length; }
+    EncodeResult encode(std::span<uint8_t> buffer) const noexcept;
+    DecodeResult decode(BerView view) noexcept;
+
+  private:
+    inline static const std::array<uint8_t, fast_ber::encoded_length(0, Identifier{})> empty_ber =
+        encoded_header<Identifier>();
+
+    template <Class class_1, Tag tag_1>
+    DecodeResult decode_impl(BerView input_view, Id<class_1, tag_1>) noexcept;
+    template <typename Identifier1, typename Identifier2>
+    DecodeResult decode_impl(BerView input_view, DoubleId<Identifier1, Identifier2>) noexcept;
+
+    // A null m_ber_data refers to the empty packet
+    const uint8_t*                                m_ber_data       = nullptr;
+    size_t                                        m_ber_length     = empty_ber.size();
+    size_t                                        m_content_length = 0;
+    std::vector<uint8_t, ArenaAllocator<uint8_t>> m_owned;
+};
+
+template <typename Identifier>
+BorrowedFixedIdBerContainer<Identifier>::BorrowedFixedIdBerContainer(const BorrowedFixedIdBerContainer& rhs) noexcept
+{
+    *this = rhs;
+}
+
+template <typename Identifier>
+BorrowedFixedIdBerContainer<Identifier>::BorrowedFixedIdBerContainer(BorrowedFixedIdBerContainer&& rhs) noexcept
+{
+    *this = std::move(rhs);
+}
+
+template <typename Identifier>
+BorrowedFixedIdBerContainer<Identifier>& BorrowedFixedIdBerContainer<Identifier>::operator=(BerView input_view) noexcept
+{
+    decode(input_view);
+    return *this;
+}
+
+template <typename Identifier>
+BorrowedFixedIdBerContainer<Identifier>&
+BorrowedFixedIdBerContainer<Identifier>::operator=(const BorrowedFixedIdBerContainer& rhs) noexcept
+{
+    if (this == &rhs)
+    {
+        return *this;
+    }
+
+    if (rhs.is_borrowed() || rhs.m_ber_data == nullptr)
+    {
+        m_ber_data = rhs.m_ber_data;
+    }
+    else
+    {
+        m_owned    = rhs.m_owned;
+        m_ber_data = m_owned.data();
+    }
+    m_ber_length     = rhs.m_ber_length;
+    m_content_length = rhs.m_content_length;
+    return *this;
+}
+
+template <typename Identifier>
+BorrowedFixedIdBerContainer<Identifier>&
+BorrowedFixedIdBerContainer<Identifier>::operator=(BorrowedFixedIdBerContainer&& rhs) noexcept
+{
+    // Moving a vector keeps its storage, so a pointer into owned contents remains valid
+    m_owned          = std::move(rhs.m_owned);
+    m_ber_data       = rhs.m_ber_data;
+    m_ber_length     = rhs.m_ber_length;
+    m_content_length = rhs.m_content_length;
+    return *this;
+}
+
+template <typename Identifier>
+template <Class class_1, Tag tag_1>
+DecodeResult BorrowedFixedIdBerContainer<Identifier>::decode_impl(BerView input_view, Id<class_1, tag_1> id) noexcept
+{
+    if (!has_correct_header(input_view, id, Construction::primitive))
+    {
+        if (!input_view.is_valid())
+        {
+            FAST_BER_ERROR("Invalid packet when decoding packet with tag [", id, "]");
+            return DecodeResult{false, DecodeError::invalid_packet};
+        }
+        FAST_BER_ERROR("Incorrect header [", input_view.identifier(), "] when decoding packet with tag [", id, "]");
+        return DecodeResult{false, DecodeError::invalid_header};
+    }
+
+    m_ber_data       = input_view.ber_data();
+    m_ber_length     = input_view.ber_length();
+    m_content_length = input_view.content_length();
+    return DecodeResult{true};
+}
+
+template <typename Identifier>
+template <typename Identifier1, typename Identifier2>
+DecodeResult BorrowedFixedIdBerContainer<Identifier>::decode_impl(BerView                            input_view,
+                                                                  DoubleId<Identifier1, Identifier2> id) noexcept
+{
+    if (!has_correct_header(input_view, id, Construction::primitive))
+    {
+        if (!input_view.is_valid() || !input_view.begin()->is_valid())
+        {
+            FAST_BER_ERROR("Invalid packet when decoding packet with tag [", id, "]");
+            return DecodeResult{false, DecodeError::invalid_packet};
+        }
+        FAST_BER_ERROR("Incorrect header [", input_view.identifier(), ", ", input_view.begin()->identifier(),
+                       "] when decoding packet with tag [", id, "]");
+        return DecodeResult{false, DecodeError::invalid_header};
+    }
+
+    if (input_view.is_indefinite_length())
+    {
+        // Content is not located at the end of the packet, so store a copy in definite length form
+        assign_content(input_view.begin()->content());
+        return DecodeResult{true};
+    }
+
+    m_ber_data       = input_view.ber_data();
+    m_ber_length     = input_view.ber_length();
+    m_content_length = input_view.begin()->content_length();
+    return DecodeResult{true};
+}
+
+template <typename Identifier>
+void BorrowedFixedIdBerContainer<Identifier>::assign_content(const std::span<const uint8_t> input_content) noexcept
+{
+    if (!m_owned.empty() && input_content.data() >= m_owned.data() &&
+        input_content.data() < m_owned.data() + m_owned.size())
+    {
+        // Input refers to the owned buffer, which may be reallocated
+        const std::vector<uint8_t> copy(input_content.begin(), input_content.end());
+        assign_content(copy);
+        return;
+    }
+
+    const size_t encoded_len = fast_ber::encoded_length(input_content.size(), Identifier{});
+    const size_t header_len  = encoded_len - input_content.size();
+
+    m_owned.resize(encoded_len);
+    std::memcpy(m_owned.data() + header_len, input_content.data(), input_content.size());
+    encode_header(std::span<uint8_t>(m_owned), input_content.size(), Identifier{}, Construction::primitive);
+    m_ber_data       = m_owned.data();
+    m_ber_length     = encoded_len;
+    m_content_length = input_content.size();
+
+    assert(view().is_valid());
+}
+
+template <typename Identifier>
+void BorrowedFixedIdBerContainer<Identifier>::make_owned()
+{
+    if (m_ber_data != m_owned.data() || m_ber_data == nullptr)
+    {
+        m_owned.assign(ber_data(), ber_data() + m_ber_length);
+        m_ber_data = m_owned.data();
+    }
+}
+
+template <typename Identifier>
+void BorrowedFixedIdBerContainer<Identifier>::resize_content(size_t size)
+{
+    make_owned();
+
+    size_t old_header_length = m_ber_length - m_content_length;
+    size_t new_header_length = encoded_header_length(size, Identifier{});
+
+    m_owned.resize(new_header_length + size);
+    std::memmove(m_owned.data() + new_header_length, m_owned.data() + old_header_length,
+                 std::min(m_content_length, size));
+
+    encode_header(std::span<uint8_t>(m_owned), size, Identifier{}, Construction::primitive);
+    m_ber_data       = m_owned.data();
+    m_ber_length     = m_owned.size();
+    m_content_length = size;
+
+    assert(view().is_valid());
+}
+
+template <typename Identifier>
+EncodeResult BorrowedFixedIdBerContainer<Identifier>::encode(std::span<uint8_t> buffer) const noexcept
+{
+    if (buffer.size() < m_ber_length)
+    {
+        return EncodeResult{false, 0};
+    }
+
+    memcpy(buffer.data(), ber_data(), m_ber_length);
+    return EncodeResult{true, m_ber_length};
+}
+
+template <typename Identifier>
+DecodeResult BorrowedFixedIdBerContainer<Identifier>::decode(BerView view) noexcept
+{
+    return decode_impl(view, Identifier{});
+}
+
+} // namespace fast_ber
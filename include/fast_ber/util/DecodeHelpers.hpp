@@ -3,15 +3,60 @@
 #include <span>
 #include "fast_ber/ber_types/Identifier.hpp"
 #include "fast_ber/util/BerView.hpp"
+#include "fast_ber/util/Error.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
 
 namespace fast_ber
 {
 
+// On failure, error is the kind of failure, offset is the position of the packet which failed within the input and
+// field is the innermost named type or member, such as "Collection.member", which failed to decode. Kept to 16 bytes,
+// so that it is returned in registers, offsets beyond 4GiB saturate
 struct DecodeResult
 {
-    bool success;
+    bool        success;
+    DecodeError error  = DecodeError::none;
+    uint32_t    offset = 0;
+    const char* field  = nullptr;
 };
 
+static_assert(sizeof(DecodeResult) <= 16);
+
+inline uint32_t decode_offset(size_t offset) noexcept
+{
+    return static_cast<uint32_t>(std::min<size_t>(offset, std::numeric_limits<uint32_t>::max()));
+}
+
+// Offset of a packet within the packet containing it, packets which are not present are at the end of the container
+inline size_t offset_within(const BerView& container, const BerView& packet) noexcept
+{
+    return packet.is_valid() ? static_cast<size_t>(packet.ber_data() - container.ber_data()) : container.ber_length();
+}
+
+// Failure of a generated type to decode, reported to the error policy
+inline DecodeResult decode_error(DecodeError error, const char* field, size_t offset = 0) noexcept
+{
+    report_decode_error(error, field);
+    return DecodeResult{false, error, decode_offset(offset), field};
+}
+
+// Failure of a member of a generated type to decode. The failure is reported to the error policy unless it was
+// reported by the member itself
+inline DecodeResult member_decode_error(DecodeResult result, const BerView& container, const BerView& member,
+                                        const char* field) noexcept
+{
+    result.offset = decode_offset(result.offset + offset_within(container, member));
+    if (result.field == nullptr)
+    {
+        result.field = field;
+        report_decode_error(result.error, field);
+    }
+    return result;
+}
+
 template <typename T>
 DecodeResult decode(std::span<const uint8_t> input, T& output) noexcept
 {
@@ -14,6 +14,9 @@ enum class StorageMode
     static_,
     small_buffer_optimised,
     dynamic,
+    borrowed, // References the decoded buffer, which must outlive the value. Supported by string types
+    native,   // Stores the unencoded value, encoded only when serialized. Supported by Integer, Enumerated, Boolean and
+              // Real
 };
 
 } // namespace fast_ber
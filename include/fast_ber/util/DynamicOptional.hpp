@@ -1,5 +1,7 @@
 ﻿#pragma once
 
+#include "fast_ber/util/Arena.hpp"
+
 #include <memory>
 #include <optional>
 
@@ -9,6 +11,7 @@ namespace fast_ber
 using Empty                 = std::nullopt_t;
 constexpr static auto empty = std::nullopt;
 
+// Optional holding its value in a separate allocation, taken from the arena active when it was constructed, if any
 template <typename T>
 class DynamicOptional
 {
@@ -17,8 +20,8 @@ class DynamicOptional
     DynamicOptional(const DynamicOptional& rhs) : m_val(nullptr) { *this = rhs; }
     DynamicOptional(DynamicOptional&&) noexcept = default;
     DynamicOptional(Empty) noexcept {}
-    DynamicOptional(const T& t) : m_val(new T(t)) {}
-    DynamicOptional(T&& t) : m_val(new T(std::move(t))) {}
+    DynamicOptional(const T& t) : m_val(arena_new<T>(current_arena_resource(), t)) {}
+    DynamicOptional(T&& t) : m_val(arena_new<T>(current_arena_resource(), std::move(t))) {}
     ~DynamicOptional() noexcept = default;
 
     template <typename U = T,
@@ -27,21 +30,21 @@ class DynamicOptional
                                     std::negation<std::is_same<DynamicOptional<T>, typename std::decay<U>::type>>,
                                     std::is_convertible<U&&, T>, std::is_constructible<T, U&&>>::value,
                   bool>::type = false>
-    DynamicOptional(const U& t) : m_val(std::make_unique<T>(t))
+    DynamicOptional(const U& t) : m_val(arena_new<T>(current_arena_resource(), t))
     {
     }
 
     template <typename T2>
     DynamicOptional& operator=(const T2& t2)
     {
-        m_val = std::make_unique<T>(t2);
+        m_val.reset(arena_new<T>(m_val.get_deleter().resource(), t2));
         return *this;
     }
     DynamicOptional& operator=(const DynamicOptional& rhs)
     {
         if (rhs.m_val)
         {
-            m_val = std::make_unique<T>(*rhs.m_val);
+            m_val.reset(arena_new<T>(m_val.get_deleter().resource(), *rhs.m_val));
         }
         else
         {
@@ -56,7 +59,7 @@ class DynamicOptional
     }
     DynamicOptional& operator=(const T& t)
     {
-        m_val.reset(new T(t));
+        m_val.reset(arena_new<T>(m_val.get_deleter().resource(), t));
         return *this;
     }
     DynamicOptional& operator=(DynamicOptional&&) noexcept = default;
@@ -70,7 +73,7 @@ class DynamicOptional
     template <typename... Args>
     T& emplace(Args&&... args)
     {
-        m_val = std::make_unique<T>(args...);
+        m_val.reset(arena_new<T>(m_val.get_deleter().resource(), args...));
         return *m_val;
     }
     bool has_value() const noexcept { return bool(m_val); }
@@ -102,7 +105,7 @@ class DynamicOptional
     bool operator!=(const T& rhs) const noexcept { return !(*this == rhs); }
 
   private:
-    std::unique_ptr<T> m_val;
+    std::unique_ptr<T, ArenaDeleter<T>> m_val;
 };
 
 } // namespace fast_ber
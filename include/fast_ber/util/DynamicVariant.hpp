@@ -1,5 +1,6 @@
 ﻿#pragma once
 
+#include "fast_ber/util/Arena.hpp"
 #include "fast_ber/util/DynamicVariantHelpers.hpp"
 
 #include <type_traits>
@@ -278,19 +279,23 @@ auto visit_binary(Visitor&& vis, const DynamicVariant<Types...>& a, const Dynami
 
 struct CopyVisitor
 {
+    std::pmr::memory_resource* resource;
+
     template <typename T>
     void* operator()(const T& t) const
     {
-        return new T(t);
+        return arena_new<T>(resource, t);
     }
 };
 
 struct DeleteVisitor
 {
+    std::pmr::memory_resource* resource;
+
     template <typename T>
     void operator()(T& t) const
     {
-        delete &t;
+        arena_delete(resource, &t);
     }
 };
 
@@ -329,12 +334,13 @@ class DynamicVariant
     template <typename T>
     using AcceptedType = ToType<AcceptedIndex<T>::value>;
 
-    DynamicVariant() noexcept : m_data(new ToType<0>()) {}
+    DynamicVariant() noexcept : m_data(arena_new<ToType<0>>(m_resource)) {}
     DynamicVariant(const DynamicVariant& other)
-        : m_index(other.m_index), m_data(fast_ber::dynamic::visit(CopyVisitor{}, other))
+        : m_index(other.m_index), m_data(fast_ber::dynamic::visit(CopyVisitor{m_resource}, other))
     {
     }
-    DynamicVariant(DynamicVariant&& other) noexcept : m_index(std::move(other.m_index)), m_data(std::move(other.m_data))
+    DynamicVariant(DynamicVariant&& other) noexcept
+        : m_index(std::move(other.m_index)), m_resource(other.m_resource), m_data(std::move(other.m_data))
     {
         other.m_data = nullptr;
     }
@@ -343,7 +349,8 @@ class DynamicVariant
               typename = std::enable_if_t<ExactlyOnce<AcceptedType<T&&>>::value &&
                                            std::is_constructible<AcceptedType<T&&>, T&&>::value>>
     DynamicVariant(T&& t) noexcept(std::is_nothrow_constructible<AcceptedType<T&&>, T&&>::value)
-        : m_index(detail::IndexOf<AcceptedType<T&&>, Types...>::value), m_data(new AcceptedType<T&&>(t))
+        : m_index(detail::IndexOf<AcceptedType<T&&>, Types...>::value),
+          m_data(arena_new<AcceptedType<T&&>>(m_resource, t))
     {
         assert(holds_alternative<AcceptedType<T&&>>(*this));
     }
@@ -351,7 +358,7 @@ class DynamicVariant
     template <typename T, typename... Args,
               typename = std::enable_if_t<ExactlyOnce<T>::value && std::is_constructible<T, Args&&...>::value>>
     explicit DynamicVariant(in_place_type_t<T>, Args&&... args)
-        : m_index(detail::IndexOf<T, Types...>::value), m_data(new T(std::forward<Args>(args)...))
+        : m_index(detail::IndexOf<T, Types...>::value), m_data(arena_new<T>(m_resource, std::forward<Args>(args)...))
 
     {
         assert(holds_alternative<T>(*this));
@@ -361,7 +368,7 @@ class DynamicVariant
               typename = std::enable_if_t<ExactlyOnce<T>::value &&
                                            std::is_constructible<T, std::initializer_list<U>&, Args&&...>::value>>
     explicit DynamicVariant(in_place_type_t<T>, std::initializer_list<U> il, Args&&... args)
-        : m_index(detail::IndexOf<T, Types...>::value), m_data(new T(il, args...))
+        : m_index(detail::IndexOf<T, Types...>::value), m_data(arena_new<T>(m_resource, il, args...))
     {
         assert(holds_alternative<T>(*this));
     }
@@ -369,7 +376,7 @@ class DynamicVariant
     template <size_t i, typename... Args,
               typename = std::enable_if_t<std::is_constructible<ToType<i>, Args&&...>::value>>
     explicit DynamicVariant(in_place_index_t<i>, Args&&... args)
-        : m_index(i), m_data(new ToType<i>(std::forward<Args>(args)...))
+        : m_index(i), m_data(arena_new<ToType<i>>(m_resource, std::forward<Args>(args)...))
     {
         assert(index() == i);
     }
@@ -378,7 +385,7 @@ class DynamicVariant
         size_t i, typename U, typename... Args,
         typename = std::enable_if_t<std::is_constructible<ToType<i>, std::initializer_list<U>&, Args&&...>::value>>
     explicit DynamicVariant(in_place_index_t<i>, std::initializer_list<U> il, Args&&... args)
-        : m_index(i), m_data(new ToType<i>(il, std::forward<Args>(args)...))
+        : m_index(i), m_data(arena_new<ToType<i>>(m_resource, il, std::forward<Args>(args)...))
 
     {
         assert(index() == i);
@@ -388,7 +395,7 @@ class DynamicVariant
     {
         if (!valueless_by_exception() && m_data != nullptr)
         {
-            fast_ber::dynamic::visit(DeleteVisitor(), *this);
+            fast_ber::dynamic::visit(DeleteVisitor{m_resource}, *this);
         }
     }
 
@@ -396,10 +403,10 @@ class DynamicVariant
     {
         if (!valueless_by_exception() && m_data != nullptr)
         {
-            fast_ber::dynamic::visit(DeleteVisitor(), *this);
+            fast_ber::dynamic::visit(DeleteVisitor{m_resource}, *this);
         }
         m_index = other.m_index;
-        m_data  = fast_ber::dynamic::visit(CopyVisitor(), other);
+        m_data  = fast_ber::dynamic::visit(CopyVisitor{m_resource}, other);
 
         return *this;
     }
@@ -408,10 +415,11 @@ class DynamicVariant
     {
         if (!valueless_by_exception() && m_data != nullptr)
         {
-            fast_ber::dynamic::visit(DeleteVisitor(), *this);
+            fast_ber::dynamic::visit(DeleteVisitor{m_resource}, *this);
         }
-        m_index = other.m_index;
-        m_data  = other.m_data;
+        m_index    = other.m_index;
+        m_resource = other.m_resource;
+        m_data     = other.m_data;
 
         other.m_data = nullptr;
         return *this;
@@ -426,10 +434,10 @@ class DynamicVariant
     {
         if (!valueless_by_exception() && m_data != nullptr)
         {
-            fast_ber::dynamic::visit(DeleteVisitor(), *this);
+            fast_ber::dynamic::visit(DeleteVisitor{m_resource}, *this);
         }
         m_index = AcceptedIndex<T>::value;
-        m_data  = new AcceptedType<T>(std::move(t));
+        m_data  = arena_new<AcceptedType<T>>(m_resource, std::move(t));
         return *this;
     }
 
@@ -439,10 +447,10 @@ class DynamicVariant
     {
         if (!valueless_by_exception() && m_data != nullptr)
         {
-            fast_ber::dynamic::visit(DeleteVisitor(), *this);
+            fast_ber::dynamic::visit(DeleteVisitor{m_resource}, *this);
         }
         m_index = AcceptedIndex<T>::value;
-        m_data  = new AcceptedType<T>(std::forward<Args>(args)...);
+        m_data  = arena_new<AcceptedType<T>>(m_resource, std::forward<Args>(args)...);
 
         assert(holds_alternative<T>(*this));
         return *static_cast<T*>(m_data);
@@ -455,10 +463,10 @@ class DynamicVariant
     {
         if (!valueless_by_exception() && m_data != nullptr)
         {
-            fast_ber::dynamic::visit(DeleteVisitor(), *this);
+            fast_ber::dynamic::visit(DeleteVisitor{m_resource}, *this);
         }
         m_index = AcceptedIndex<T>::value;
-        m_data  = new T(std::forward<Args>(il, args)...);
+        m_data  = arena_new<T>(m_resource, std::forward<Args>(il, args)...);
 
         assert(holds_alternative<T>(*this));
         return *static_cast<T*>(m_data);
@@ -473,13 +481,13 @@ class DynamicVariant
 
         if (!valueless_by_exception() && m_data != nullptr)
         {
-            fast_ber::dynamic::visit(DeleteVisitor(), *this);
+            fast_ber::dynamic::visit(DeleteVisitor{m_resource}, *this);
         }
 
         try
         {
             m_index = i;
-            m_data  = new ToType<i>(std::forward<Args>(args)...);
+            m_data  = arena_new<ToType<i>>(m_resource, std::forward<Args>(args)...);
         }
         catch (...)
         {
@@ -500,13 +508,13 @@ class DynamicVariant
 
         if (!valueless_by_exception() && m_data != nullptr)
         {
-            fast_ber::dynamic::visit(DeleteVisitor(), *this);
+            fast_ber::dynamic::visit(DeleteVisitor{m_resource}, *this);
         }
 
         try
         {
             m_index = i;
-            m_data  = new ToType<i>(std::forward<Args>(il, args)...);
+            m_data  = arena_new<ToType<i>>(m_resource, std::forward<Args>(il, args)...);
         }
         catch (...)
         {
@@ -524,6 +532,7 @@ class DynamicVariant
     void swap(DynamicVariant& rhs) noexcept
     {
         std::swap(m_index, rhs.m_index);
+        std::swap(m_resource, rhs.m_resource);
         std::swap(m_data, rhs.m_data);
     }
 
@@ -540,8 +549,9 @@ class DynamicVariant
     }
 
   private:
-    size_t m_index{0};
-    void*  m_data;
+    size_t                     m_index{0};
+    std::pmr::memory_resource* m_resource = current_arena_resource();
+    void*                      m_data;
 }; // namespace fast_ber
 
 static_assert(std::is_copy_constructible<DynamicVariant<int, char>>::value, "");
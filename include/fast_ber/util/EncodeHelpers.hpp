@@ -7,7 +7,7 @@
 #include <span>
 
 #include <cstddef> // for uint8_t
-#include <cstring> // for std::memmove
+#include <cstring> // for std::memmove, std::memset
 
 #include <assert.h>
 
@@ -84,6 +84,77 @@ EncodeResult wrap_with_ber_header(std::span<uint8_t> buffer, size_t content_leng
     return encode_header(buffer, content_length, id, construction);
 }
 
+// Creates a BER header with provided ID immediately before the final "content_length" bytes of the buffer
+// Used when encoding back to front, the content is always written before its header so no memory needs moving
+
+template <typename Identifier>
+EncodeResult wrap_with_ber_header_reverse(std::span<uint8_t> buffer, size_t content_length, Identifier id,
+                                          Construction construction = Construction::constructed)
+{
+    size_t header_length = encoded_header_length(content_length, id);
+    if (header_length + content_length > buffer.size())
+    {
+        return EncodeResult{false, 0};
+    }
+
+    return encode_header(buffer.last(header_length + content_length), content_length, id, construction);
+}
+
+// Encode the header of a constructed packet using the indefinite length form
+// The content must be terminated by encode_end_of_contents(), allowing a packet to be written in one forward pass
+// without calculating its length in advance
+
+template <Class T1, Tag T2>
+EncodeResult encode_indefinite_header(std::span<uint8_t> buffer, Id<T1, T2> id) noexcept
+{
+    size_t identifier_length = encode_identifier(buffer, Construction::constructed, id.class_(), id.tag());
+    if (identifier_length == 0 || identifier_length >= buffer.size())
+    {
+        return EncodeResult{false, 0};
+    }
+
+    buffer[identifier_length] = 0x80;
+    return EncodeResult{true, identifier_length + 1};
+}
+
+template <typename OuterId, typename InnerId>
+EncodeResult encode_indefinite_header(std::span<uint8_t> buffer, DoubleId<OuterId, InnerId> id) noexcept
+{
+    EncodeResult outer = encode_indefinite_header(buffer, id.outer_id());
+    if (!outer.success)
+    {
+        return outer;
+    }
+
+    EncodeResult inner = encode_indefinite_header(buffer.subspan(outer.length), id.inner_id());
+    return EncodeResult{inner.success, outer.length + inner.length};
+}
+
+template <Class T1, Tag T2>
+EncodeResult encode_end_of_contents(std::span<uint8_t> buffer, Id<T1, T2>) noexcept
+{
+    if (buffer.size() < 2)
+    {
+        return EncodeResult{false, 0};
+    }
+
+    buffer[0] = 0x00;
+    buffer[1] = 0x00;
+    return EncodeResult{true, 2};
+}
+
+template <typename OuterId, typename InnerId>
+EncodeResult encode_end_of_contents(std::span<uint8_t> buffer, DoubleId<OuterId, InnerId>) noexcept
+{
+    if (buffer.size() < 4)
+    {
+        return EncodeResult{false, 0};
+    }
+
+    std::memset(buffer.data(), 0x00, 4);
+    return EncodeResult{true, 4};
+}
+
 template <typename T>
 constexpr size_t encoded_length(const T& object) noexcept
 {
@@ -96,4 +167,44 @@ EncodeResult encode(std::span<uint8_t> output, const T& object) noexcept
     return object.encode(output);
 }
 
+// Encode an object back to front, the encoding is placed at the end of the provided buffer
+// On success the encoded object is located in output.last(result.length)
+
+// Constructed types provide encode_reverse(), writing each child before its header so no content is moved. Other
+// types have a cheap encoded_length() and are copied into place with their regular encode().
+
+template <typename T>
+EncodeResult encode_reverse(std::span<uint8_t> output, const T& object) noexcept
+{
+    if constexpr (requires { object.encode_reverse(output); })
+    {
+        return object.encode_reverse(output);
+    }
+    else
+    {
+        const size_t length = object.encoded_length();
+        if (length > output.size())
+        {
+            return EncodeResult{false, 0};
+        }
+        return object.encode(output.last(length));
+    }
+}
+
+// Encode an object, writing constructed types with indefinite length headers
+// Primitive types are always definite length, so are encoded as normal
+
+template <typename T>
+EncodeResult encode_indefinite(std::span<uint8_t> output, const T& object) noexcept
+{
+    if constexpr (requires { object.encode_indefinite(output); })
+    {
+        return object.encode_indefinite(output);
+    }
+    else
+    {
+        return object.encode(output);
+    }
+}
+
 } // namespace fast_ber
@@ -1,12 +1,142 @@
 #pragma once
 
-#include <iostream>
+#include <array>
+#include <atomic>
+
+#include <cstddef>
+#include <cstdint>
+
+// Decode errors are reported through a policy chosen at compile time, by defining FAST_BER_ERROR_POLICY to one of the
+// following. The policy must be the same in every translation unit, so it is set for all users of the fast_ber_lib
+// target by the FAST_BER_ERROR_POLICY CMake option (NONE, COUNT, CALLBACK or PRINT) rather than in source files.
+// Left empty, the option chooses PRINT for Debug builds and NONE for all others.
+//
+// FAST_BER_ERROR_POLICY_NONE     - Errors are only returned in DecodeResult. Default
+// FAST_BER_ERROR_POLICY_COUNT    - Errors are counted by kind, see decode_error_count()
+// FAST_BER_ERROR_POLICY_CALLBACK - The function given to set_decode_error_callback() is called for each error
+// FAST_BER_ERROR_POLICY_PRINT    - A description of each error is written to std::cerr. Default in Debug builds
+//
+// Only the print policy includes <iostream>, or evaluates the arguments of FAST_BER_ERROR
+#define FAST_BER_ERROR_POLICY_NONE 0
+#define FAST_BER_ERROR_POLICY_COUNT 1
+#define FAST_BER_ERROR_POLICY_CALLBACK 2
+#define FAST_BER_ERROR_POLICY_PRINT 3
+
+#ifndef FAST_BER_ERROR_POLICY
+#define FAST_BER_ERROR_POLICY FAST_BER_ERROR_POLICY_NONE
+#endif
+
+#if FAST_BER_ERROR_POLICY < FAST_BER_ERROR_POLICY_NONE || FAST_BER_ERROR_POLICY > FAST_BER_ERROR_POLICY_PRINT
+#error "FAST_BER_ERROR_POLICY must be one of the FAST_BER_ERROR_POLICY_ values"
+#endif
 
+#if FAST_BER_ERROR_POLICY == FAST_BER_ERROR_POLICY_PRINT
+#include <iostream>
 #define FAST_BER_ERROR(...) ::fast_ber::handle_error(__VA_ARGS__)
+#else
+#define FAST_BER_ERROR(...) static_cast<void>(0)
+#endif
 
 namespace fast_ber
 {
 
+enum class DecodeError : uint8_t
+{
+    none,
+    invalid_packet,      // The packet is malformed or missing
+    invalid_header,      // The identifier or construction of the packet is not that of the type
+    invalid_content,     // The contents of the packet are not a valid value of the type
+    unknown_alternative, // No alternative of a choice has the identifier of the packet
+    unknown_member,      // No member of a set has the identifier of the packet
+    missing_member,      // A non-optional member of a set is not present
+    duplicate_member,    // A member of a set is present more than once
+};
+
+constexpr size_t decode_error_kinds = static_cast<size_t>(DecodeError::duplicate_member) + 1;
+
+constexpr const char* to_string(DecodeError error) noexcept
+{
+    switch (error)
+    {
+    case DecodeError::none:
+        return "none";
+    case DecodeError::invalid_packet:
+        return "invalid packet";
+    case DecodeError::invalid_header:
+        return "invalid header";
+    case DecodeError::invalid_content:
+        return "invalid content";
+    case DecodeError::unknown_alternative:
+        return "unknown alternative";
+    case DecodeError::unknown_member:
+        return "unknown member";
+    case DecodeError::missing_member:
+        return "missing member";
+    case DecodeError::duplicate_member:
+        return "duplicate member";
+    }
+    return "unknown";
+}
+
+// Field is the name of the type or member being decoded, such as "Collection.member"
+using DecodeErrorCallback = void (*)(DecodeError error, const char* field, void* context);
+
+namespace detail
+{
+
+inline std::array<std::atomic<uint64_t>, decode_error_kinds> decode_error_counts = {};
+
+inline std::atomic<DecodeErrorCallback> decode_error_callback = nullptr;
+inline std::atomic<void*>               decode_error_context  = nullptr;
+
+inline void count_decode_error(DecodeError error) noexcept
+{
+    decode_error_counts[static_cast<size_t>(error)].fetch_add(1, std::memory_order_relaxed);
+}
+
+inline void call_decode_error_callback(DecodeError error, const char* field) noexcept
+{
+    const DecodeErrorCallback callback = decode_error_callback.load(std::memory_order_acquire);
+    if (callback)
+    {
+        callback(error, field, decode_error_context.load(std::memory_order_relaxed));
+    }
+}
+
+} // namespace detail
+
+inline uint64_t decode_error_count(DecodeError error) noexcept
+{
+    return detail::decode_error_counts[static_cast<size_t>(error)].load(std::memory_order_relaxed);
+}
+
+inline void reset_decode_error_counts() noexcept
+{
+    for (std::atomic<uint64_t>& count : detail::decode_error_counts)
+    {
+        count.store(0, std::memory_order_relaxed);
+    }
+}
+
+// The callback may be called concurrently from any thread decoding, and must not throw
+inline void set_decode_error_callback(DecodeErrorCallback callback, void* context = nullptr) noexcept
+{
+    detail::decode_error_context.store(context, std::memory_order_relaxed);
+    detail::decode_error_callback.store(callback, std::memory_order_release);
+}
+
+// Report the point at which decoding failed to the error policy. Called once for each failed decode, by the innermost
+// generated type whose member failed to decode
+inline void report_decode_error([[maybe_unused]] DecodeError error, [[maybe_unused]] const char* field) noexcept
+{
+#if FAST_BER_ERROR_POLICY == FAST_BER_ERROR_POLICY_COUNT
+    detail::count_decode_error(error);
+#elif FAST_BER_ERROR_POLICY == FAST_BER_ERROR_POLICY_CALLBACK
+    detail::call_decode_error_callback(error, field);
+#endif
+}
+
+#if FAST_BER_ERROR_POLICY == FAST_BER_ERROR_POLICY_PRINT
 inline void handle_error_impl() { std::cerr << std::endl; }
 
 template <typename T, typename... Args>
@@ -21,5 +151,6 @@ void handle_error(Args&&... args)
 {
     handle_error_impl(args...);
 }
+#endif
 
 } // namespace fast_ber
@@ -27,8 +27,23 @@ inline size_t extract_tag(std::span<const uint8_t> input, Tag& tag) noexcept;
 
 // Extract the length of a ber packet
 // Return the length of the length octets on success, false on fail
+// The indefinite form (0x80) sets indefinite, with a length of 0. The content of such a packet is terminated by two
+// end-of-contents octets (0x00 0x00)
+inline size_t extract_length(std::span<const uint8_t> input, size_t& length, size_t length_offset,
+                             bool& indefinite) noexcept;
+
+// Extract the definite length of a ber packet
+// Return the length of the length octets on success, false on fail or for the indefinite form
 inline size_t extract_length(std::span<const uint8_t> input, size_t& length, size_t length_offset) noexcept;
 
+// Whether the input starts with the end-of-contents octets (0x00 0x00) which terminate an indefinite length packet
+inline bool is_end_of_contents(std::span<const uint8_t> input) noexcept;
+
+// Extract the length of the content of an indefinite length packet, excluding the end-of-contents octets
+// Input should start at the first content octet. Nested indefinite length packets are skipped without recursion
+// Return true on success, false if the content is malformed or the end-of-contents octets are not found
+inline bool extract_indefinite_content_length(std::span<const uint8_t> input, size_t& length) noexcept;
+
 inline bool extract_construction(std::span<const uint8_t> input, Construction& construction) noexcept
 {
     if (input.size() == 0)
@@ -105,9 +120,11 @@ inline size_t extract_tag(std::span<const uint8_t> input, Tag& tag) noexcept
     }
 }
 
-inline size_t extract_length(std::span<const uint8_t> input, size_t& length, size_t length_offset) noexcept
+inline size_t extract_length(std::span<const uint8_t> input, size_t& length, size_t length_offset,
+                             bool& indefinite) noexcept
 {
-    input = input.subspan(length_offset);
+    indefinite = false;
+    input      = input.subspan(length_offset);
     if (input.size() == 0)
     {
         return 0;
@@ -119,6 +136,13 @@ inline size_t extract_length(std::span<const uint8_t> input, size_t& length, siz
         return 1;
     }
 
+    if (input[0] == 0x80)
+    {
+        length     = 0;
+        indefinite = true;
+        return 1;
+    }
+
     const size_t tag_length = input[0] & 0x7F;
     if (tag_length > 8 || tag_length == 0 || tag_length + 1 > input.size())
     {
@@ -134,4 +158,67 @@ inline size_t extract_length(std::span<const uint8_t> input, size_t& length, siz
     return tag_length + 1;
 }
 
+inline size_t extract_length(std::span<const uint8_t> input, size_t& length, size_t length_offset) noexcept
+{
+    bool         indefinite    = false;
+    const size_t length_length = extract_length(input, length, length_offset, indefinite);
+    return indefinite ? 0 : length_length;
+}
+
+inline bool is_end_of_contents(std::span<const uint8_t> input) noexcept
+{
+    return input.size() >= 2 && input[0] == 0x00 && input[1] == 0x00;
+}
+
+inline bool extract_indefinite_content_length(std::span<const uint8_t> input, size_t& length) noexcept
+{
+    size_t                   depth     = 0;
+    std::span<const uint8_t> remaining = input;
+    while (!remaining.empty())
+    {
+        if (is_end_of_contents(remaining))
+        {
+            if (depth == 0)
+            {
+                length = input.size() - remaining.size();
+                return true;
+            }
+            depth--;
+            remaining = remaining.last(remaining.size() - 2);
+            continue;
+        }
+
+        Tag          tag            = 0;
+        size_t       content_length = 0;
+        bool         indefinite     = false;
+        const size_t tag_length     = extract_tag(remaining, tag);
+        const size_t length_length =
+            (tag_length == 0) ? 0 : extract_length(remaining, content_length, tag_length, indefinite);
+        if (length_length == 0)
+        {
+            return false;
+        }
+
+        const bool constructed = get_construction(remaining[0]) == Construction::constructed;
+        remaining              = remaining.last(remaining.size() - tag_length - length_length);
+        if (indefinite)
+        {
+            if (!constructed)
+            {
+                return false;
+            }
+            depth++;
+        }
+        else
+        {
+            if (content_length > remaining.size())
+            {
+                return false;
+            }
+            remaining = remaining.last(remaining.size() - content_length);
+        }
+    }
+    return false;
+}
+
 } // namespace fast_ber
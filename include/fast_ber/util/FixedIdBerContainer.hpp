@@ -1,25 +1,31 @@
 #pragma once
 
 #include "fast_ber/ber_types/Identifier.hpp"
+#include "fast_ber/util/Arena.hpp"
 #include "fast_ber/util/BerContainer.hpp"
 #include "fast_ber/util/BerView.hpp"
 #include "fast_ber/util/DecodeHelpers.hpp"
 #include "fast_ber/util/EncodeHelpers.hpp"
 #include "fast_ber/util/Error.hpp"
+#include "fast_ber/util/SmallVector.hpp"
 
-#include <vector>
 #include <span>
 
+#include <algorithm>
 #include <array>
 
 namespace fast_ber
 {
 
+// Encodings of up to this many bytes, header included, are stored within a FixedIdBerContainer by default
+constexpr size_t default_inline_ber_length = 24;
+
 // Owning container of a ber packet. Contents may or may not be valid. Memory is stored in a small buffer optimized
-// vector. Can be constructed directly from encoded ber memory (decode()) or by specifiyng the desired contents
-// (assign_contents)
+// vector, packets of up to inline_length bytes are stored without allocating. Can be constructed directly from encoded
+// ber memory (decode()) or by specifiyng the desired contents (assign_contents). The packet is followed by a zero byte,
+// so that the content of a string can be read as a C string
 
-template <typename Identifier>
+template <typename Identifier, size_t inline_length = default_inline_ber_length>
 class FixedIdBerContainer
 {
   public:
@@ -30,15 +36,15 @@ class FixedIdBerContainer
     FixedIdBerContainer(std::span<const uint8_t> input_data, ConstructionMethod method) noexcept;
     FixedIdBerContainer(Construction input_construction, Class input_class, Tag input_tag,
                         std::span<const uint8_t> input_content) noexcept;
-    template <typename Identifier2>
-    FixedIdBerContainer(const FixedIdBerContainer<Identifier2>& rhs) noexcept;
+    template <typename Identifier2, size_t inline_length2>
+    FixedIdBerContainer(const FixedIdBerContainer<Identifier2, inline_length2>& rhs) noexcept;
     ~FixedIdBerContainer() noexcept = default;
 
     FixedIdBerContainer& operator=(BerView input_view) noexcept;
     FixedIdBerContainer& operator=(const FixedIdBerContainer& input_container) noexcept;
     FixedIdBerContainer& operator=(FixedIdBerContainer&& input_container) noexcept;
-    template <typename Identifier2>
-    FixedIdBerContainer& operator=(const FixedIdBerContainer<Identifier2>& rhs) noexcept;
+    template <typename Identifier2, size_t inline_length2>
+    FixedIdBerContainer& operator=(const FixedIdBerContainer<Identifier2, inline_length2>& rhs) noexcept;
 
     void assign_content(const std::span<const uint8_t> input_content) noexcept;
     void resize_content(size_t size);
@@ -48,20 +54,20 @@ class FixedIdBerContainer
 
     std::span<uint8_t>       content() noexcept { return std::span(content_data(), m_content_length); }
     std::span<const uint8_t> content() const noexcept { return std::span(content_data(), m_content_length); }
-    uint8_t*                  content_data() noexcept { return m_data.data() + m_data.size() - m_content_length; }
-    const uint8_t*            content_data() const noexcept { return m_data.data() + m_data.size() - m_content_length; }
+    uint8_t*                  content_data() noexcept { return m_data.data() + ber_length() - m_content_length; }
+    const uint8_t*            content_data() const noexcept { return m_data.data() + ber_length() - m_content_length; }
     size_t                    content_length() const noexcept { return m_content_length; }
 
-    std::span<const uint8_t> ber() const noexcept { return std::span(m_data.begin(), m_data.end()); }
+    std::span<const uint8_t> ber() const noexcept { return std::span(m_data.data(), ber_length()); }
     const uint8_t*            ber_data() const noexcept { return m_data.data(); }
-    size_t                    ber_length() const noexcept { return m_data.size(); }
+    size_t                    ber_length() const noexcept { return m_data.size() - 1; }
 
-    bool operator==(const FixedIdBerContainer& rhs) const { return content() == rhs.content(); }
+    bool operator==(const FixedIdBerContainer& rhs) const { return std::ranges::equal(content(), rhs.content()); }
     bool operator!=(const FixedIdBerContainer& rhs) const { return !(*this == rhs); }
 
-    BerView view() const noexcept { return BerView(m_data); }
+    BerView view() const noexcept { return BerView(ber()); }
 
-    size_t       encoded_length() const noexcept { return m_data.size(); }
+    size_t       encoded_length() const noexcept { return ber_length(); }
     EncodeResult encode(std::span<uint8_t> buffer) const noexcept;
     DecodeResult decode(BerView view) noexcept;
 
@@ -71,33 +77,38 @@ class FixedIdBerContainer
     template <typename Identifier1, typename Identifier2>
     DecodeResult decode_impl(BerView input_view, DoubleId<Identifier1, Identifier2>) noexcept;
 
-    std::vector<uint8_t> m_data;
-    size_t                             m_content_length{0};
+    // Resizes the storage to hold a packet of the given length and its terminating zero
+    uint8_t* resize_packet(size_t length);
+    void     assign_packet(std::span<const uint8_t> packet);
+
+    SmallVector<uint8_t, inline_length + 1, ArenaAllocator<uint8_t>> m_data{uint8_t{0}}; // Empty packet
+    size_t                                                           m_content_length{0};
 };
 
-template <typename Identifier>
-FixedIdBerContainer<Identifier>::FixedIdBerContainer() noexcept : m_data()
+template <typename Identifier, size_t inline_length>
+FixedIdBerContainer<Identifier, inline_length>::FixedIdBerContainer() noexcept
 {
-    m_data.resize(fast_ber::encoded_length(0, Identifier{}));
-    encode_header(std::span<uint8_t>(m_data), 0, Identifier{}, Construction::primitive);
+    const size_t length = fast_ber::encoded_length(0, Identifier{});
+    encode_header(std::span<uint8_t>(resize_packet(length), length), 0, Identifier{}, Construction::primitive);
 }
 
-template <typename Identifier>
-FixedIdBerContainer<Identifier>::FixedIdBerContainer(const FixedIdBerContainer& rhs) noexcept
+template <typename Identifier, size_t inline_length>
+FixedIdBerContainer<Identifier, inline_length>::FixedIdBerContainer(const FixedIdBerContainer& rhs) noexcept
     : m_data(rhs.m_data), m_content_length(rhs.m_content_length)
 {
 }
 
-template <typename Identifier>
-FixedIdBerContainer<Identifier>::FixedIdBerContainer(FixedIdBerContainer&& rhs) noexcept
+template <typename Identifier, size_t inline_length>
+FixedIdBerContainer<Identifier, inline_length>::FixedIdBerContainer(FixedIdBerContainer&& rhs) noexcept
     : m_data(std::move(rhs.m_data)), m_content_length(std::move(rhs.m_content_length))
 {
+    rhs.resize_packet(0);
+    rhs.m_content_length = 0;
 }
 
-template <typename Identifier>
-FixedIdBerContainer<Identifier>::FixedIdBerContainer(std::span<const uint8_t> input_data,
-                                                     ConstructionMethod        method) noexcept
-    : m_data()
+template <typename Identifier, size_t inline_length>
+FixedIdBerContainer<Identifier, inline_length>::FixedIdBerContainer(std::span<const uint8_t> input_data,
+                                                                    ConstructionMethod        method) noexcept
 {
     if (method == ConstructionMethod::construct_with_provided_content)
     {
@@ -113,146 +124,181 @@ FixedIdBerContainer<Identifier>::FixedIdBerContainer(std::span<const uint8_t> in
     }
 }
 
-template <typename Identifier>
-FixedIdBerContainer<Identifier>::FixedIdBerContainer(Construction input_construction, Class input_class, Tag input_tag,
-                                                     std::span<const uint8_t> input_content) noexcept
+template <typename Identifier, size_t inline_length>
+FixedIdBerContainer<Identifier, inline_length>::FixedIdBerContainer(Construction input_construction, Class input_class,
+                                                                    Tag input_tag,
+                                                                    std::span<const uint8_t> input_content) noexcept
 {
     assign_content(input_construction, input_class, input_tag, input_content);
 }
 
-template <typename Identifier>
-template <typename Identifier2>
-FixedIdBerContainer<Identifier>::FixedIdBerContainer(const FixedIdBerContainer<Identifier2>& rhs) noexcept
+template <typename Identifier, size_t inline_length>
+template <typename Identifier2, size_t inline_length2>
+FixedIdBerContainer<Identifier, inline_length>::FixedIdBerContainer(
+    const FixedIdBerContainer<Identifier2, inline_length2>& rhs) noexcept
 {
     assign_content(rhs.content());
 }
 
-template <typename Identifier>
-FixedIdBerContainer<Identifier>& FixedIdBerContainer<Identifier>::operator=(BerView input_view) noexcept
+template <typename Identifier, size_t inline_length>
+FixedIdBerContainer<Identifier, inline_length>&
+FixedIdBerContainer<Identifier, inline_length>::operator=(BerView input_view) noexcept
 {
     decode(input_view);
     return *this;
 }
 
-template <typename Identifier1>
-FixedIdBerContainer<Identifier1>&
-FixedIdBerContainer<Identifier1>::operator=(const FixedIdBerContainer<Identifier1>& rhs) noexcept
+template <typename Identifier1, size_t inline_length>
+FixedIdBerContainer<Identifier1, inline_length>&
+FixedIdBerContainer<Identifier1, inline_length>::operator=(
+    const FixedIdBerContainer<Identifier1, inline_length>& rhs) noexcept
 {
     m_data           = rhs.m_data;
     m_content_length = rhs.m_content_length;
     return *this;
 }
 
-template <typename Identifier1>
-FixedIdBerContainer<Identifier1>&
-FixedIdBerContainer<Identifier1>::operator=(FixedIdBerContainer<Identifier1>&& rhs) noexcept
+template <typename Identifier1, size_t inline_length>
+FixedIdBerContainer<Identifier1, inline_length>&
+FixedIdBerContainer<Identifier1, inline_length>::operator=(
+    FixedIdBerContainer<Identifier1, inline_length>&& rhs) noexcept
 {
-    m_data           = std::move(rhs.m_data);
-    m_content_length = std::move(rhs.m_content_length);
+    if (this != &rhs)
+    {
+        m_data           = std::move(rhs.m_data);
+        m_content_length = std::move(rhs.m_content_length);
+        rhs.resize_packet(0);
+        rhs.m_content_length = 0;
+    }
     return *this;
 }
 
-template <typename Identifier1>
-template <typename Identifier2>
-FixedIdBerContainer<Identifier1>&
-FixedIdBerContainer<Identifier1>::operator=(const FixedIdBerContainer<Identifier2>& rhs) noexcept
+template <typename Identifier1, size_t inline_length>
+template <typename Identifier2, size_t inline_length2>
+FixedIdBerContainer<Identifier1, inline_length>&
+FixedIdBerContainer<Identifier1, inline_length>::operator=(
+    const FixedIdBerContainer<Identifier2, inline_length2>& rhs) noexcept
 {
     assign_content(rhs.content());
     return *this;
 }
 
-template <typename Identifier>
+template <typename Identifier, size_t inline_length>
 template <Class class_1, Tag tag_1>
-DecodeResult FixedIdBerContainer<Identifier>::decode_impl(BerView input_view, Id<class_1, tag_1> id) noexcept
+DecodeResult FixedIdBerContainer<Identifier, inline_length>::decode_impl(BerView            input_view,
+                                                                         Id<class_1, tag_1> id) noexcept
 {
     if (!has_correct_header(input_view, id, Construction::primitive))
     {
         if (!input_view.is_valid())
         {
             FAST_BER_ERROR("Invalid packet when decoding packet with tag [", id, "]");
+            return DecodeResult{false, DecodeError::invalid_packet};
         }
-        else
-        {
-            FAST_BER_ERROR("Incorrect header [", input_view.identifier(), "] when decoding packet with tag [", id, "]");
-        }
-        return DecodeResult{false};
+        FAST_BER_ERROR("Incorrect header [", input_view.identifier(), "] when decoding packet with tag [", id, "]");
+        return DecodeResult{false, DecodeError::invalid_header};
     }
 
-    m_data.assign(input_view.ber().begin(), input_view.ber().end());
+    assign_packet(input_view.ber());
     m_content_length = input_view.content_length();
     return DecodeResult{true};
 }
 
-template <typename Identifier>
+template <typename Identifier, size_t inline_length>
 template <typename Identifier1, typename Identifier2>
-DecodeResult FixedIdBerContainer<Identifier>::decode_impl(BerView                            input_view,
-                                                          DoubleId<Identifier1, Identifier2> id) noexcept
+DecodeResult FixedIdBerContainer<Identifier, inline_length>::decode_impl(BerView                            input_view,
+                                                                         DoubleId<Identifier1, Identifier2> id) noexcept
 {
     if (!has_correct_header(input_view, id, Construction::primitive))
     {
         if (!input_view.is_valid() || !input_view.begin()->is_valid())
         {
             FAST_BER_ERROR("Invalid packet when decoding packet with tag [", id, "]");
+            return DecodeResult{false, DecodeError::invalid_packet};
         }
-        else
-        {
-            FAST_BER_ERROR("Incorrect header [", input_view.identifier(), ", ", input_view.begin()->identifier(),
-                           "] when decoding packet with tag [", id, "]");
-        }
-        return DecodeResult{false};
+        FAST_BER_ERROR("Incorrect header [", input_view.identifier(), ", ", input_view.begin()->identifier(),
+                       "] when decoding packet with tag [", id, "]");
+        return DecodeResult{false, DecodeError::invalid_header};
     }
 
-    m_data.assign(input_view.ber().begin(), input_view.ber().end());
+    if (input_view.is_indefinite_length())
+    {
+        // Content is located at the end of the stored packet, so store in definite length form
+        assign_content(input_view.begin()->content());
+        return DecodeResult{true};
+    }
+
+    assign_packet(input_view.ber());
     m_content_length = input_view.begin()->content_length();
     return DecodeResult{true};
 }
 
-template <typename Identifier>
-void FixedIdBerContainer<Identifier>::assign_content(const std::span<const uint8_t> input_content) noexcept
+template <typename Identifier, size_t inline_length>
+void FixedIdBerContainer<Identifier, inline_length>::assign_content(
+    const std::span<const uint8_t> input_content) noexcept
 {
     const size_t encoded_len = fast_ber::encoded_length(input_content.size(), Identifier{});
     const size_t header_len  = encoded_len - input_content.size();
 
-    m_data.resize(encoded_len);
-    std::memcpy(m_data.data() + header_len, input_content.data(), input_content.size());
-    encode_header(std::span<uint8_t>(m_data), input_content.size(), Identifier{}, Construction::primitive);
+    uint8_t* const packet = resize_packet(encoded_len);
+    encode_header(std::span<uint8_t>(packet, encoded_len), input_content.size(), Identifier{},
+                  Construction::primitive);
+    std::copy(input_content.begin(), input_content.end(), packet + header_len);
     m_content_length = input_content.size();
 
     assert(view().is_valid());
 }
 
-template <typename Identifier>
-void FixedIdBerContainer<Identifier>::resize_content(size_t size)
+template <typename Identifier, size_t inline_length>
+void FixedIdBerContainer<Identifier, inline_length>::resize_content(size_t size)
 {
-    size_t old_header_length = m_data.size() - content_length();
+    size_t old_header_length = ber_length() - content_length();
     size_t new_header_length = encoded_header_length(size, Identifier{});
 
-    m_data.resize(new_header_length + size);
+    if (new_header_length + size > ber_length())
+    {
+        m_data.resize(new_header_length + size + 1);
+    }
     std::memmove(m_data.data() + new_header_length, m_data.data() + old_header_length,
                  std::min(m_content_length, size));
+    resize_packet(new_header_length + size);
 
-    encode_header(std::span<uint8_t>(m_data), size, Identifier{}, Construction::primitive);
+    encode_header(std::span<uint8_t>(m_data.data(), ber_length()), size, Identifier{}, Construction::primitive);
     m_content_length = size;
 
     assert(view().is_valid());
 }
 
-template <typename Identifier>
-EncodeResult FixedIdBerContainer<Identifier>::encode(std::span<uint8_t> buffer) const noexcept
+template <typename Identifier, size_t inline_length>
+EncodeResult FixedIdBerContainer<Identifier, inline_length>::encode(std::span<uint8_t> buffer) const noexcept
 {
-    if (buffer.size() < m_data.size())
+    if (buffer.size() < ber_length())
     {
         return EncodeResult{false, 0};
     }
 
-    memcpy(buffer.data(), m_data.data(), m_data.size());
-    return EncodeResult{true, m_data.size()};
+    memcpy(buffer.data(), m_data.data(), ber_length());
+    return EncodeResult{true, ber_length()};
 }
 
-template <typename Identifier>
-DecodeResult FixedIdBerContainer<Identifier>::decode(BerView view) noexcept
+template <typename Identifier, size_t inline_length>
+DecodeResult FixedIdBerContainer<Identifier, inline_length>::decode(BerView view) noexcept
 {
     return decode_impl(view, Identifier{});
 }
 
+template <typename Identifier, size_t inline_length>
+uint8_t* FixedIdBerContainer<Identifier, inline_length>::resize_packet(size_t length)
+{
+    m_data.resize(length + 1);
+    m_data[length] = 0;
+    return m_data.data();
+}
+
+template <typename Identifier, size_t inline_length>
+void FixedIdBerContainer<Identifier, inline_length>::assign_packet(std::span<const uint8_t> packet)
+{
+    std::copy(packet.begin(), packet.end(), resize_packet(packet.size()));
+}
+
 } // namespace fast_ber
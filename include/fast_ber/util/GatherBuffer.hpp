@@ -0,0 +1,189 @@
+#pragma once
+
+#include "fast_ber/ber_types/Identifier.hpp"
+#include "fast_ber/util/EncodeHelpers.hpp"
+#include "fast_ber/util/EncodeIdentifiers.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include <cstdint>
+
+#ifndef _WIN32
+#include <sys/uio.h>
+#endif
+
+namespace fast_ber
+{
+
+// Encoding of an object as a list of segments, to be written with a single scatter/gather call such as writev().
+// Headers and small values are written to a scratch buffer. Encodings at least reference_threshold bytes long, such as
+// the contents of large strings, are referenced where they are stored within the encoded object, which must not be
+// modified or destroyed while the segments are in use. Segments are only valid until the next encode.
+class GatherBuffer
+{
+  public:
+    static constexpr size_t default_scratch_capacity    = 4096;
+    static constexpr size_t default_reference_threshold = 256;
+
+    explicit GatherBuffer(size_t scratch_capacity    = default_scratch_capacity,
+                          size_t reference_threshold = default_reference_threshold)
+        : m_scratch(std::make_unique_for_overwrite<uint8_t[]>(scratch_capacity)),
+          m_scratch_capacity(scratch_capacity), m_scratch_free(scratch_capacity),
+          m_reference_threshold(reference_threshold)
+    {
+    }
+
+    std::span<const std::span<const uint8_t>> segments() const noexcept { return m_segments; }
+    size_t                                     length() const noexcept { return m_length; }
+    size_t                                     scratch_capacity() const noexcept { return m_scratch_capacity; }
+    size_t                                     reference_threshold() const noexcept { return m_reference_threshold; }
+
+#ifndef _WIN32
+    // Segments in the form taken by writev()
+    std::span<const iovec> iovecs();
+#endif
+
+    void clear() noexcept
+    {
+        m_segments.clear();
+        m_scratch_free = m_scratch_capacity;
+        m_length       = 0;
+    }
+
+    // Objects are encoded back to front, as with encode_reverse(). Segments are prepended until the encoding is
+    // complete, when finish() puts them in order
+
+    // Unused scratch, an encoding written to its end is added by commit_scratch()
+    std::span<uint8_t> free_scratch() noexcept { return std::span<uint8_t>(m_scratch.get(), m_scratch_free); }
+    void               commit_scratch(size_t length) noexcept;
+    // Reference an encoding in place if it is long enough, otherwise copy it to scratch
+    EncodeResult add_encoding(std::span<const uint8_t> encoding) noexcept;
+    void         finish() noexcept { std::reverse(m_segments.begin(), m_segments.end()); }
+
+  private:
+    std::unique_ptr<uint8_t[]>            m_scratch;
+    size_t                                m_scratch_capacity;
+    size_t                                m_scratch_free; // Scratch is filled from the back
+    size_t                                m_reference_threshold;
+    size_t                                m_length = 0;
+    std::vector<std::span<const uint8_t>> m_segments;
+#ifndef _WIN32
+    std::vector<iovec> m_iovecs;
+#endif
+};
+
+inline void GatherBuffer::commit_scratch(size_t length) noexcept
+{
+    // Scratch written directly before the previously added segment extends it
+    const uint8_t* const previous_start = m_scratch.get() + m_scratch_free;
+    m_scratch_free -= length;
+    m_length += length;
+    if (!m_segments.empty() && m_segments.back().data() == previous_start)
+    {
+        m_segments.back() = std::span<const uint8_t>(previous_start - length, m_segments.back().size() + length);
+    }
+    else if (length > 0)
+    {
+        m_segments.push_back(std::span<const uint8_t>(m_scratch.get() + m_scratch_free, length));
+    }
+}
+
+inline EncodeResult GatherBuffer::add_encoding(std::span<const uint8_t> encoding) noexcept
+{
+    if (encoding.size() >= m_reference_threshold)
+    {
+        m_segments.push_back(encoding);
+        m_length += encoding.size();
+        return EncodeResult{true, encoding.size()};
+    }
+
+    if (encoding.size() > m_scratch_free)
+    {
+        return EncodeResult{false, 0};
+    }
+    std::copy(encoding.begin(), encoding.end(), free_scratch().last(encoding.size()).begin());
+    commit_scratch(encoding.size());
+    return EncodeResult{true, encoding.size()};
+}
+
+#ifndef _WIN32
+inline std::span<const iovec> GatherBuffer::iovecs()
+{
+    m_iovecs.resize(m_segments.size());
+    for (size_t i = 0; i < m_segments.size(); i++)
+    {
+        // writev() does not modify the segments
+        m_iovecs[i].iov_base = const_cast<uint8_t*>(m_segments[i].data()); // NOLINT
+        m_iovecs[i].iov_len  = m_segments[i].size();
+    }
+    return m_iovecs;
+}
+#endif
+
+// Prepend the header of a packet whose content_length bytes of content have already been added
+template <Class class_, Tag tag>
+EncodeResult encode_gather_header(GatherBuffer& output, size_t content_length, Id<class_, tag> id,
+                                  Construction construction = Construction::constructed) noexcept
+{
+    const size_t header_length = encoded_header_length(content_length, id);
+    if (header_length > output.free_scratch().size())
+    {
+        return EncodeResult{false, 0};
+    }
+
+    encode_header(output.free_scratch().last(header_length), content_length, id, construction);
+    output.commit_scratch(header_length);
+    return EncodeResult{true, header_length + content_length};
+}
+
+template <typename OuterId, typename InnerId>
+EncodeResult encode_gather_header(GatherBuffer& output, size_t content_length, DoubleId<OuterId, InnerId> id,
+                                  Construction construction = Construction::constructed) noexcept
+{
+    const EncodeResult inner = encode_gather_header(output, content_length, id.inner_id(), construction);
+    if (!inner.success)
+    {
+        return inner;
+    }
+    return encode_gather_header(output, inner.length, id.outer_id(), Construction::constructed);
+}
+
+// Prepend the encoding of an object. Constructed types provide encode_gather(), adding their children before their
+// header, and strings add the encoding they hold. Other types are encoded into scratch
+template <typename T>
+EncodeResult encode_gather(GatherBuffer& output, const T& object) noexcept
+{
+    if constexpr (requires { object.encode_gather(output); })
+    {
+        return object.encode_gather(output);
+    }
+    else
+    {
+        const EncodeResult result = fast_ber::encode_reverse(output.free_scratch(), object);
+        if (result.success)
+        {
+            output.commit_scratch(result.length);
+        }
+        return result;
+    }
+}
+
+// Encode an object as a list of segments, replacing the previous contents of output
+template <typename T>
+EncodeResult encode(GatherBuffer& output, const T& object) noexcept
+{
+    output.clear();
+    const EncodeResult result = encode_gather(output, object);
+    if (!result.success)
+    {
+        output.clear();
+        return result;
+    }
+    output.finish();
+    return result;
+}
+
+} // namespace fast_ber
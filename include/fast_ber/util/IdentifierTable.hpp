@@ -0,0 +1,179 @@
+#pragma once
+
+#include "fast_ber/ber_types/Class.hpp"
+#include "fast_ber/ber_types/Construction.hpp"
+#include "fast_ber/ber_types/Tag.hpp"
+#include "fast_ber/util/BerView.hpp"
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+#include <cstdint>
+
+namespace fast_ber
+{
+
+// Identifier of a member or alternative of a generated type, and the index of that member or alternative
+struct IdentifierEntry
+{
+    Class    class_ = Class::universal;
+    Tag      tag    = 0;
+    uint16_t index  = 0;
+};
+
+namespace detail
+{
+
+// Identifiers with tag numbers below 31 are a single octet, of which only the construction bit does not identify the
+// type. Such octets, with the construction bit cleared, are used as keys into lookup tables
+constexpr Tag short_tag_limit = 31;
+
+constexpr bool is_short_identifier(uint8_t first_octet) noexcept { return (first_octet & 0x1F) != 0x1F; }
+
+constexpr uint8_t identifier_key(uint8_t first_octet) noexcept
+{
+    return static_cast<uint8_t>(first_octet & ~construction_mask);
+}
+
+constexpr uint8_t identifier_key(Class class_, Tag tag) noexcept
+{
+    return static_cast<uint8_t>((static_cast<uint8_t>(class_) << class_offset) | static_cast<uint8_t>(tag));
+}
+
+constexpr bool identifier_less(const IdentifierEntry& lhs, const IdentifierEntry& rhs) noexcept
+{
+    return lhs.class_ != rhs.class_ ? lhs.class_ < rhs.class_ : lhs.tag < rhs.tag;
+}
+
+// Identifiers with long form tags, which are rare, sorted for binary search
+template <size_t N>
+struct LongFormIdentifiers
+{
+    std::array<IdentifierEntry, N> entries = {};
+    size_t                         count   = 0;
+
+    constexpr void add(const IdentifierEntry& entry) noexcept { entries[count++] = entry; }
+    constexpr void sort() noexcept { std::sort(entries.begin(), entries.begin() + count, identifier_less); }
+
+    constexpr const IdentifierEntry* find(Class class_, Tag tag) const noexcept
+    {
+        const IdentifierEntry        key{class_, tag};
+        const IdentifierEntry* const end   = entries.data() + count;
+        const IdentifierEntry* const found = std::lower_bound(entries.data(), end, key, identifier_less);
+        return (found != end && found->class_ == class_ && found->tag == tag) ? found : nullptr;
+    }
+};
+
+} // namespace detail
+
+// Map from identifiers to the index of the member or alternative they identify, used by generated SET and CHOICE
+// decoders. Identifiers of a single octet are found with one table lookup keyed on that octet.
+template <size_t N>
+class IdentifierTable
+{
+  public:
+    static constexpr size_t no_match = std::numeric_limits<uint16_t>::max();
+
+    constexpr explicit IdentifierTable(const std::array<IdentifierEntry, N>& entries) noexcept
+    {
+        std::fill(m_short.begin(), m_short.end(), static_cast<uint16_t>(no_match));
+        for (const IdentifierEntry& entry : entries)
+        {
+            if (entry.tag >= 0 && entry.tag < detail::short_tag_limit)
+            {
+                m_short[detail::identifier_key(entry.class_, entry.tag)] = entry.index;
+            }
+            else
+            {
+                m_long.add(entry);
+            }
+        }
+        m_long.sort();
+    }
+
+    // Index of the entry with the identifier of the packet, no_match if there is none or the packet is invalid
+    size_t find(const BerView& packet) const noexcept
+    {
+        if (!packet.is_valid())
+        {
+            return no_match;
+        }
+        const uint8_t first_octet = packet.ber_data()[0];
+        if (detail::is_short_identifier(first_octet))
+        {
+            return m_short[detail::identifier_key(first_octet)];
+        }
+        return find(packet.class_(), packet.tag());
+    }
+
+    constexpr size_t find(Class class_, Tag tag) const noexcept
+    {
+        if (tag >= 0 && tag < detail::short_tag_limit)
+        {
+            return m_short[detail::identifier_key(class_, tag)];
+        }
+        const IdentifierEntry* const entry = m_long.find(class_, tag);
+        return entry ? entry->index : no_match;
+    }
+
+  private:
+    std::array<uint16_t, 256>      m_short = {};
+    detail::LongFormIdentifiers<N> m_long;
+};
+
+// Set of identifiers, used by generated SEQUENCE decoders to check for optional members. Identifiers of a single octet
+// are tested with one bit of a 256 bit mask keyed on that octet.
+template <size_t N>
+class IdentifierSet
+{
+  public:
+    constexpr explicit IdentifierSet(const std::array<IdentifierEntry, N>& entries) noexcept
+    {
+        for (const IdentifierEntry& entry : entries)
+        {
+            if (entry.tag >= 0 && entry.tag < detail::short_tag_limit)
+            {
+                const uint8_t key = detail::identifier_key(entry.class_, entry.tag);
+                m_short[key / 64] |= uint64_t{1} << (key % 64);
+            }
+            else
+            {
+                m_long.add(entry);
+            }
+        }
+        m_long.sort();
+    }
+
+    // Whether the packet is valid and has one of the identifiers
+    bool contains(const BerView& packet) const noexcept
+    {
+        if (!packet.is_valid())
+        {
+            return false;
+        }
+        const uint8_t first_octet = packet.ber_data()[0];
+        if (detail::is_short_identifier(first_octet))
+        {
+            const uint8_t key = detail::identifier_key(first_octet);
+            return ((m_short[key / 64] >> (key % 64)) & 1) != 0;
+        }
+        return contains(packet.class_(), packet.tag());
+    }
+
+    constexpr bool contains(Class class_, Tag tag) const noexcept
+    {
+        if (tag >= 0 && tag < detail::short_tag_limit)
+        {
+            const uint8_t key = detail::identifier_key(class_, tag);
+            return ((m_short[key / 64] >> (key % 64)) & 1) != 0;
+        }
+        return m_long.find(class_, tag) != nullptr;
+    }
+
+  private:
+    std::array<uint64_t, 4>        m_short = {};
+    detail::LongFormIdentifiers<N> m_long;
+};
+
+} // namespace fast_ber
@@ -0,0 +1,290 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#endif
+
+// The generated encode_with_id and decode_with_id functions of each type call an instrumentation policy chosen at
+// compile time, by defining FAST_BER_INSTRUMENTATION to the policy type before including any generated header. The
+// policy must be the same in every translation unit.
+//
+// fast_ber::NoInstrumentation          - Nothing is recorded and no code is generated. Default
+// fast_ber::CountingInstrumentation    - Calls, failures and bytes are counted for each type
+// fast_ber::CycleInstrumentation       - As counting, with the cycles spent in each type
+// fast_ber::SamplingInstrumentation<N> - Cycles of one in every N outermost calls, and the calls nested within them,
+//                                        are recorded and passed to the trace callback. Statistics are scaled by N
+//
+// Statistics are kept for each generated type and can be written as a flat profile with
+// fast_ber/util/InstrumentationProfile.hpp. A custom policy is a type with the following static members, declared
+// after including this header and before fast_ber/util/InstrumentationHooks.hpp
+//
+//   constexpr static bool enabled = true;
+//   using Token = ...; // State kept from entry to exit of a call
+//   static Token enter(InstrumentedType& type, Operation operation) noexcept;
+//   static void  exit(InstrumentedType& type, Operation operation, const Token& token, size_t bytes,
+//                     bool success) noexcept;
+
+namespace fast_ber
+{
+
+enum class Operation : uint8_t
+{
+    decode,
+    encode,
+};
+
+constexpr size_t operation_kinds = static_cast<size_t>(Operation::encode) + 1;
+
+constexpr const char* to_string(Operation operation) noexcept
+{
+    return operation == Operation::decode ? "decode" : "encode";
+}
+
+struct OperationStatistics
+{
+    std::atomic<uint64_t> calls       = 0;
+    std::atomic<uint64_t> failures    = 0;
+    std::atomic<uint64_t> bytes       = 0;
+    std::atomic<uint64_t> cycles      = 0; // Including types nested within the type
+    std::atomic<uint64_t> self_cycles = 0; // Excluding types nested within the type
+};
+
+// Statistics of a generated type, registered on its first instrumented call
+struct InstrumentedType
+{
+    std::atomic<const char*>                         name       = nullptr;
+    std::atomic<InstrumentedType*>                   next       = nullptr;
+    std::atomic<bool>                                registered = false;
+    std::array<OperationStatistics, operation_kinds> statistics = {};
+
+    OperationStatistics&       operator[](Operation operation) noexcept { return statistics[index(operation)]; }
+    const OperationStatistics& operator[](Operation operation) const noexcept { return statistics[index(operation)]; }
+
+  private:
+    static constexpr size_t index(Operation operation) noexcept { return static_cast<size_t>(operation); }
+};
+
+// A call recorded by the sampling policy. Depth is zero for the outermost call, cycles include nested types
+struct TraceEvent
+{
+    const char* type;
+    Operation   operation;
+    bool        success;
+    size_t      depth;
+    size_t      bytes;
+    uint64_t    cycles;
+};
+
+using TraceCallback = void (*)(const TraceEvent& event, void* context);
+
+namespace detail
+{
+
+// Constant initialised, so the statistics of a type need no guard on access
+template <typename T>
+inline InstrumentedType instrumented_type = {};
+
+inline std::atomic<InstrumentedType*> instrumented_types = nullptr;
+
+inline std::atomic<TraceCallback> trace_callback = nullptr;
+inline std::atomic<void*>         trace_context  = nullptr;
+
+// Cycles spent in calls nested within the current call of this thread, and the sampling state of the thread
+inline thread_local uint64_t nested_cycles   = 0;
+inline thread_local size_t   sampling_depth  = 0;
+inline thread_local uint64_t sampling_calls  = 0;
+inline thread_local bool     sampling_active = false;
+
+inline void register_type(InstrumentedType& type, const char* name) noexcept
+{
+    if (type.registered.exchange(true, std::memory_order_acq_rel))
+    {
+        return;
+    }
+    type.name.store(name, std::memory_order_relaxed);
+    InstrumentedType* head = instrumented_types.load(std::memory_order_relaxed);
+    do
+    {
+        type.next.store(head, std::memory_order_relaxed);
+    } while (!instrumented_types.compare_exchange_weak(head, &type, std::memory_order_release,
+                                                       std::memory_order_relaxed));
+}
+
+inline void add(std::atomic<uint64_t>& statistic, uint64_t value) noexcept
+{
+    statistic.fetch_add(value, std::memory_order_relaxed);
+}
+
+} // namespace detail
+
+// Statistics of generated type T, named name. Registers the type for instrumented_types() on first use
+template <typename T>
+InstrumentedType& instrumented_type(const char* name) noexcept
+{
+    InstrumentedType& type = detail::instrumented_type<T>;
+    if (!type.registered.load(std::memory_order_relaxed))
+    {
+        detail::register_type(type, name);
+    }
+    return type;
+}
+
+// Types in reverse order of registration, ended by nullptr. Types are never removed
+inline const InstrumentedType* instrumented_types() noexcept
+{
+    return detail::instrumented_types.load(std::memory_order_acquire);
+}
+
+inline void reset_instrumentation() noexcept
+{
+    for (InstrumentedType* type = detail::instrumented_types.load(std::memory_order_acquire); type != nullptr;
+         type                   = type->next.load(std::memory_order_relaxed))
+    {
+        for (OperationStatistics& statistics : type->statistics)
+        {
+            statistics.calls.store(0, std::memory_order_relaxed);
+            statistics.failures.store(0, std::memory_order_relaxed);
+            statistics.bytes.store(0, std::memory_order_relaxed);
+            statistics.cycles.store(0, std::memory_order_relaxed);
+            statistics.self_cycles.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+// The callback may be called concurrently from any thread encoding or decoding, and must not throw
+inline void set_trace_callback(TraceCallback callback, void* context = nullptr) noexcept
+{
+    detail::trace_context.store(context, std::memory_order_relaxed);
+    detail::trace_callback.store(callback, std::memory_order_release);
+}
+
+// Time stamp counter where available, otherwise nanoseconds of the steady clock. Only differences between readings
+// on the same thread are meaningful
+inline uint64_t read_cycle_counter() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    return __rdtsc();
+#else
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count());
+#endif
+}
+
+struct NoInstrumentation
+{
+    constexpr static bool enabled = false;
+};
+
+struct CountingInstrumentation
+{
+    constexpr static bool enabled = true;
+
+    struct Token
+    {
+    };
+
+    static Token enter(InstrumentedType&, Operation) noexcept { return {}; }
+
+    static void exit(InstrumentedType& type, Operation operation, const Token&, size_t bytes, bool success) noexcept
+    {
+        OperationStatistics& statistics = type[operation];
+        detail::add(statistics.calls, 1);
+        detail::add(statistics.failures, success ? 0 : 1);
+        detail::add(statistics.bytes, bytes);
+    }
+};
+
+struct CycleInstrumentation
+{
+    constexpr static bool enabled = true;
+
+    struct Token
+    {
+        uint64_t start;
+        uint64_t nested_cycles; // Of the calling type before this call
+    };
+
+    static Token enter(InstrumentedType&, Operation) noexcept
+    {
+        const Token token{read_cycle_counter(), detail::nested_cycles};
+        detail::nested_cycles = 0;
+        return token;
+    }
+
+    // Returns the cycles spent in the call, including nested types
+    static uint64_t exit(InstrumentedType& type, Operation operation, const Token& token, size_t bytes, bool success,
+                         uint64_t scale = 1) noexcept
+    {
+        const uint64_t cycles = read_cycle_counter() - token.start;
+        const uint64_t nested = detail::nested_cycles;
+        detail::nested_cycles = token.nested_cycles + cycles;
+
+        OperationStatistics& statistics = type[operation];
+        detail::add(statistics.calls, scale);
+        detail::add(statistics.failures, success ? 0 : scale);
+        detail::add(statistics.bytes, bytes * scale);
+        detail::add(statistics.cycles, cycles * scale);
+        detail::add(statistics.self_cycles, (cycles > nested ? cycles - nested : 0) * scale);
+        return cycles;
+    }
+};
+
+// Whether a call is recorded is decided once for each outermost call, so that the calls nested within it are recorded
+// along with it, and every type is sampled at the same rate
+template <uint64_t Period = 1024>
+struct SamplingInstrumentation
+{
+    static_assert(Period > 0, "Sampling period must be positive");
+
+    constexpr static bool enabled = true;
+
+    struct Token
+    {
+        bool                        sampled;
+        CycleInstrumentation::Token cycles;
+    };
+
+    static Token enter(InstrumentedType& type, Operation operation) noexcept
+    {
+        if (detail::sampling_depth++ == 0)
+        {
+            detail::sampling_active = ++detail::sampling_calls % Period == 0;
+        }
+        if (!detail::sampling_active)
+        {
+            return Token{false, {}};
+        }
+        return Token{true, CycleInstrumentation::enter(type, operation)};
+    }
+
+    static void exit(InstrumentedType& type, Operation operation, const Token& token, size_t bytes,
+                     bool success) noexcept
+    {
+        const size_t depth = --detail::sampling_depth;
+        if (!token.sampled)
+        {
+            return;
+        }
+        const uint64_t cycles = CycleInstrumentation::exit(type, operation, token.cycles, bytes, success, Period);
+
+        const TraceCallback callback = detail::trace_callback.load(std::memory_order_acquire);
+        if (callback)
+        {
+            const TraceEvent event{type.name.load(std::memory_order_relaxed), operation, success, depth, bytes,
+                                   cycles};
+            callback(event, detail::trace_context.load(std::memory_order_relaxed));
+        }
+    }
+};
+
+} // namespace fast_ber
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "fast_ber/util/Instrumentation.hpp"
+
+// Calls made by generated types to the policy chosen by FAST_BER_INSTRUMENTATION, see Instrumentation.hpp. Kept apart
+// from the policies so that a custom policy can be declared between including the two
+
+#ifndef FAST_BER_INSTRUMENTATION
+#define FAST_BER_INSTRUMENTATION ::fast_ber::NoInstrumentation
+#endif
+
+namespace fast_ber
+{
+
+// Decode input into type with function, a call to the uninstrumented decode. Bytes are the length of the input packet
+template <typename Policy = FAST_BER_INSTRUMENTATION, typename T, typename Input, typename Function>
+auto instrument_decode([[maybe_unused]] const T& type, [[maybe_unused]] const char* name,
+                       [[maybe_unused]] const Input& input, Function&& function) noexcept
+{
+    if constexpr (!Policy::enabled)
+    {
+        return function();
+    }
+    else
+    {
+        InstrumentedType&            statistics = instrumented_type<T>(name);
+        const typename Policy::Token token      = Policy::enter(statistics, Operation::decode);
+        const auto                   result     = function();
+        Policy::exit(statistics, Operation::decode, token, input.is_valid() ? input.ber_length() : 0,
+                     result.success);
+        return result;
+    }
+}
+
+// Encode type with function, a call to the uninstrumented encode. Bytes are the length of the encoding
+template <typename Policy = FAST_BER_INSTRUMENTATION, typename T, typename Function>
+auto instrument_encode([[maybe_unused]] const T& type, [[maybe_unused]] const char* name, Function&& function) noexcept
+{
+    if constexpr (!Policy::enabled)
+    {
+        return function();
+    }
+    else
+    {
+        InstrumentedType&            statistics = instrumented_type<T>(name);
+        const typename Policy::Token token      = Policy::enter(statistics, Operation::encode);
+        const auto                   result     = function();
+        Policy::exit(statistics, Operation::encode, token, result.success ? result.length : 0, result.success);
+        return result;
+    }
+}
+
+} // namespace fast_ber
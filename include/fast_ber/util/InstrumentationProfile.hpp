@@ -0,0 +1,86 @@
+#pragma once
+
+#include "fast_ber/util/Instrumentation.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+namespace fast_ber
+{
+
+// Statistics of one type in a flat profile. Share is the fraction of the cycles of all types spent in the type itself,
+// excluding the types nested within it
+struct ProfileEntry
+{
+    std::string_view type;
+    uint64_t         calls       = 0;
+    uint64_t         failures    = 0;
+    uint64_t         bytes       = 0;
+    uint64_t         cycles      = 0;
+    uint64_t         self_cycles = 0;
+    double           share       = 0.0;
+};
+
+// Types which have been called, in decreasing order of self cycles, or of calls when cycles are not recorded
+inline std::vector<ProfileEntry> flat_profile(Operation operation = Operation::decode)
+{
+    std::vector<ProfileEntry> profile;
+    uint64_t                  total_cycles = 0;
+    for (const InstrumentedType* type = instrumented_types(); type != nullptr;
+         type                         = type->next.load(std::memory_order_relaxed))
+    {
+        const OperationStatistics& statistics = (*type)[operation];
+
+        ProfileEntry entry;
+        entry.type        = type->name.load(std::memory_order_relaxed);
+        entry.calls       = statistics.calls.load(std::memory_order_relaxed);
+        entry.failures    = statistics.failures.load(std::memory_order_relaxed);
+        entry.bytes       = statistics.bytes.load(std::memory_order_relaxed);
+        entry.cycles      = statistics.cycles.load(std::memory_order_relaxed);
+        entry.self_cycles = statistics.self_cycles.load(std::memory_order_relaxed);
+        if (entry.calls > 0)
+        {
+            total_cycles += entry.self_cycles;
+            profile.push_back(entry);
+        }
+    }
+
+    for (ProfileEntry& entry : profile)
+    {
+        entry.share = total_cycles > 0 ? static_cast<double>(entry.self_cycles) / static_cast<double>(total_cycles) : 0;
+    }
+    std::sort(profile.begin(), profile.end(), [](const ProfileEntry& a, const ProfileEntry& b) {
+        if (a.self_cycles != b.self_cycles)
+        {
+            return a.self_cycles > b.self_cycles;
+        }
+        return a.calls != b.calls ? a.calls > b.calls : a.type < b.type;
+    });
+    return profile;
+}
+
+// Writes the flat profile as a table, one line for each type
+inline void write_flat_profile(std::ostream& output, Operation operation = Operation::decode)
+{
+    const std::vector<ProfileEntry> profile = flat_profile(operation);
+
+    output << std::right << std::setw(8) << "% self" << std::setw(8) << "cumul" << std::setw(16) << "self cycles"
+           << std::setw(16) << "cycles" << std::setw(12) << "calls" << std::setw(10) << "failures" << std::setw(14)
+           << "bytes"
+           << "  " << to_string(operation) << " of type\n";
+
+    double cumulative = 0.0;
+    for (const ProfileEntry& entry : profile)
+    {
+        cumulative += entry.share;
+        output << std::fixed << std::setprecision(2) << std::setw(8) << entry.share * 100 << std::setw(8)
+               << cumulative * 100 << std::setw(16) << entry.self_cycles << std::setw(16) << entry.cycles
+               << std::setw(12) << entry.calls << std::setw(10) << entry.failures << std::setw(14) << entry.bytes
+               << "  " << entry.type << "\n";
+    }
+}
+
+} // namespace fast_ber
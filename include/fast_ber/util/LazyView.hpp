@@ -0,0 +1,283 @@
+#pragma once
+
+#include "fast_ber/ber_types/Boolean.hpp"
+#include "fast_ber/ber_types/Choice.hpp"
+#include "fast_ber/ber_types/Identifier.hpp"
+#include "fast_ber/ber_types/Integer.hpp"
+#include "fast_ber/ber_types/SequenceOf.hpp"
+#include "fast_ber/ber_types/StringImpl.hpp"
+#include "fast_ber/util/BerView.hpp"
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+namespace fast_ber
+{
+
+template <typename T>
+class SequenceOfView;
+
+// Type returned when reading a member through a generated View. Types without a lazy form are decoded in full when
+// the member is read
+template <typename T, typename = void>
+struct ViewTypeImpl
+{
+    using type = T;
+};
+
+template <typename T>
+struct ViewTypeImpl<T, std::void_t<typename T::View>>
+{
+    using type = typename T::View;
+};
+
+template <UniversalTag tag, typename Identifier, StorageMode storage>
+struct ViewTypeImpl<StringImpl<tag, Identifier, storage>>
+{
+    using type = std::string_view;
+};
+
+template <typename Identifier, StorageMode storage>
+struct ViewTypeImpl<Integer<Identifier, storage>>
+{
+    using type = int64_t;
+};
+
+template <typename Identifier, StorageMode storage>
+struct ViewTypeImpl<Boolean<Identifier, storage>>
+{
+    using type = bool;
+};
+
+template <typename T, typename Identifier, StorageMode storage, size_t inline_capacity>
+struct ViewTypeImpl<SequenceOf<T, Identifier, storage, inline_capacity>>
+{
+    using type = SequenceOfView<T>;
+};
+
+template <typename T>
+using ViewType = typename ViewTypeImpl<T>::type;
+
+template <typename T, typename = void>
+struct HasView : std::false_type
+{
+};
+
+template <typename T>
+struct HasView<T, std::void_t<typename T::View>> : std::true_type
+{
+};
+
+template <typename T>
+struct IsSequenceOfView : std::false_type
+{
+};
+
+template <typename T>
+struct IsSequenceOfView<SequenceOfView<T>> : std::true_type
+{
+};
+
+// Packet holding the content of a type with the given identifier, removing the outer tag of explicitly tagged types
+template <typename Identifier>
+BerView inner_packet(BerView input) noexcept
+{
+    if constexpr (!IsChoiceId<Identifier>::value)
+    {
+        if (Identifier::depth() == 2 && input.is_valid())
+        {
+            return *input.begin();
+        }
+    }
+    return input;
+}
+
+// Create the view of a value of type T, encoded with the given identifier. Views do not validate the encoding,
+// missing or malformed values are read as empty, zero or false. Decode the full type to validate a packet.
+template <typename T, typename Identifier>
+ViewType<T> make_view(BerView input) noexcept
+{
+    if constexpr (std::is_same<ViewType<T>, std::string_view>::value)
+    {
+        const BerView packet = inner_packet<Identifier>(input);
+        if (!packet.is_valid())
+        {
+            return {};
+        }
+        return std::string_view(reinterpret_cast<const char*>(packet.content_data()), packet.content_length());
+    }
+    else if constexpr (std::is_same<ViewType<T>, int64_t>::value)
+    {
+        int64_t value = 0;
+        if (!decode_integer(inner_packet<Identifier>(input).content(), value))
+        {
+            return 0;
+        }
+        return value;
+    }
+    else if constexpr (std::is_same<ViewType<T>, bool>::value)
+    {
+        const BerView packet = inner_packet<Identifier>(input);
+        return packet.content_length() == 1 && packet.content_data()[0] != 0x00;
+    }
+    else if constexpr (IsSequenceOfView<ViewType<T>>::value)
+    {
+        return ViewType<T>(inner_packet<Identifier>(input));
+    }
+    else if constexpr (HasView<T>::value)
+    {
+        if constexpr (IsChoiceId<typename T::AsnId>::value)
+        {
+            // Views of choices hold the packet of the selected alternative
+            if (IsChoiceId<Identifier>::value || !input.is_valid())
+            {
+                return ViewType<T>(input);
+            }
+            const BerView packet = inner_packet<Identifier>(input);
+            return packet.is_valid() ? ViewType<T>(*packet.begin()) : ViewType<T>();
+        }
+        else
+        {
+            return ViewType<T>(inner_packet<Identifier>(input));
+        }
+    }
+    else
+    {
+        T value{};
+        value.decode(input);
+        return value;
+    }
+}
+
+// Lazy range over the elements of an encoded SEQUENCE OF, elements are located and viewed as they are iterated
+template <typename T>
+class SequenceOfView
+{
+  public:
+    class Iterator
+    {
+      public:
+        Iterator() noexcept = default;
+        explicit Iterator(BerViewIterator iterator) noexcept : m_iterator(iterator) {}
+
+        ViewType<T> operator*() const noexcept { return make_view<T, Identifier<T>>(*m_iterator); }
+        Iterator&   operator++() noexcept
+        {
+            ++m_iterator;
+            return *this;
+        }
+
+        friend bool operator==(const Iterator& lhs, const Iterator& rhs) noexcept
+        {
+            return lhs.m_iterator == rhs.m_iterator;
+        }
+        friend bool operator!=(const Iterator& lhs, const Iterator& rhs) noexcept { return !(lhs == rhs); }
+
+      private:
+        BerViewIterator m_iterator = BerViewIterator(End::end);
+    };
+
+    SequenceOfView() noexcept = default;
+    explicit SequenceOfView(BerView input) noexcept : m_packet(input) {}
+
+    Iterator begin() const noexcept { return Iterator(m_packet.begin()); }
+    Iterator end() const noexcept { return Iterator(m_packet.end()); }
+    bool     empty() const noexcept { return begin() == end(); }
+    size_t   size() const noexcept
+    {
+        size_t count = 0;
+        for (auto iterator = m_packet.begin(); iterator != m_packet.end(); ++iterator)
+        {
+            count++;
+        }
+        return count;
+    }
+
+    const BerView& packet() const noexcept { return m_packet; }
+
+  private:
+    BerView m_packet;
+};
+
+// Locates the members of an encoded SEQUENCE or SET on demand, for use by generated Views. Children are scanned at
+// most once, in order, and the offset of each member passed over is cached. Members are found from const accessors, so
+// the cache is mutable and a view must not be shared between threads.
+// Ordered (SEQUENCE) members are matched in definition order, as the generated decoder would. Unordered (SET)
+// members are matched in any order.
+template <size_t member_count, bool ordered>
+class LazyMembers
+{
+  public:
+    using Matcher = bool (*)(size_t member, Class class_, Tag tag) noexcept;
+
+    LazyMembers() noexcept { m_offsets.fill(not_found); }
+    explicit LazyMembers(BerView input) noexcept : m_packet(input) { m_offsets.fill(not_found); }
+
+    // Packet of the member at the given index, an invalid view is returned if the member is not present
+    BerView find(size_t member, Matcher matches) const noexcept
+    {
+        while (m_offsets[member] == not_found && !m_complete && !(ordered && member < m_next_member))
+        {
+            scan_next(matches);
+        }
+        if (m_offsets[member] == not_found)
+        {
+            return BerView();
+        }
+        return BerView(m_packet.content().subspan(m_offsets[member]));
+    }
+
+    const BerView& packet() const noexcept { return m_packet; }
+
+  private:
+    constexpr static uint32_t not_found = std::numeric_limits<uint32_t>::max();
+
+    void scan_next(Matcher matches) const noexcept
+    {
+        const std::span<const uint8_t> content = m_packet.content();
+        if (m_next_offset >= content.size())
+        {
+            m_complete = true;
+            return;
+        }
+
+        const BerView child(content.subspan(m_next_offset));
+        if (!child.is_valid())
+        {
+            m_complete = true;
+            return;
+        }
+
+        bool matched = false;
+        for (size_t i = ordered ? m_next_member : 0; i < member_count; i++)
+        {
+            if ((ordered || m_offsets[i] == not_found) && matches(i, child.class_(), child.tag()))
+            {
+                m_offsets[i]  = static_cast<uint32_t>(m_next_offset);
+                m_next_member = i + 1;
+                matched       = true;
+                break;
+            }
+        }
+
+        // An unexpected child ends a SEQUENCE, any following children are extensions. Unknown members of a SET
+        // are skipped
+        if (ordered && (!matched || m_next_member == member_count))
+        {
+            m_complete = true;
+        }
+        m_next_offset += child.ber_length();
+    }
+
+    BerView                                   m_packet;
+    mutable std::array<uint32_t, member_count> m_offsets;
+    mutable size_t                             m_next_offset = 0;
+    mutable size_t                             m_next_member = 0;
+    mutable bool                               m_complete    = false;
+};
+
+} // namespace fast_ber
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cstdint>
+
+#ifdef _WIN32
+#include <fstream>
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace fast_ber
+{
+
+// Read only view of the contents of a file, for decoding large files of records without copying them. The file is
+// memory mapped where supported, otherwise it is read into memory.
+class MappedFile
+{
+  public:
+    MappedFile() noexcept = default;
+    explicit MappedFile(const std::string& path) { open(path); }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&& rhs) noexcept { *this = std::move(rhs); }
+    ~MappedFile() noexcept { close(); }
+
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile& operator=(MappedFile&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            close();
+            m_data    = std::exchange(rhs.m_data, nullptr);
+            m_size    = std::exchange(rhs.m_size, 0);
+            m_mapped  = std::exchange(rhs.m_mapped, false);
+            m_is_open = std::exchange(rhs.m_is_open, false);
+            m_buffer  = std::move(rhs.m_buffer);
+        }
+        return *this;
+    }
+
+    // Return false if the file could not be read
+    bool open(const std::string& path);
+    void close() noexcept;
+
+    bool                     is_open() const noexcept { return m_is_open; }
+    std::span<const uint8_t> data() const noexcept { return std::span<const uint8_t>(m_data, m_size); }
+    size_t                   size() const noexcept { return m_size; }
+
+  private:
+    const uint8_t*       m_data    = nullptr;
+    size_t               m_size    = 0;
+    bool                 m_mapped  = false;
+    bool                 m_is_open = false;
+    std::vector<uint8_t> m_buffer;
+};
+
+#ifdef _WIN32
+
+inline bool MappedFile::open(const std::string& path)
+{
+    close();
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        return false;
+    }
+    m_buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    m_data    = m_buffer.data();
+    m_size    = m_buffer.size();
+    m_is_open = true;
+    return true;
+}
+
+inline void MappedFile::close() noexcept
+{
+    m_buffer.clear();
+    m_data    = nullptr;
+    m_size    = 0;
+    m_is_open = false;
+}
+
+#else
+
+inline bool MappedFile::open(const std::string& path)
+{
+    close();
+    const int descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor < 0)
+    {
+        return false;
+    }
+
+    struct stat status = {};
+    if (::fstat(descriptor, &status) != 0)
+    {
+        ::close(descriptor);
+        return false;
+    }
+
+    // Empty files cannot be mapped
+    if (status.st_size > 0)
+    {
+        const size_t size    = static_cast<size_t>(status.st_size);
+        void* const  mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (mapping == MAP_FAILED)
+        {
+            ::close(descriptor);
+            return false;
+        }
+        // Records are decoded in order
+        ::madvise(mapping, size, MADV_SEQUENTIAL);
+        m_data   = static_cast<const uint8_t*>(mapping);
+        m_size   = size;
+        m_mapped = true;
+    }
+    ::close(descriptor);
+    m_is_open = true;
+    return true;
+}
+
+inline void MappedFile::close() noexcept
+{
+    if (m_mapped)
+    {
+        ::munmap(const_cast<uint8_t*>(m_data), m_size);
+    }
+    m_data    = nullptr;
+    m_size    = 0;
+    m_mapped  = false;
+    m_is_open = false;
+}
+
+#endif
+
+} // namespace fast_ber
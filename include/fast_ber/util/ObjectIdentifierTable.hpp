@@ -0,0 +1,119 @@
+#pragma once
+
+#include "fast_ber/ber_types/ObjectIdentifier.hpp"
+
+#include <functional>
+#include <initializer_list>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <cstdint>
+
+namespace fast_ber
+{
+
+// Small integer standing for an interned object identifier. Handles are given out from 1 in the order identifiers are
+// interned, so a fixed set of known identifiers can be matched with a switch
+using ObjectIdentifierHandle = uint32_t;
+
+constexpr ObjectIdentifierHandle unknown_object_identifier = 0;
+
+namespace detail
+{
+
+struct ObjectIdentifierHash
+{
+    using is_transparent = void;
+
+    size_t operator()(std::string_view content) const noexcept { return std::hash<std::string_view>{}(content); }
+};
+
+inline std::string_view as_string_view(std::span<const uint8_t> content) noexcept
+{
+    return std::string_view(reinterpret_cast<const char*>(content.data()), content.size());
+}
+
+} // namespace detail
+
+// Maps the encoded contents of object identifiers to handles. Finding a decoded identifier is a single hash lookup
+// which does not allocate. Interning is not synchronized, tables should be filled before being shared between threads
+class ObjectIdentifierTable
+{
+  public:
+    ObjectIdentifierTable() = default;
+    ObjectIdentifierTable(std::initializer_list<ObjectIdentifier<>> oids);
+
+    // Returns the existing handle if the identifier is already interned
+    ObjectIdentifierHandle intern(std::span<const uint8_t> content);
+    template <typename Identifier>
+    ObjectIdentifierHandle intern(const ObjectIdentifier<Identifier>& oid)
+    {
+        return intern(oid.content());
+    }
+
+    // Returns unknown_object_identifier if the identifier is not interned
+    ObjectIdentifierHandle find(std::span<const uint8_t> content) const noexcept;
+    template <typename Identifier>
+    ObjectIdentifierHandle find(const ObjectIdentifier<Identifier>& oid) const noexcept
+    {
+        return find(oid.content());
+    }
+
+    // Encoded contents of an interned identifier, empty if the handle is unknown
+    std::span<const uint8_t> content(ObjectIdentifierHandle handle) const noexcept;
+    size_t                   size() const noexcept { return m_contents.size(); }
+
+  private:
+    std::unordered_map<std::string, ObjectIdentifierHandle, detail::ObjectIdentifierHash, std::equal_to<>> m_handles;
+    std::vector<std::string>                                                                            m_contents;
+};
+
+// Table shared by a whole process, for applications which intern their known identifiers once at startup
+inline ObjectIdentifierTable& global_object_identifier_table() noexcept
+{
+    static ObjectIdentifierTable table;
+    return table;
+}
+
+inline ObjectIdentifierTable::ObjectIdentifierTable(std::initializer_list<ObjectIdentifier<>> oids)
+{
+    for (const ObjectIdentifier<>& oid : oids)
+    {
+        intern(oid);
+    }
+}
+
+inline ObjectIdentifierHandle ObjectIdentifierTable::intern(std::span<const uint8_t> content)
+{
+    const ObjectIdentifierHandle existing = find(content);
+    if (existing != unknown_object_identifier)
+    {
+        return existing;
+    }
+
+    const ObjectIdentifierHandle handle = static_cast<ObjectIdentifierHandle>(m_contents.size() + 1);
+    m_contents.emplace_back(detail::as_string_view(content));
+    m_handles.emplace(m_contents.back(), handle);
+    return handle;
+}
+
+inline ObjectIdentifierHandle ObjectIdentifierTable::find(std::span<const uint8_t> content) const noexcept
+{
+    const auto iter = m_handles.find(detail::as_string_view(content));
+    return iter == m_handles.end() ? unknown_object_identifier : iter->second;
+}
+
+inline std::span<const uint8_t> ObjectIdentifierTable::content(ObjectIdentifierHandle handle) const noexcept
+{
+    if (handle == unknown_object_identifier || handle > m_contents.size())
+    {
+        return {};
+    }
+    const std::string& content = m_contents[handle - 1];
+    return std::span(reinterpret_cast<const uint8_t*>(content.data()), content.size());
+}
+
+} // namespace fast_ber
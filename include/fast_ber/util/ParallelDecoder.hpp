@@ -0,0 +1,272 @@
+#pragma once
+
+#include "fast_ber/util/BatchDecoder.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+#include <cstdint>
+
+namespace fast_ber
+{
+
+enum class DeliveryOrder
+{
+    in_order,  // Records are passed to the function in input order, from the calling thread
+    any_order, // Records are passed to the function as soon as they are decoded, concurrently from the worker threads
+};
+
+struct ParallelDecodeOptions
+{
+    size_t        threads       = 0;   // Number of worker threads, 0 for one per hardware thread
+    size_t        chunk_records = 256; // Number of records claimed by a worker at a time
+    DeliveryOrder order         = DeliveryOrder::in_order;
+};
+
+namespace detail
+{
+
+struct RecordLocation
+{
+    size_t offset;
+    size_t length;
+};
+
+// Sort errors by offset, merging consecutive ranges in the same way as BatchDecoder
+inline void merge_errors(std::vector<BatchDecodeError>& errors)
+{
+    std::sort(errors.begin(), errors.end(),
+              [](const BatchDecodeError& lhs, const BatchDecodeError& rhs) { return lhs.offset < rhs.offset; });
+
+    size_t merged = 0;
+    for (const BatchDecodeError& error : errors)
+    {
+        if (merged > 0 && errors[merged - 1].offset + errors[merged - 1].length == error.offset)
+        {
+            errors[merged - 1].length += error.length;
+        }
+        else
+        {
+            errors[merged++] = error;
+        }
+    }
+    errors.resize(merged);
+}
+
+} // namespace detail
+
+// Decode each record of type T in the input using a pool of worker threads, calling
+// function(const T& record, size_t offset) for each. The result is the same as that of decode_batch.
+// Record boundaries are first located by hopping over the headers of the top level packets. Records are then decoded in
+// chunks, each worker claiming the next undecoded chunk as it becomes free. Each worker reuses its own decoded values.
+// With DeliveryOrder::in_order the function is called from the calling thread in input order, the workers decode at
+// most two chunks each ahead of delivery. With DeliveryOrder::any_order the function must be safe to call concurrently.
+// An exception thrown by the function stops decoding and is rethrown once all workers have finished.
+template <typename T, typename Function>
+BatchDecodeResult decode_parallel(std::span<const uint8_t> input, Function&& function,
+                                  const ParallelDecodeOptions& options = {})
+{
+    BatchDecoder<T>                     splitter(input);
+    std::vector<detail::RecordLocation> locations;
+    BerView                             packet;
+    while (splitter.next_packet(packet))
+    {
+        locations.push_back(detail::RecordLocation{splitter.record_offset(), packet.ber_length()});
+    }
+
+    const size_t chunk_records = std::max<size_t>(options.chunk_records, 1);
+    const size_t chunks        = (locations.size() + chunk_records - 1) / chunk_records;
+    const size_t hardware      = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    const size_t threads       = std::min(options.threads == 0 ? hardware : options.threads, chunks);
+
+    auto chunk_locations = [&](size_t chunk) {
+        const size_t first = chunk * chunk_records;
+        return std::span<const detail::RecordLocation>(locations).subspan(
+            first, std::min(chunk_records, locations.size() - first));
+    };
+
+    struct Worker
+    {
+        std::vector<BatchDecodeError> errors;
+        size_t                        records = 0;
+    };
+    std::vector<Worker> workers(threads);
+
+    auto decode_record = [&input](const detail::RecordLocation& location, T& output, Worker& worker) {
+        if (output.decode(BerView(input.subspan(location.offset, location.length))).success)
+        {
+            worker.records++;
+            return true;
+        }
+        worker.errors.push_back(BatchDecodeError{location.offset, location.length});
+        return false;
+    };
+
+    std::atomic<size_t>     next_chunk = 0;
+    std::mutex              mutex;
+    std::condition_variable condition;
+    bool                    stop      = false; // Guarded by mutex
+    size_t                  delivered = 0;     // Guarded by mutex, chunks passed to function in order
+    std::exception_ptr      exception;         // Guarded by mutex
+
+    auto fail = [&](std::exception_ptr error) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!exception)
+            {
+                exception = error;
+            }
+            stop = true;
+        }
+        condition.notify_all();
+    };
+
+    struct Slot
+    {
+        std::vector<T>       values;
+        std::vector<uint8_t> decoded;
+        bool                 ready = false; // Guarded by mutex
+    };
+    const size_t      window = options.order == DeliveryOrder::in_order ? 2 * threads : 0;
+    std::vector<Slot> slots(window);
+
+    auto decode_unordered = [&](Worker& worker) {
+        T record;
+        for (size_t chunk = next_chunk++; chunk < chunks; chunk = next_chunk++)
+        {
+            for (const detail::RecordLocation& location : chunk_locations(chunk))
+            {
+                if (decode_record(location, record, worker))
+                {
+                    function(static_cast<const T&>(record), location.offset);
+                }
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (stop)
+            {
+                return;
+            }
+        }
+    };
+
+    auto decode_ordered = [&](Worker& worker) {
+        for (size_t chunk = next_chunk++; chunk < chunks; chunk = next_chunk++)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                condition.wait(lock, [&] { return stop || chunk < delivered + window; });
+                if (stop)
+                {
+                    return;
+                }
+            }
+
+            Slot&      slot    = slots[chunk % window];
+            const auto located = chunk_locations(chunk);
+            if (slot.values.size() < located.size())
+            {
+                slot.values.resize(located.size());
+            }
+            slot.decoded.resize(located.size());
+            for (size_t i = 0; i < located.size(); i++)
+            {
+                slot.decoded[i] = decode_record(located[i], slot.values[i], worker);
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                slot.ready = true;
+            }
+            condition.notify_all();
+        }
+    };
+
+    auto deliver = [&] {
+        for (size_t chunk = 0; chunk < chunks; chunk++)
+        {
+            Slot& slot = slots[chunk % window];
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                condition.wait(lock, [&] { return stop || slot.ready; });
+                if (stop)
+                {
+                    return;
+                }
+            }
+
+            const auto located = chunk_locations(chunk);
+            for (size_t i = 0; i < located.size(); i++)
+            {
+                if (slot.decoded[i])
+                {
+                    function(static_cast<const T&>(slot.values[i]), located[i].offset);
+                }
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                slot.ready = false;
+                delivered++;
+            }
+            condition.notify_all();
+        }
+    };
+
+    {
+        std::vector<std::jthread> pool;
+        try
+        {
+            pool.reserve(threads);
+            for (Worker& worker : workers)
+            {
+                pool.emplace_back([&, &worker = worker] {
+                    try
+                    {
+                        if (options.order == DeliveryOrder::in_order)
+                        {
+                            decode_ordered(worker);
+                        }
+                        else
+                        {
+                            decode_unordered(worker);
+                        }
+                    }
+                    catch (...)
+                    {
+                        fail(std::current_exception());
+                    }
+                });
+            }
+            if (options.order == DeliveryOrder::in_order)
+            {
+                deliver();
+            }
+        }
+        catch (...)
+        {
+            fail(std::current_exception());
+        }
+    }
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+
+    BatchDecodeResult result{0, splitter.errors()};
+    for (const Worker& worker : workers)
+    {
+        result.records += worker.records;
+        result.errors.insert(result.errors.end(), worker.errors.begin(), worker.errors.end());
+    }
+    detail::merge_errors(result.errors);
+    return result;
+}
+
+} // namespace fast_ber
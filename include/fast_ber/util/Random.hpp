@@ -0,0 +1,305 @@
+#pragma once
+
+// Random values of the fast_ber types, for generating test data and benchmark corpora. The compiler option
+// --generate-random adds generate_random functions for the generated types, which build on these
+
+#include "fast_ber/ber_types/All.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <functional>
+#include <limits>
+#include <map>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <cstdint>
+
+namespace fast_ber
+{
+
+// Distribution of the lengths of strings and of SEQUENCE OF and SET OF. Geometric lengths start at min and are
+// truncated to max, so that most values are short with an occasional long one
+struct LengthDistribution
+{
+    enum class Shape
+    {
+        uniform,
+        geometric
+    };
+
+    size_t min   = 0;
+    size_t max   = 0;
+    Shape  shape = Shape::uniform;
+    double mean  = 0.0; // Mean length of a geometric distribution
+};
+
+// Controls the values produced by generate_random. Presence of OPTIONAL members can be set per member, keyed as
+// "Type.member", and the weights of CHOICE alternatives per choice, keyed as "Type" with a weight for each
+// alternative in order. Nested types are named as in the generated code, such as "Record.Nested.member"
+struct RandomProfile
+{
+    double             optional_probability = 0.5;
+    LengthDistribution sequence_of_length   = {0, 4};
+    LengthDistribution string_length        = {0, 16};
+    int64_t            min_integer          = std::numeric_limits<int32_t>::min();
+    int64_t            max_integer          = std::numeric_limits<int32_t>::max();
+
+    std::map<std::string, double, std::less<>>              optional_probabilities;
+    std::map<std::string, std::vector<double>, std::less<>> choice_weights;
+
+    // Beyond this nesting of constructed types optional members are absent, SEQUENCE OF are empty and choices take the
+    // alternative with the shortest values, as found by the compiler, so that values of recursive types are finite
+    size_t max_depth = 32;
+};
+
+namespace detail
+{
+
+inline size_t& random_nesting() noexcept
+{
+    thread_local size_t nesting = 0;
+    return nesting;
+}
+
+} // namespace detail
+
+// Counts the nesting of constructed types being generated on this thread
+class RandomNesting
+{
+  public:
+    RandomNesting() noexcept { ++detail::random_nesting(); }
+    RandomNesting(const RandomNesting&) = delete;
+    RandomNesting& operator=(const RandomNesting&) = delete;
+    ~RandomNesting() noexcept { --detail::random_nesting(); }
+
+    static bool exceeded(const RandomProfile& profile) noexcept { return detail::random_nesting() > profile.max_depth; }
+};
+
+template <typename Rng>
+size_t random_length(Rng& rng, const LengthDistribution& distribution)
+{
+    if (distribution.max <= distribution.min)
+    {
+        return distribution.min;
+    }
+    if (distribution.shape == LengthDistribution::Shape::geometric)
+    {
+        const double extra = std::max(distribution.mean - static_cast<double>(distribution.min), 0.0);
+        std::geometric_distribution<size_t> geometric(1.0 / (1.0 + extra));
+        return distribution.min + std::min(geometric(rng), distribution.max - distribution.min);
+    }
+    return std::uniform_int_distribution<size_t>(distribution.min, distribution.max)(rng);
+}
+
+// Whether an OPTIONAL member should be present
+template <typename Rng>
+bool random_presence(Rng& rng, const RandomProfile& profile, std::string_view member)
+{
+    if (RandomNesting::exceeded(profile))
+    {
+        return false;
+    }
+
+    double probability = profile.optional_probability;
+    if (!profile.optional_probabilities.empty())
+    {
+        const auto found = profile.optional_probabilities.find(member);
+        if (found != profile.optional_probabilities.end())
+        {
+            probability = found->second;
+        }
+    }
+    return std::bernoulli_distribution(std::clamp(probability, 0.0, 1.0))(rng);
+}
+
+// Index of the alternative a CHOICE should hold. Alternatives are equally likely unless weighted by the profile,
+// alternatives without a weight are never chosen. Beyond the maximum depth the terminating alternative is taken
+template <typename Rng>
+size_t random_alternative(Rng& rng, const RandomProfile& profile, std::string_view choice, size_t alternatives,
+                          size_t terminating)
+{
+    if (RandomNesting::exceeded(profile))
+    {
+        return terminating;
+    }
+
+    const auto found = profile.choice_weights.find(choice);
+    if (found != profile.choice_weights.end())
+    {
+        const std::vector<double>& weights = found->second;
+        const size_t               count   = std::min(weights.size(), alternatives);
+
+        double total = 0.0;
+        for (size_t i = 0; i < count; i++)
+        {
+            total += std::max(weights[i], 0.0);
+        }
+        if (total > 0.0)
+        {
+            double point  = std::uniform_real_distribution<double>(0.0, total)(rng);
+            size_t chosen = 0;
+            for (size_t i = 0; i < count; i++)
+            {
+                if (weights[i] > 0.0)
+                {
+                    chosen = i;
+                    point -= weights[i];
+                    if (point < 0.0)
+                    {
+                        break;
+                    }
+                }
+            }
+            return chosen;
+        }
+    }
+    return std::uniform_int_distribution<size_t>(0, alternatives - 1)(rng);
+}
+
+template <typename Identifier, StorageMode storage, typename Rng>
+void generate_random(Integer<Identifier, storage>& object, Rng& rng, const RandomProfile& profile)
+{
+    object.assign(std::uniform_int_distribution<int64_t>(profile.min_integer, profile.max_integer)(rng));
+}
+
+template <typename Identifier, StorageMode storage, typename Rng>
+void generate_random(Boolean<Identifier, storage>& object, Rng& rng, const RandomProfile&)
+{
+    object.assign(std::bernoulli_distribution(0.5)(rng));
+}
+
+template <typename Identifier, StorageMode storage, typename Rng>
+void generate_random(Real<Identifier, storage>& object, Rng& rng, const RandomProfile&)
+{
+    object.assign(std::uniform_real_distribution<double>(-1e6, 1e6)(rng));
+}
+
+template <typename Identifier, typename Rng>
+void generate_random(Null<Identifier>&, Rng&, const RandomProfile&)
+{
+}
+
+// Character strings hold characters valid for their type, each encoded in as many octets as the type uses. Borrowed
+// strings cannot hold generated content, as they reference a decoded buffer
+template <UniversalTag tag, typename Identifier, StorageMode storage, typename Rng>
+void generate_random(StringImpl<tag, Identifier, storage>& object, Rng& rng, const RandomProfile& profile)
+{
+    static_assert(storage != StorageMode::borrowed, "Random values cannot be generated for borrowed strings");
+
+    constexpr std::string_view printable =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789 '()+,-./:=?";
+    constexpr std::string_view graphic =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789 !\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~";
+    constexpr std::string_view characters = (tag == UniversalTag::numeric_string)     ? "0123456789 "
+                                            : (tag == UniversalTag::printable_string) ? printable
+                                                                                      : graphic;
+
+    const size_t length = random_length(rng, profile.string_length);
+    std::string  content;
+
+    if constexpr (tag == UniversalTag::octet_string || tag == UniversalTag::character_string)
+    {
+        std::uniform_int_distribution<int> octet(0, 255);
+        content.resize(length);
+        std::generate(content.begin(), content.end(), [&] { return static_cast<char>(octet(rng)); });
+    }
+    else if constexpr (tag == UniversalTag::bit_string)
+    {
+        // Whole octets of bits, following the octet counting the unused bits of the last one
+        std::uniform_int_distribution<int> octet(0, 255);
+        content.resize(length + 1);
+        std::generate(content.begin() + 1, content.end(), [&] { return static_cast<char>(octet(rng)); });
+    }
+    else
+    {
+        constexpr size_t character_width = (tag == UniversalTag::bmp_string)         ? 2
+                                           : (tag == UniversalTag::universal_string) ? 4
+                                                                                     : 1;
+
+        std::uniform_int_distribution<size_t> character(0, characters.size() - 1);
+        content.reserve(length * character_width);
+        for (size_t i = 0; i < length; i++)
+        {
+            content.append(character_width - 1, '\0');
+            content.push_back(characters[character(rng)]);
+        }
+    }
+    object.assign(std::string_view(content));
+}
+
+// Enumerated values are chosen by the generate_random function generated for their enumeration
+template <typename EnumeratedType, typename Identifier, StorageMode storage, typename Rng>
+void generate_random(Enumerated<EnumeratedType, Identifier, storage>& object, Rng& rng, const RandomProfile& profile)
+{
+    EnumeratedType value{};
+    generate_random(value, rng, profile);
+    object.assign(value);
+}
+
+// Identifiers of one to eight components, the first two within the ranges allowed by their encoding
+template <typename Identifier, typename Rng>
+void generate_random(ObjectIdentifier<Identifier>& object, Rng& rng, const RandomProfile&)
+{
+    std::array<int64_t, 8> components = {};
+    const size_t           count      = std::uniform_int_distribution<size_t>(2, components.size())(rng);
+
+    components[0] = std::uniform_int_distribution<int64_t>(0, 2)(rng);
+    components[1] = std::uniform_int_distribution<int64_t>(0, 39)(rng);
+    for (size_t i = 2; i < count; i++)
+    {
+        components[i] = std::uniform_int_distribution<int64_t>(0, 1 << 20)(rng);
+    }
+    object.assign(std::span<const int64_t>(components.data(), count));
+}
+
+// Times between 1970 and 2037, or times of day
+template <typename Format, typename Identifier, typename Rng>
+void generate_random(TimeImpl<Format, Identifier>& object, Rng& rng, const RandomProfile&)
+{
+    using Value = typename TimeImpl<Format, Identifier>::Value;
+
+    if constexpr (detail::is_sys_time<Value>)
+    {
+        using Duration      = typename Value::duration;
+        const Duration last = std::chrono::floor<Duration>(std::chrono::sys_days(std::chrono::year(2038) / 1 / 1) -
+                                                           std::chrono::sys_days()) -
+                              Duration(1);
+        object.set_time(Value(Duration(std::uniform_int_distribution<int64_t>(0, last.count())(rng))));
+    }
+    else
+    {
+        object.set_time(Value(std::uniform_int_distribution<int64_t>(0, 86399)(rng)));
+    }
+}
+
+template <typename T, typename DefaultValue, typename Rng>
+void generate_random(Default<T, DefaultValue>& object, Rng& rng, const RandomProfile& profile)
+{
+    T value;
+    generate_random(value, rng, profile);
+    object = value;
+}
+
+template <typename T, typename I, StorageMode s, size_t n, typename Rng>
+void generate_random(SequenceOf<T, I, s, n>& object, Rng& rng, const RandomProfile& profile)
+{
+    const size_t length = RandomNesting::exceeded(profile) ? 0 : random_length(rng, profile.sequence_of_length);
+    object.clear();
+    for (size_t i = 0; i < length; i++)
+    {
+        generate_random(object.emplace_back(), rng, profile);
+    }
+}
+
+// Any is given an octet string
+template <typename T, typename Rng>
+void generate_random(Any<T>& object, Rng& rng, const RandomProfile& profile)
+{
+    generate_random(object.template emplace<OctetString<>>(), rng, profile);
+}
+
+} // namespace fast_ber
@@ -133,7 +133,8 @@ DecodeResult SmallFixedIdBerContainer<Identifier, max_content_length>::decode_im
     if (!(input_view.is_valid() && input_view.identifier() == id &&
           input_view.construction() == Construction::primitive && input_view.content_length() <= max_content_length))
     {
-        return DecodeResult{false};
+        return DecodeResult{false,
+                            input_view.is_valid() ? DecodeError::invalid_header : DecodeError::invalid_packet};
     }
 
     std::memcpy(m_data.data() + m_header_length, input_view.content_data(), input_view.content_length());
@@ -155,7 +156,8 @@ SmallFixedIdBerContainer<Identifier, max_content_length>::decode_impl(const BerV
           input_view.begin()->content_length() <= max_content_length))
     {
 
-        return DecodeResult{false};
+        return DecodeResult{false,
+                            input_view.is_valid() ? DecodeError::invalid_header : DecodeError::invalid_packet};
     }
 
     std::memcpy(m_data.data() + m_header_length, input_view.begin()->content_data(),
@@ -0,0 +1,538 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace fast_ber
+{
+
+// Bytes of inline element storage used by small buffer optimised containers when no inline capacity is specified
+constexpr size_t small_buffer_size = 64;
+
+template <typename T>
+constexpr size_t default_inline_capacity() noexcept
+{
+    return std::max(size_t(1), small_buffer_size / sizeof(T));
+}
+
+// Vector holding up to inline_capacity elements within the object itself. Memory is only allocated once the size
+// exceeds the inline capacity, after which elements are stored on the heap as in std::vector. In addition to the cases
+// in which std::vector invalidates iterators, moving or swapping a vector with inline elements invalidates them.
+template <typename T, size_t inline_capacity, typename Allocator = std::allocator<T>>
+class SmallVector
+{
+    static_assert(inline_capacity > 0, "Inline capacity must be at least one element");
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+
+  public:
+    using value_type             = T;
+    using allocator_type         = Allocator;
+    using size_type              = size_t;
+    using difference_type        = std::ptrdiff_t;
+    using reference              = T&;
+    using const_reference        = const T&;
+    using pointer                = T*;
+    using const_pointer          = const T*;
+    using iterator               = T*;
+    using const_iterator         = const T*;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    SmallVector() noexcept {}
+    explicit SmallVector(const Allocator& allocator) noexcept : m_allocator(allocator) {}
+    explicit SmallVector(size_t count) { resize(count); }
+    SmallVector(size_t count, const T& value) { resize(count, value); }
+    template <std::input_iterator InputIt>
+    SmallVector(InputIt first, InputIt last)
+    {
+        assign(first, last);
+    }
+    SmallVector(std::initializer_list<T> values) { assign(values.begin(), values.end()); }
+    SmallVector(const SmallVector& rhs)
+        : m_allocator(AllocatorTraits::select_on_container_copy_construction(rhs.m_allocator))
+    {
+        assign(rhs.begin(), rhs.end());
+    }
+    SmallVector(SmallVector&& rhs) noexcept(std::is_nothrow_move_constructible<T>::value)
+        : m_allocator(rhs.m_allocator)
+    {
+        take(std::move(rhs));
+    }
+    ~SmallVector() noexcept { release(); }
+
+    SmallVector& operator=(const SmallVector& rhs);
+    SmallVector& operator=(SmallVector&& rhs) noexcept(
+        std::is_nothrow_move_constructible<T>::value &&
+        (AllocatorTraits::propagate_on_container_move_assignment::value || AllocatorTraits::is_always_equal::value));
+    SmallVector& operator=(std::initializer_list<T> values);
+
+    template <std::input_iterator InputIt>
+    void assign(InputIt first, InputIt last);
+    void assign(size_t count, const T& value);
+    void assign(std::initializer_list<T> values) { assign(values.begin(), values.end()); }
+
+    T&       at(size_t index);
+    const T& at(size_t index) const;
+    T&       operator[](size_t index) noexcept { return m_data[index]; }
+    const T& operator[](size_t index) const noexcept { return m_data[index]; }
+    T&       front() noexcept { return m_data[0]; }
+    const T& front() const noexcept { return m_data[0]; }
+    T&       back() noexcept { return m_data[m_size - 1]; }
+    const T& back() const noexcept { return m_data[m_size - 1]; }
+    T*       data() noexcept { return m_data; }
+    const T* data() const noexcept { return m_data; }
+
+    Allocator get_allocator() const noexcept { return m_allocator; }
+
+    iterator               begin() noexcept { return m_data; }
+    const_iterator         begin() const noexcept { return m_data; }
+    const_iterator         cbegin() const noexcept { return m_data; }
+    iterator               end() noexcept { return m_data + m_size; }
+    const_iterator         end() const noexcept { return m_data + m_size; }
+    const_iterator         cend() const noexcept { return m_data + m_size; }
+    reverse_iterator       rbegin() noexcept { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(end()); }
+    reverse_iterator       rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const noexcept { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend() const noexcept { return const_reverse_iterator(begin()); }
+
+    bool   empty() const noexcept { return m_size == 0; }
+    size_t size() const noexcept { return m_size; }
+    size_t max_size() const noexcept { return AllocatorTraits::max_size(m_allocator); }
+    size_t capacity() const noexcept { return m_capacity; }
+    void   reserve(size_t new_capacity);
+    void   shrink_to_fit();
+
+    // True if the elements are held within the object, no memory has been allocated
+    bool                    is_inline() const noexcept { return m_data == inline_data(); }
+    constexpr static size_t inline_size() noexcept { return inline_capacity; }
+
+    void     clear() noexcept;
+    iterator insert(const_iterator pos, const T& value) { return emplace(pos, value); }
+    iterator insert(const_iterator pos, T&& value) { return emplace(pos, std::move(value)); }
+    iterator insert(const_iterator pos, size_t count, const T& value);
+    template <std::input_iterator InputIt>
+    iterator insert(const_iterator pos, InputIt first, InputIt last);
+    iterator insert(const_iterator pos, std::initializer_list<T> values)
+    {
+        return insert(pos, values.begin(), values.end());
+    }
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args);
+    iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+    iterator erase(const_iterator first, const_iterator last);
+    void     push_back(const T& value) { emplace_back(value); }
+    void     push_back(T&& value) { emplace_back(std::move(value)); }
+    template <typename... Args>
+    T&   emplace_back(Args&&... args);
+    void pop_back() noexcept;
+    void resize(size_t count);
+    void resize(size_t count, const T& value);
+    void swap(SmallVector& rhs);
+
+  private:
+    T*       inline_data() noexcept { return reinterpret_cast<T*>(m_inline); }
+    const T* inline_data() const noexcept { return reinterpret_cast<const T*>(m_inline); }
+
+    // Moves the elements to a heap allocation of the given capacity
+    void   reallocate(size_t new_capacity);
+    size_t grown_capacity(size_t required) const noexcept { return std::max(m_capacity * 2, required); }
+
+    // Take the elements of rhs, which is left empty. This vector must not hold any elements or memory
+    void take(SmallVector&& rhs) noexcept(std::is_nothrow_move_constructible<T>::value);
+
+    // Destroy all elements and free any heap allocation, returning to inline storage
+    void release() noexcept;
+
+    T*     m_data     = inline_data();
+    size_t m_size     = 0;
+    size_t m_capacity = inline_capacity;
+    [[no_unique_address]] Allocator m_allocator = Allocator();
+    alignas(T) unsigned char m_inline[inline_capacity * sizeof(T)];
+};
+
+template <typename T, size_t inline_capacity, typename Allocator>
+SmallVector<T, inline_capacity, Allocator>&
+SmallVector<T, inline_capacity, Allocator>::operator=(const SmallVector& rhs)
+{
+    if (this != &rhs)
+    {
+        if constexpr (AllocatorTraits::propagate_on_container_copy_assignment::value)
+        {
+            if (m_allocator != rhs.m_allocator)
+            {
+                release();
+            }
+            m_allocator = rhs.m_allocator;
+        }
+        assign(rhs.begin(), rhs.end());
+    }
+    return *this;
+}
+
+template <typename T, size_t inline_capacity, typename Allocator>
+SmallVector<T, inline_capacity, Allocator>&
+SmallVector<T, inline_capacity, Allocator>::operator=(SmallVector&& rhs) noexcept(
+    std::is_nothrow_move_constructible<T>::value && (AllocatorTraits::propagate_on_container_move_assignment::value ||
+                                                     AllocatorTraits::is_always_equal::value))
+{
+    if (this == &rhs)
+    {
+        return *this;
+    }
+
+    if constexpr (!AllocatorTraits::propagate_on_container_move_assignment::value)
+    {
+        // Memory of rhs can't be freed by this allocator, so the elements are moved individually
+        if (m_allocator != rhs.m_allocator)
+        {
+            assign(std::make_move_iterator(rhs.begin()), std::make_move_iterator(rhs.end()));
+            rhs.clear();
+            return *this;
+        }
+    }
+
+    release();
+    if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value)
+    {
+        m_allocator = rhs.m_allocator;
+    }
+    take(std::move(rhs));
+    return *this;
+}
+
+template <typename T, size_t inline_capacity, typename Allocator>
+SmallVector<T, inline_capacity, Allocator>&
+SmallVector<T, inline_capacity, Allocator>::operator=(std::initializer_list<T> values)
+{
+    assign(values.begin(), values.end());
+    return *this;
+}
+
+template <typename T, size_t inline_capacity, typename Allocator>
+template <std::input_iterator InputIt>
+void SmallVector<T, inline_capacity, Allocator>::assign(InputIt first, InputIt last)
+{
+    clear();
+    if constexpr (std::contiguous_iterator<InputIt> && std::is_trivially_copyable<T>::value &&
+                  std::is_same<std::remove_cv_t<std::iter_value_t<InputIt>>, T>::value)
+    {
+        // Copy bytes directly, such as when storing an encoded packet
+        const size_t count = static_cast<size_t>(last - first);
+        reserve(count);
+        if (count > 0)
+        {
+            std::memcpy(m_data, std::to_address(first), count * sizeof(T));
+        }
+        m_size = count;
+        return;
+    }
+    else if constexpr (std::forward_iterator<InputIt>)
+    {
+        reserve(static_cast<size_t>(std::distance(first, last)));
+    }
+    for (; first != last; ++first)
+    {
+        emplace_back(*first);
+    }
+}
+
+template <typename T, size_t inline_capacity, typename Allocator>
+void SmallVector<T, inline_capacity, Allocator>::assign(size_t count, const T& value)
+{
+    clear();
+    resize(count, value);
+}
+
+template <typename T, size_t inline_capacity, typename Allocator>
+T& SmallVector<T, inline_capacity, Allocator>::at(size_t index)
+{
+    if (index >= m_size)
+    {
+        throw std::out_of_range("SmallVector index out of range");
+    }
+    return m_data[index];
+}
+
+template <typename T, size_t inline_capacity, typename Allocator>
+const T& SmallVector<T, inline_capacity, Allocator>::at(size_t index) const
+{
+    if (index >= m_size)
+    {
+        throw std::out_of_range("SmallVector index out of range");
+    }
+    return m_data[index];
+}
+
+template <typename T, size_t inline_capacity, typename Allocator>
+void SmallVector<T, inline_capacity, Allocator>::reserve(size_t new_capacity)
+{
+    if (new_capacity > m_capacity)
+    {
+        reallocate(new_capacity);
+    }
+}
+
+template <typename T, size_t inline_capacity, typename Allocator>
+void SmallVector<T, inline_capacity, Allocator>::shrink_to_fit()
+{
+    if (is_inline() || m_size > inline_capacity)
+    {
+        return;
+    }
+
+    T* const heap_data = m_data;
+    std::uninitialized_move(heap_data, heap_data + m_size, inline_data());
+    std::destroy(heap_data, heap_data + m_size);
+    m_allocator.deallocate(heap_data, m_capacity);
+    m_data     = inline_data();
+    m_capacity = inline_capacity;
+}
+
+template <typename T, size_t inline_capacity, typename Allocator>
+void SmallVector<T, inline_capacity, Allocator>::clear() noexcept
+{
+    std::destroy(begin(), end());
+    m_size = 0;
+}
+
+template <typename T, size_t inline_capacity, typename Allocator>
+typename SmallVector<T, inline_capacity, Allocator>::iterator
+SmallVector<T, inline_capacity, Allocator>::insert(const_iterator pos, size_t count, const T& value)
+{
+    const size_t index    = static_cast<size_t>(pos - begin());
+    const size_t old_size = m_size;
+    if (m_size + count > m_capacity)
+    {
+        // Value may refer to an element which is moved by reallocation
+        const T copy = value;
+        reserve(m_size + count);
+        for (size_t i = 0; i < count; i++)
+        {
+            emplace_back(copy);
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            emplace_back(value);
+        }
+    }
+    std::rotate(begin() + index, begin() + old_size, end());
+    return begin() + index;
+}
+
+template <typename T, size_t inline_capacity, typename Allocator>
+template <std::input_iterator InputIt>
+typename SmallVector<T, inline_capacity, Allocator>::iterator
+SmallVector<T, inline_capacity, Allocator>::insert(const_iterator pos, InputIt first, InputIt last)
+{
+    // Elements are appended and rotated into place, so input iterators are only traversed once
+    const size_t index    = static_cast<size_t>(pos - begin());
+    const size_t old_size = m_size;
+    for (; first != last; ++first)
+    {
+        emplace_back(*first);
+    }
+    std::rotate(begin() + index, begin() + old_size, end());
+    return begin() + index;
+}
+
+template <typename T, size_t inline_capacity, typename Allocator>
+template <typename... Args>
+typename SmallVector<T, inline_capacity, Allocator>::iterator
+SmallVector<T, inline_capacity, Allocator>::emplace(const_iterator pos, Args&&... args)
+{
+    const size_t index = static_cast<size_t>(pos - begin());
+    if (index == m_size)
+    {
+        emplace_back(std::forward<Args>(args)...);
+        return begin() + index;
+    }
+
+    // Arguments may refer to an element, so the new value is constructed before any elements are moved
+    T value(std::forward<Args>(args)...);
+    emplace_back(std::move(back()));
+    std::move_backward(begin() + index, end() - 2, end() - 1);
+    m_data[index] = std::move(value);
+    return begin() + index;
+}
+
+template <typename T, size_t inline_capacity, typename Allocator>
+typename SmallVector<T, inline_capacity, Allocator>::iterator
+SmallVector<T, inline_capacity, Allocator>::erase(const_iterator first, const_iterator last)
+{
+    const size_t index = static_cast<size_t>(first - begin());
+    const size_t count = static_cast<size_t>(last - first);
+    if (count > 0)
+    {
+        std::move(begin() + index + count, end(), begin() + index);
+        std::destroy(end() - count, end());
+        m_size -= count;
+    }
+    return begin() + index;
+}
+
+template <typename T, size_t inline_capacity, typename Allocator>
+template <typename... Args>
+T& SmallVector<T, inline_capacity, Allocator>::emplace_back(Args&&... args)
+{
+    if (m_size < m_capacity)
+    {
+        T* const element = std::construct_at(m_data + m_size, std::forward<Args>(args)...);
+        m_size++;
+        return *element;
+    }
+
+    // Construct the new element before moving the existing ones, as arguments may refer to an existing element
+    const size_t new_capacity = grown_capacity(m_size + 1);
+    T* const     new_data     = m_allocator.allocate(new_capacity);
+    try
+    {
+        std::construct_at(new_data + m_size, std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        m_allocator.deallocate(new_data, new_capacity);
+        throw;
+    }
+    std::uninitialized_move(begin(), end(), new_data);
+    std::destroy(begin(), end());
+    if (!is_inline())
+    {
+        m_allocator.deallocate(m_data, m_capacity);
+    }
+    m_data     = new_data;
+    m_capacity = new_capacity;
+    m_size++;
+    return back();
+}
+
+template <typename T, size_t inline_capacity, typename Allocator>
+void SmallVector<T, inline_capacity, Allocator>::pop_back() noexcept
+{
+    m_size--;
+    std::destroy_at(m_data + m_size);
+}
+
+template <typename T, size_t inline_capacity, typename Allocator>
+void SmallVector<T, inline_capacity, Allocator>::resize(size_t count)
+{
+    if (count < m_size)
+    {
+        std::destroy(begin() + count, end());
+    }
+    else
+    {
+        reserve(count);
+        std::uninitialized_value_construct(end(), begin() + count);
+    }
+    m_size = count;
+}
+
+template <typename T, size_t inline_capacity, typename Allocator>
+void SmallVector<T, inline_capacity, Allocator>::resize(size_t count, const T& value)
+{
+    if (count < m_size)
+    {
+        std::destroy(begin() + count, end());
+        m_size = count;
+        return;
+    }
+
+    if (count > m_capacity)
+    {
+        // Value may refer to an element which is moved by reallocation
+        const T copy = value;
+        reserve(count);
+        std::uninitialized_fill(end(), begin() + count, copy);
+    }
+    else
+    {
+        std::uninitialized_fill(end(), begin() + count, value);
+    }
+    m_size = count;
+}
+
+template <typename T, size_t inline_capacity, typename Allocator>
+void SmallVector<T, inline_capacity, Allocator>::swap(SmallVector& rhs)
+{
+    SmallVector temporary(std::move(rhs));
+    rhs   = std::move(*this);
+    *this = std::move(temporary);
+}
+
+template <typename T, size_t inline_capacity, typename Allocator>
+void SmallVector<T, inline_capacity, Allocator>::reallocate(size_t new_capacity)
+{
+    T* const new_data = m_allocator.allocate(new_capacity);
+    std::uninitialized_move(begin(), end(), new_data);
+    std::destroy(begin(), end());
+    if (!is_inline())
+    {
+        m_allocator.deallocate(m_data, m_capacity);
+    }
+    m_data     = new_data;
+    m_capacity = new_capacity;
+}
+
+template <typename T, size_t inline_capacity, typename Allocator>
+void SmallVector<T, inline_capacity, Allocator>::take(SmallVector&& rhs) noexcept(
+    std::is_nothrow_move_constructible<T>::value)
+{
+    if (rhs.is_inline())
+    {
+        std::uninitialized_move(rhs.begin(), rhs.end(), inline_data());
+        m_size = rhs.m_size;
+        rhs.clear();
+        return;
+    }
+
+    m_data         = rhs.m_data;
+    m_size         = rhs.m_size;
+    m_capacity     = rhs.m_capacity;
+    rhs.m_data     = rhs.inline_data();
+    rhs.m_size     = 0;
+    rhs.m_capacity = inline_capacity;
+}
+
+template <typename T, size_t inline_capacity, typename Allocator>
+void SmallVector<T, inline_capacity, Allocator>::release() noexcept
+{
+    clear();
+    if (!is_inline())
+    {
+        m_allocator.deallocate(m_data, m_capacity);
+        m_data     = inline_data();
+        m_capacity = inline_capacity;
+    }
+}
+
+template <typename T, size_t capacity1, typename Allocator1, size_t capacity2, typename Allocator2>
+bool operator==(const SmallVector<T, capacity1, Allocator1>& lhs, const SmallVector<T, capacity2, Allocator2>& rhs)
+{
+    return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template <typename T, size_t capacity1, typename Allocator1, size_t capacity2, typename Allocator2>
+bool operator!=(const SmallVector<T, capacity1, Allocator1>& lhs, const SmallVector<T, capacity2, Allocator2>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template <typename T, size_t inline_capacity, typename Allocator>
+void swap(SmallVector<T, inline_capacity, Allocator>& lhs, SmallVector<T, inline_capacity, Allocator>& rhs)
+{
+    lhs.swap(rhs);
+}
+
+} // namespace fast_ber
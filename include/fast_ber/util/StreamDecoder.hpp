@@ -0,0 +1,344 @@
+#pragma once
+
+#include "fast_ber/util/BerView.hpp"
+#include "fast_ber/util/Extract.hpp"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include <cstdint>
+#include <cstring>
+
+namespace fast_ber
+{
+
+enum class StreamStatus
+{
+    complete,  // A PDU has been framed
+    need_more, // The buffered bytes are the start of a PDU, at least needed() more bytes are required
+    malformed, // The buffered bytes are not the start of a PDU, or the PDU would not fit in the buffer
+};
+
+// Incremental framing of a stream of BER PDUs which arrives in chunks of any size, such as reads from a socket.
+// Bytes are added to a ring buffer and complete PDUs are returned as BerViews. A PDU which wraps around the end of the
+// ring is copied to contiguous storage, other PDUs are viewed in place. Progress through a partially received PDU is
+// kept between calls, so buffered bytes are not scanned again when more arrive. A malformed stream cannot be
+// resynchronized, next() returns malformed until the decoder is reset.
+class StreamDecoder
+{
+  public:
+    static constexpr size_t default_capacity = 64 * 1024;
+
+    // The capacity is the length of the largest PDU which may be framed
+    explicit StreamDecoder(size_t capacity = default_capacity)
+        : m_storage(std::make_unique_for_overwrite<uint8_t[]>(std::max<size_t>(capacity, 1))),
+          m_capacity(std::max<size_t>(capacity, 1))
+    {
+    }
+
+    // Copy bytes into the buffer. Return the number of bytes accepted, fewer than the input if the buffer is full
+    size_t push(std::span<const uint8_t> input) noexcept;
+
+    // Contiguous free space, which may be written to directly, such as by recv(). Written bytes are added by commit()
+    std::span<uint8_t> prepare() noexcept;
+    void               commit(size_t length) noexcept { m_size += std::min(length, m_capacity - m_size); }
+
+    // Frame the next PDU. On success pdu views the PDU until the next call to next() or reset()
+    StreamStatus next(BerView& pdu);
+
+    size_t needed() const noexcept { return m_needed; }
+    size_t buffered() const noexcept { return m_size; }
+    size_t capacity() const noexcept { return m_capacity; }
+    void   reset() noexcept;
+
+  private:
+    // Identifier and length octets of a packet, which may be split between reads
+    struct Header
+    {
+        Tag    tag             = 0;
+        size_t length          = 0;
+        size_t content_length  = 0;
+        bool   indefinite      = false; // Content is terminated by end-of-contents octets, content_length is unused
+        bool   constructed     = false;
+        bool   end_of_contents = false;
+    };
+
+    // Longer identifiers overflow Tag
+    static constexpr size_t max_header_length = 32;
+
+    StreamStatus parse_header(size_t offset, bool nested, Header& header) noexcept;
+    void         copy(size_t offset, uint8_t* output, size_t length) const noexcept;
+    void         release() noexcept;
+
+    // Length is counted from the end of the buffered bytes, which start at the PDU being framed
+    StreamStatus need(size_t length) noexcept
+    {
+        if (length > m_capacity - m_size)
+        {
+            return fail();
+        }
+        m_needed = length;
+        return StreamStatus::need_more;
+    }
+    StreamStatus fail() noexcept
+    {
+        m_malformed = true;
+        return StreamStatus::malformed;
+    }
+
+    std::unique_ptr<uint8_t[]> m_storage;
+    size_t                     m_capacity;
+    size_t                     m_read      = 0; // Storage offset of the first buffered byte
+    size_t                     m_size      = 0; // Number of buffered bytes
+    size_t                     m_pending   = 0; // Length of the last PDU framed, released by the next call to next()
+    size_t                     m_needed    = 0;
+    bool                       m_malformed = false;
+    std::vector<uint8_t>       m_linear; // PDUs which wrap around the end of the storage
+
+    // Progress through the PDU at the front of the buffer
+    Tag    m_tag           = 0;
+    size_t m_header_length = 0; // Zero until the header of the PDU has been received
+    size_t m_frame_length  = 0; // Zero until the end of the PDU is known
+    size_t m_scanned       = 0; // Of an indefinite length PDU, bytes which have been walked
+    size_t m_depth         = 0; // Of an indefinite length PDU, number of unterminated indefinite length packets
+    bool   m_indefinite    = false;
+};
+
+inline size_t StreamDecoder::push(std::span<const uint8_t> input) noexcept
+{
+    size_t accepted = 0;
+    while (accepted < input.size())
+    {
+        const std::span<uint8_t> space = prepare();
+        if (space.empty())
+        {
+            break;
+        }
+        const size_t length = std::min(space.size(), input.size() - accepted);
+        std::memcpy(space.data(), input.data() + accepted, length);
+        commit(length);
+        accepted += length;
+    }
+    return accepted;
+}
+
+inline std::span<uint8_t> StreamDecoder::prepare() noexcept
+{
+    size_t write = m_read + m_size;
+    if (write >= m_capacity)
+    {
+        write -= m_capacity;
+        return std::span<uint8_t>(m_storage.get() + write, m_read - write);
+    }
+    return std::span<uint8_t>(m_storage.get() + write, m_capacity - write);
+}
+
+inline StreamStatus StreamDecoder::next(BerView& pdu)
+{
+    release();
+    if (m_malformed)
+    {
+        return StreamStatus::malformed;
+    }
+
+    if (m_header_length == 0)
+    {
+        Header             header;
+        const StreamStatus status = parse_header(0, false, header);
+        if (status != StreamStatus::complete)
+        {
+            return status;
+        }
+
+        m_tag           = header.tag;
+        m_header_length = header.length;
+        if (header.indefinite)
+        {
+            if (!header.constructed)
+            {
+                return fail();
+            }
+            m_indefinite = true;
+            m_scanned    = header.length;
+            m_depth      = 1;
+        }
+        else
+        {
+            if (header.length > m_capacity || header.content_length > m_capacity - header.length)
+            {
+                return fail();
+            }
+            m_frame_length = header.length + header.content_length;
+        }
+    }
+
+    // Walk the nested packets of an indefinite length PDU until its end-of-contents octets are found
+    while (m_depth > 0)
+    {
+        if (m_scanned >= m_size)
+        {
+            return need(m_scanned - m_size + BerView::end_of_contents_length * m_depth);
+        }
+
+        Header             header;
+        const StreamStatus status = parse_header(m_scanned, true, header);
+        if (status != StreamStatus::complete)
+        {
+            return status;
+        }
+
+        m_scanned += header.length;
+        if (header.end_of_contents)
+        {
+            m_depth--;
+        }
+        else if (header.indefinite)
+        {
+            if (!header.constructed)
+            {
+                return fail();
+            }
+            m_depth++;
+        }
+        else
+        {
+            if (header.content_length > m_capacity)
+            {
+                return fail();
+            }
+            m_scanned += header.content_length;
+        }
+
+        if (m_scanned > m_capacity)
+        {
+            return fail();
+        }
+        if (m_depth == 0)
+        {
+            m_frame_length = m_scanned;
+        }
+    }
+
+    if (m_frame_length > m_size)
+    {
+        return need(m_frame_length - m_size);
+    }
+
+    const uint8_t* data = m_storage.get() + m_read;
+    if (m_read + m_frame_length > m_capacity)
+    {
+        m_linear.resize(m_frame_length);
+        copy(0, m_linear.data(), m_frame_length);
+        data = m_linear.data();
+    }
+
+    const size_t content_length =
+        m_frame_length - m_header_length - (m_indefinite ? BerView::end_of_contents_length : 0);
+    pdu.assign(std::span<const uint8_t>(data, m_frame_length), m_tag, m_header_length, content_length, m_indefinite);
+
+    m_pending       = m_frame_length;
+    m_header_length = 0;
+    m_frame_length  = 0;
+    m_scanned       = 0;
+    m_indefinite    = false;
+    return StreamStatus::complete;
+}
+
+inline void StreamDecoder::reset() noexcept
+{
+    m_read          = 0;
+    m_size          = 0;
+    m_pending       = 0;
+    m_needed        = 0;
+    m_malformed     = false;
+    m_header_length = 0;
+    m_frame_length  = 0;
+    m_scanned       = 0;
+    m_depth         = 0;
+    m_indefinite    = false;
+}
+
+inline StreamStatus StreamDecoder::parse_header(size_t offset, bool nested, Header& header) noexcept
+{
+    std::array<uint8_t, max_header_length> bytes;
+    const size_t                           available = std::min(m_size - offset, bytes.size());
+    copy(offset, bytes.data(), available);
+    const std::span<const uint8_t> input(bytes.data(), available);
+
+    if (nested && input[0] == 0x00)
+    {
+        if (available < BerView::end_of_contents_length)
+        {
+            return need(BerView::end_of_contents_length - available);
+        }
+        if (input[1] == 0x00)
+        {
+            header.length          = BerView::end_of_contents_length;
+            header.end_of_contents = true;
+            return StreamStatus::complete;
+        }
+    }
+
+    const size_t tag_length = extract_tag(input, header.tag);
+    if (tag_length == 0)
+    {
+        return available == bytes.size() ? fail() : need(1);
+    }
+    if (tag_length == available)
+    {
+        return need(1);
+    }
+
+    // Long form length, with the number of length octets in the first
+    const uint8_t first = input[tag_length];
+    if ((first & 0x80) != 0 && first != 0x80)
+    {
+        const size_t length_length = 1 + (first & 0x7F);
+        if (length_length > 9)
+        {
+            return fail();
+        }
+        if (tag_length + length_length > available)
+        {
+            return need(tag_length + length_length - available);
+        }
+    }
+
+    header.length      = tag_length + extract_length(input, header.content_length, tag_length, header.indefinite);
+    header.constructed = get_construction(input[0]) == Construction::constructed;
+    return StreamStatus::complete;
+}
+
+inline void StreamDecoder::copy(size_t offset, uint8_t* output, size_t length) const noexcept
+{
+    size_t start = m_read + offset;
+    if (start >= m_capacity)
+    {
+        start -= m_capacity;
+    }
+    const size_t first = std::min(length, m_capacity - start);
+    std::memcpy(output, m_storage.get() + start, first);
+    std::memcpy(output + first, m_storage.get(), length - first);
+}
+
+inline void StreamDecoder::release() noexcept
+{
+    m_read += m_pending;
+    if (m_read >= m_capacity)
+    {
+        m_read -= m_capacity;
+    }
+    m_size -= m_pending;
+    m_pending = 0;
+
+    // Start from the beginning of the storage when empty, so fewer PDUs wrap
+    if (m_size == 0)
+    {
+        m_read = 0;
+    }
+}
+
+} // namespace fast_ber
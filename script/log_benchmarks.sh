@@ -6,4 +6,9 @@ mkdir -p ../build_bench
 cd ../build_bench
 cmake --verbose -D CMAKE_CXX_COMPILER=clang++-7 CMAKE_C_COMPILER=clang-7 -DCMAKE_BUILD_TYPE=Release ..
 make -j10
-./benchmarks/fast_ber_benchmarks > ../benchmarks/history/results_${TAG}.txt
+
+# Results are kept as JSON, compare them with ./benchmarks/compare/fast_ber_benchmark_compare
+./benchmarks/fast_ber_benchmarks > results_${TAG}.txt
+./benchmarks/compare/fast_ber_benchmark_compare --convert results_${TAG}.txt ../benchmarks/history/results_${TAG}.json \
+    --context git_describe=${TAG} --context compiler=clang++-7 --context build_type=Release
+./benchmarks/corpus/fast_ber_corpus_benchmarks --json ../benchmarks/history/corpus_${TAG}.json
@@ -7,15 +7,17 @@ SequenceOfType::SequenceOfType(bool a, std::unique_ptr<NamedType>&& b, std::uniq
 SequenceOfType::SequenceOfType(const SequenceOfType& rhs)
     : has_name(rhs.has_name),
       named_type(rhs.named_type ? std::unique_ptr<NamedType>(new NamedType(*rhs.named_type)) : nullptr),
-      type(rhs.type ? new Type(*rhs.type) : nullptr), storage(rhs.storage)
+      type(rhs.type ? new Type(*rhs.type) : nullptr), storage(rhs.storage),
+      inline_capacity(rhs.inline_capacity)
 {
 }
 SequenceOfType& SequenceOfType::operator=(const SequenceOfType& rhs)
 {
-    has_name   = rhs.has_name;
-    named_type = rhs.named_type ? std::unique_ptr<NamedType>(new NamedType(*rhs.named_type)) : nullptr;
-    type       = rhs.type ? std::unique_ptr<Type>(new Type(*rhs.type)) : nullptr;
-    storage    = rhs.storage;
+    has_name        = rhs.has_name;
+    named_type      = rhs.named_type ? std::unique_ptr<NamedType>(new NamedType(*rhs.named_type)) : nullptr;
+    type            = rhs.type ? std::unique_ptr<Type>(new Type(*rhs.type)) : nullptr;
+    storage         = rhs.storage;
+    inline_capacity = rhs.inline_capacity;
     return *this;
 }
 
@@ -224,11 +226,24 @@ std::string to_string(StorageMode mode)
         return "StorageMode::small_buffer_optimised";
     case StorageMode::dynamic:
         return "StorageMode::dynamic";
+    case StorageMode::borrowed:
+        return "StorageMode::borrowed";
+    case StorageMode::native:
+        return "StorageMode::native";
     }
 
     return "Unknown StorageMode";
 }
 
+std::string storage_template_params(const SequenceOfType& sequence)
+{
+    if (sequence.storage == StorageMode::small_buffer_optimised && sequence.inline_capacity > 0)
+    {
+        return to_string(sequence.storage) + ", " + std::to_string(sequence.inline_capacity);
+    }
+    return to_string(sequence.storage);
+}
+
 std::string make_type_optional(const std::string& type, StorageMode mode)
 {
     return "Optional<" + type + ", " + to_string(mode) + ">";
@@ -298,12 +313,23 @@ bool is_octet_string(const Type& type)
            std::holds_alternative<OctetStringType>(std::get<BuiltinType>(type));
 }
 
+bool is_character_string(const Type& type)
+{
+    return std::holds_alternative<BuiltinType>(type) &&
+           std::holds_alternative<CharacterStringType>(std::get<BuiltinType>(type));
+}
+
 bool is_boolean(const Type& type)
 {
     return std::holds_alternative<BuiltinType>(type) &&
            std::holds_alternative<BooleanType>(std::get<BuiltinType>(type));
 }
 
+bool is_real(const Type& type)
+{
+    return std::holds_alternative<BuiltinType>(type) && std::holds_alternative<RealType>(std::get<BuiltinType>(type));
+}
+
 bool is_oid(const Type& type)
 {
     return std::holds_alternative<BuiltinType>(type) &&
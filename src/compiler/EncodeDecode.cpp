@@ -11,6 +11,35 @@
 #include <string>
 #include <vector>
 
+// Body of a generated encode_with_id or decode_with_id function. The body is generated as a lambda, called through
+// the instrumentation hook so that the instrumentation policy sees the result however the body returns
+class InstrumentedScope
+{
+  public:
+    InstrumentedScope(CodeBlock& block, const std::string& result_type, const std::string& hook_call)
+        : m_block(block), m_hook_call(hook_call)
+    {
+        m_block.add_line("{");
+        m_block.indentation()++;
+        m_block.add_line("const auto body_ = [&]() noexcept -> " + result_type);
+        m_block.add_line("{");
+        m_block.indentation()++;
+    }
+    InstrumentedScope(const InstrumentedScope&) = delete;
+    ~InstrumentedScope()
+    {
+        m_block.indentation()--;
+        m_block.add_line("};");
+        m_block.add_line("return " + m_hook_call + ";");
+        m_block.indentation()--;
+        m_block.add_line("}");
+    }
+
+  private:
+    CodeBlock&  m_block;
+    std::string m_hook_call;
+};
+
 std::string make_component_function(const std::string& function, const NamedType& component, const Module& module,
                                     const Asn1Tree& tree)
 {
@@ -57,6 +86,33 @@ bool isAssignementOfType(const Asn1Tree& tree, const DefinedType& valueType)
     return false;
 }
 
+// Call encoding a member of a generated type, members without a specific identifier are encoded through the free
+// function of the same name, which also handles library types
+std::string make_member_encode_call(const std::string& function, const std::string& member, const std::string& output,
+                                    std::size_t automatic_tag, const NamedType& component, const Module& module,
+                                    const Asn1Tree& tree)
+{
+    auto        valueType = std::get_if<DefinedType>(&component.type);
+    std::string member_function;
+    if (module.tagging_default == TaggingMode::automatic && valueType &&
+        (isAssignementOfType<SequenceType>(tree, *valueType) || isAssignementOfType<ChoiceType>(tree, *valueType)))
+    {
+        member_function = make_component_function(
+            function + "_with_id<Id<Class::context_specific, " + std::to_string(automatic_tag) + ">>", component,
+            module, tree);
+    }
+    else
+    {
+        member_function = make_component_function(function, component, module, tree);
+    }
+
+    if (member_function == function)
+    {
+        return "fast_ber::" + function + "(" + output + ", " + member + ")";
+    }
+    return member + "." + member_function + "(" + output + ")";
+}
+
 template <typename CollectionType>
 CodeBlock create_collection_encode_functions(const std::string& name, const CollectionType& collection,
                                              const Module& module, const Asn1Tree& tree)
@@ -66,7 +122,8 @@ CodeBlock create_collection_encode_functions(const std::string& name, const Coll
     block.add_line(create_template_definition({"Identifier_"}));
     block.add_line("inline EncodeResult " + name + "::encode_with_id(std::span<uint8_t> output) const noexcept");
     {
-        auto scope = CodeScope(block);
+        auto scope = InstrumentedScope(block, "EncodeResult",
+                                       "fast_ber::instrument_encode(*this, \"" + name + "\", body_)");
         block.add_line("constexpr std::size_t header_length_guess = fast_ber::encoded_length(0, Identifier_{});");
         block.add_line("if (output.size() < header_length_guess)");
 
@@ -116,6 +173,102 @@ CodeBlock create_collection_encode_functions(const std::string& name, const Coll
     }
     block.add_line();
 
+    block.add_line(create_template_definition({"Identifier_"}));
+    block.add_line("inline EncodeResult " + name +
+                   "::encode_reverse_with_id(std::span<uint8_t> output) const noexcept");
+    {
+        auto scope = CodeScope(block);
+        if (collection.components.size() != 0)
+        {
+            block.add_line("EncodeResult res;");
+            block.add_line("auto content = output;");
+        }
+        block.add_line("std::size_t content_length = 0;");
+
+        // Members are written from the back of the buffer, so are visited in reverse order
+        for (size_t i = collection.components.size(); i-- > 0;)
+        {
+            const ComponentType& component = collection.components[i];
+            block.add_line("res = " +
+                           make_member_encode_call("encode_reverse", component.named_type.name, "content", i,
+                                                   component.named_type, module, tree) +
+                           ";");
+
+            block.add_line("if (!res.success)");
+            {
+                auto scope2 = CodeScope(block);
+                block.add_line("return res;");
+            }
+            block.add_line("content = content.first(content.size() - res.length);");
+            block.add_line("content_length += res.length;");
+        }
+        block.add_line("return wrap_with_ber_header_reverse(output, content_length, Identifier_{});");
+    }
+    block.add_line();
+
+    block.add_line(create_template_definition({"Identifier_"}));
+    block.add_line("inline EncodeResult " + name +
+                   "::encode_indefinite_with_id(std::span<uint8_t> output) const noexcept");
+    {
+        auto scope = CodeScope(block);
+        block.add_line("EncodeResult res = encode_indefinite_header(output, Identifier_{});");
+        block.add_line("if (!res.success)");
+        {
+            auto scope2 = CodeScope(block);
+            block.add_line("return res;");
+        }
+        block.add_line("std::size_t length = res.length;");
+
+        size_t i = 0;
+        for (const ComponentType& component : collection.components)
+        {
+            block.add_line("res = " +
+                           make_member_encode_call("encode_indefinite", component.named_type.name,
+                                                   "output.subspan(length)", i, component.named_type, module, tree) +
+                           ";");
+            block.add_line("if (!res.success)");
+            {
+                auto scope2 = CodeScope(block);
+                block.add_line("return res;");
+            }
+            block.add_line("length += res.length;");
+            ++i;
+        }
+        block.add_line("res = encode_end_of_contents(output.subspan(length), Identifier_{});");
+        block.add_line("return EncodeResult{res.success, length + res.length};");
+    }
+    block.add_line();
+
+    block.add_line(create_template_definition({"Identifier_"}));
+    block.add_line("inline EncodeResult " + name + "::encode_gather_with_id(GatherBuffer& output) const noexcept");
+    {
+        auto scope = CodeScope(block);
+        if (collection.components.size() != 0)
+        {
+            block.add_line("EncodeResult res;");
+        }
+        block.add_line("std::size_t content_length = 0;");
+
+        // Segments are prepended, so members are visited in reverse order
+        for (size_t i = collection.components.size(); i-- > 0;)
+        {
+            const ComponentType& component = collection.components[i];
+            block.add_line("res = " +
+                           make_member_encode_call("encode_gather", component.named_type.name, "output", i,
+                                                   component.named_type, module, tree) +
+                           ";");
+
+            block.add_line("if (!res.success)");
+            {
+                auto scope2 = CodeScope(block);
+                block.add_line("return res;");
+            }
+            block.add_line("content_length += res.length;");
+        }
+        block.add_line("return encode_gather_header(output, content_length, Identifier_{});");
+    }
+    block.add_line();
+
     block.add_line(create_template_definition({"Identifier_"}));
     block.add_line("std::size_t " + name + "::encoded_length_with_id() const noexcept");
     {
@@ -142,7 +295,8 @@ CodeBlock create_choice_encode_functions(const std::string& name, const ChoiceTy
     block.add_line(create_template_definition({"Identifier_"}));
     block.add_line("inline EncodeResult " + name + "::encode_with_id(std::span<uint8_t> output) const noexcept");
     {
-        auto scope1 = CodeScope(block);
+        auto scope1 = InstrumentedScope(block, "EncodeResult",
+                                        "fast_ber::instrument_encode(*this, \"" + name + "\", body_)");
         block.add_line("EncodeResult res;");
         block.add_line("auto content = output;");
         // If an alternative (non ChoiceId) identifier is provided choice type should be wrapped,
@@ -210,6 +364,131 @@ CodeBlock create_choice_encode_functions(const std::string& name, const ChoiceTy
 
     block.add_line();
 
+    block.add_line(create_template_definition({"Identifier_"}));
+    block.add_line("inline EncodeResult " + name +
+                   "::encode_reverse_with_id(std::span<uint8_t> output) const noexcept");
+    {
+        auto scope1 = CodeScope(block);
+        block.add_line("EncodeResult res;");
+        block.add_line("auto content = output;");
+        block.add_line("switch (this->index())");
+        {
+            auto scope2 = CodeScope(block);
+            for (std::size_t i = 0; i < choice.choices.size(); i++)
+            {
+                block.add_line("case " + std::to_string(i) + ":");
+                block.add_line("	res = " +
+                               make_member_encode_call("encode_reverse",
+                                                       "fast_ber::get<" + std::to_string(i) + ">(*this)", "content", 0,
+                                                       choice.choices[i], module, tree) +
+                               ";");
+                block.add_line("	break;");
+            }
+            block.add_line("default: assert(0);");
+        }
+
+        block.add_line("if (!IsChoiceId<Identifier_>::value)");
+        {
+            auto scope2 = CodeScope(block);
+            block.add_line("if (!res.success)");
+            {
+                auto scope3 = CodeScope(block);
+                block.add_line("return res;");
+            }
+            block.add_line("return wrap_with_ber_header_reverse(output, res.length, Identifier_{});");
+        }
+        block.add_line("else");
+        {
+            auto scope2 = CodeScope(block);
+            block.add_line("return res;");
+        }
+    }
+
+    block.add_line();
+
+    block.add_line(create_template_definition({"Identifier_"}));
+    block.add_line("inline EncodeResult " + name +
+                   "::encode_indefinite_with_id(std::span<uint8_t> output) const noexcept");
+    {
+        auto scope1 = CodeScope(block);
+        block.add_line("EncodeResult res;");
+        block.add_line("std::size_t length = 0;");
+        block.add_line("if (!IsChoiceId<Identifier_>::value)");
+        {
+            auto scope2 = CodeScope(block);
+            block.add_line("res = encode_indefinite_header(output, Identifier_{});");
+            block.add_line("if (!res.success)");
+            {
+                auto scope3 = CodeScope(block);
+                block.add_line("return res;");
+            }
+            block.add_line("length = res.length;");
+        }
+        block.add_line("switch (this->index())");
+        {
+            auto scope2 = CodeScope(block);
+            for (std::size_t i = 0; i < choice.choices.size(); i++)
+            {
+                block.add_line("case " + std::to_string(i) + ":");
+                block.add_line("	res = " +
+                               make_member_encode_call("encode_indefinite",
+                                                       "fast_ber::get<" + std::to_string(i) + ">(*this)",
+                                                       "output.subspan(length)", 0, choice.choices[i], module, tree) +
+                               ";");
+                block.add_line("	break;");
+            }
+            block.add_line("default: assert(0);");
+        }
+        block.add_line("if (!res.success || IsChoiceId<Identifier_>::value)");
+        {
+            auto scope2 = CodeScope(block);
+            block.add_line("return res;");
+        }
+        block.add_line("length += res.length;");
+        block.add_line("res = encode_end_of_contents(output.subspan(length), Identifier_{});");
+        block.add_line("return EncodeResult{res.success, length + res.length};");
+    }
+    block.add_line();
+
+    block.add_line(create_template_definition({"Identifier_"}));
+    block.add_line("inline EncodeResult " + name + "::encode_gather_with_id(GatherBuffer& output) const noexcept");
+    {
+        auto scope1 = CodeScope(block);
+        block.add_line("EncodeResult res;");
+        block.add_line("switch (this->index())");
+        {
+            auto scope2 = CodeScope(block);
+            for (std::size_t i = 0; i < choice.choices.size(); i++)
+            {
+                block.add_line("case " + std::to_string(i) + ":");
+                block.add_line("	res = " +
+                               make_member_encode_call("encode_gather",
+                                                       "fast_ber::get<" + std::to_string(i) + ">(*this)", "output", 0,
+                                                       choice.choices[i], module, tree) +
+                               ";");
+                block.add_line("	break;");
+            }
+            block.add_line("default: assert(0);");
+        }
+
+        block.add_line("if (!IsChoiceId<Identifier_>::value)");
+        {
+            auto scope2 = CodeScope(block);
+            block.add_line("if (!res.success)");
+            {
+                auto scope3 = CodeScope(block);
+                block.add_line("return res;");
+            }
+            block.add_line("return encode_gather_header(output, res.length, Identifier_{});");
+        }
+        block.add_line("else");
+        {
+            auto scope2 = CodeScope(block);
+            block.add_line("return res;");
+        }
+    }
+    block.add_line();
+
     block.add_line(create_template_definition({"Identifier_"}));
     block.add_line("inline std::size_t " + name + "::encoded_length_with_id() const noexcept");
     {
@@ -244,20 +523,60 @@ CodeBlock create_choice_encode_functions(const std::string& name, const ChoiceTy
     return block;
 }
 
+using IndexedIdentifiers = std::vector<std::pair<Identifier, std::size_t>>;
+
+// Outer identifiers of each member of a SET or alternative of a CHOICE, with the index of the member
+IndexedIdentifiers indexed_identifiers(const std::vector<NamedType>& members, const Module& module,
+                                       const Asn1Tree& tree)
+{
+    IndexedIdentifiers identifiers;
+    for (std::size_t i = 0; i < members.size(); i++)
+    {
+        if (module.tagging_default == TaggingMode::automatic)
+        {
+            identifiers.emplace_back(Identifier(Class::context_specific, static_cast<int64_t>(i)), i);
+            continue;
+        }
+        for (const Identifier& id : outer_identifiers(members[i].type, module, tree))
+        {
+            identifiers.emplace_back(id, i);
+        }
+    }
+    return identifiers;
+}
+
+// Initializer of the entries of a fast_ber::IdentifierTable or fast_ber::IdentifierSet
+std::string identifier_entries(const IndexedIdentifiers& identifiers)
+{
+    std::string entries;
+    for (const auto& [id, index] : identifiers)
+    {
+        entries += (entries.empty() ? "{" : ", {") + to_string(id.class_) + ", " +
+                   std::to_string(id.tag_number) + ", " + std::to_string(index) + "}";
+    }
+    return "std::array<fast_ber::IdentifierEntry, " + std::to_string(identifiers.size()) + ">{{" + entries + "}}";
+}
+
 template <typename CollectionType>
 CodeBlock create_collection_decode_functions(const std::string& name, const CollectionType& collection,
                                              const Module& module, const Asn1Tree& tree)
 {
     CodeBlock block;
+    auto      member_decode_error = [&](const ComponentType& component) {
+        return R"(return fast_ber::member_decode_error(res, input, *iterator, ")" + name + "." +
+               component.named_type.name + R"(");)";
+    };
+
     block.add_line(create_template_definition({"Identifier_"}));
     block.add_line("DecodeResult " + name + "::decode_with_id(BerView input) noexcept");
     {
-        auto scope = CodeScope(block);
+        auto scope = InstrumentedScope(block, "DecodeResult",
+                                       "fast_ber::instrument_decode(*this, \"" + name + "\", input, body_)");
         block.add_line("if (!input.is_valid())");
         {
             auto scope2 = CodeScope(block);
             block.add_line(R"(FAST_BER_ERROR("Invalid packet when decoding collection [)" + name + R"(]");)");
-            block.add_line("return DecodeResult{false};");
+            block.add_line(R"(return fast_ber::decode_error(DecodeError::invalid_packet, ")" + name + R"(");)");
         }
         block.add_line("if (!has_correct_header(input, Identifier_{}, Construction::constructed))");
         {
@@ -265,7 +584,7 @@ CodeBlock create_collection_decode_functions(const std::string& name, const Coll
             block.add_line(
                 R"(FAST_BER_ERROR("Invalid identifier [", input.identifier(), "] when decoding collection [)" + name +
                 R"(]");)");
-            block.add_line("return DecodeResult{false};");
+            block.add_line(R"(return fast_ber::decode_error(DecodeError::invalid_header, ")" + name + R"(");)");
         }
 
         if (collection.components.size() > 0)
@@ -280,107 +599,50 @@ CodeBlock create_collection_decode_functions(const std::string& name, const Coll
                 block.add_line("                                             : input.begin()->end();");
                 block.add_line();
 
+                std::vector<NamedType> members;
+                for (const ComponentType& component : collection.components)
+                {
+                    members.push_back(component.named_type);
+                }
+                const IndexedIdentifiers member_identifiers = indexed_identifiers(members, module, tree);
+
                 block.add_line("std::array<std::size_t, " + std::to_string(collection.components.size()) +
                                "> decode_counts = {};");
+                block.add_line("static constexpr fast_ber::IdentifierTable<" +
+                               std::to_string(member_identifiers.size()) + "> members(" +
+                               identifier_entries(member_identifiers) + ");");
                 block.add_line("while (iterator != end)");
                 {
                     auto scope2 = CodeScope(block);
-                    if (module.tagging_default == TaggingMode::automatic)
-                    {
-                        block.add_line("if (iterator->class_() == " + to_string(Class::context_specific) + ")");
-                        auto scope3 = CodeScope(block);
-                        {
-                            block.add_line("switch (iterator->tag())");
-                            auto        scope4 = CodeScope(block);
-                            std::size_t i      = 0;
-                            for (const ComponentType& component : collection.components)
-                            {
-                                block.add_line("case " + std::to_string(i) + ":");
-                                block.add_line("res = this->" + component.named_type.name + "." +
-                                               make_component_function("decode", component.named_type, module, tree) +
-                                               "(*iterator);");
-                                block.add_line("if (!res.success)");
-                                {
-                                    auto scope5 = CodeScope(block);
-                                    {
-                                        block.add_line(R"(FAST_BER_ERROR("failed to decode member [)" +
-                                                       component.named_type.name + R"(] of collection [)" + name +
-                                                       R"(]");)");
-                                        block.add_line("return res;");
-                                    }
-                                }
-                                block.add_line("++decode_counts[" + std::to_string(i) + "];");
-                                block.add_line("++iterator;");
-                                block.add_line("continue;");
-                                i++;
-                            }
-                        }
-                    }
-                    else
+                    block.add_line("switch (members.find(*iterator))");
                     {
-                        for (Class class_ : {
-                                 Class::universal,
-                                 Class::application,
-                                 Class::context_specific,
-                                 Class::private_,
-                             })
+                        auto        scope3 = CodeScope(block);
+                        std::size_t i      = 0;
+                        for (const ComponentType& component : collection.components)
                         {
-                            if (std::any_of(collection.components.begin(), collection.components.end(),
-                                            [&](const ComponentType& component) {
-                                                const std::vector<Identifier>& outer_ids =
-                                                    outer_identifiers(component.named_type.type, module, tree);
-                                                return std::any_of(
-                                                    outer_ids.begin(), outer_ids.end(),
-                                                    [class_](const Identifier& id) { return id.class_ == class_; });
-                                            }))
+                            block.add_line("case " + std::to_string(i) + ":");
+                            block.add_line("res = this->" + component.named_type.name + "." +
+                                           make_component_function("decode", component.named_type, module, tree) +
+                                           "(*iterator);");
+                            block.add_line("if (!res.success)");
                             {
-
-                                block.add_line("if (iterator->class_() == " + to_string(class_) + ")");
-                                auto scope3 = CodeScope(block);
-                                {
-                                    block.add_line("switch (iterator->tag())");
-                                    auto        scope4 = CodeScope(block);
-                                    std::size_t i      = 0;
-                                    for (const ComponentType& component : collection.components)
-                                    {
-                                        const std::vector<Identifier>& ids =
-                                            outer_identifiers(component.named_type.type, module, tree);
-                                        for (const Identifier& id : ids)
-                                        {
-                                            if (id.class_ == class_)
-                                            {
-                                                block.add_line("case " + std::to_string(id.tag_number) + ":");
-                                                block.add_line("res = this->" + component.named_type.name + "." +
-                                                               make_component_function("decode", component.named_type,
-                                                                                       module, tree) +
-                                                               "(*iterator);");
-
-                                                block.add_line("if (!res.success)");
-                                                {
-                                                    auto scope5 = CodeScope(block);
-                                                    {
-                                                        block.add_line(R"(FAST_BER_ERROR("failed to decode member [)" +
-                                                                       component.named_type.name +
-                                                                       R"(] of collection [)" + name + R"(]");)");
-                                                        block.add_line("return res;");
-                                                    }
-                                                }
-                                                block.add_line("++decode_counts[" + std::to_string(i) + "];");
-                                                block.add_line("++iterator;");
-                                                block.add_line("continue;");
-                                            }
-                                        }
-                                        i++;
-                                    }
-                                }
+                                auto scope4 = CodeScope(block);
+                                block.add_line(R"(FAST_BER_ERROR("failed to decode member [)" +
+                                               component.named_type.name + R"(] of collection [)" + name + R"(]");)");
+                                block.add_line(member_decode_error(component));
                             }
+                            block.add_line("++decode_counts[" + std::to_string(i) + "];");
+                            block.add_line("++iterator;");
+                            block.add_line("continue;");
+                            i++;
                         }
                     }
                     if (!collection.allow_extensions)
                     {
                         block.add_line(R"(FAST_BER_ERROR("Invalid ID when decoding set [)" + name +
                                        R"(] [", iterator->identifier(), "]");)");
-                        block.add_line("return fast_ber::DecodeResult{false};");
+                        block.add_line(R"(return fast_ber::decode_error(DecodeError::unknown_member, ")" + name +
+                                       R"(", fast_ber::offset_within(input, *iterator));)");
                     }
                     else
                     {
@@ -407,7 +669,8 @@ CodeBlock create_collection_decode_functions(const std::string& name, const Coll
                         {
                             block.add_line(R"(FAST_BER_ERROR("Missing non-optional member [)" +
                                            component.named_type.name + R"(] of set [)" + name + R"(]");)");
-                            block.add_line("return fast_ber::DecodeResult{false};");
+                            block.add_line(R"(return fast_ber::decode_error(DecodeError::missing_member, ")" + name +
+                                           "." + component.named_type.name + R"(");)");
                         }
                     }
                     block.add_line("if (decode_counts[" + std::to_string(i) + "] > 1)");
@@ -415,39 +678,38 @@ CodeBlock create_collection_decode_functions(const std::string& name, const Coll
                         auto scope3 = CodeScope(block);
                         block.add_line(R"(FAST_BER_ERROR("Member [)" + component.named_type.name +
                                        R"(] present multiple times in set [)" + name + R"(]");)");
-                        block.add_line("return fast_ber::DecodeResult{false};");
+                        block.add_line(R"(return fast_ber::decode_error(DecodeError::duplicate_member, ")" + name +
+                                       "." + component.named_type.name + R"(");)");
                     }
                     i++;
                 }
             }
             else
             {
-                std::unique_ptr<std::vector<Identifier>> ids;
-                if (module.tagging_default == TaggingMode::automatic) {
-                    ids = std::make_unique<std::vector<Identifier>>();
-                    for (const ComponentType& component : collection.components)
-                    {
-                        auto tmp = outer_identifiers(component.named_type.type, module, tree);
-                        std::copy(tmp.begin(), tmp.end(), std::back_inserter(*ids));
-                    }
-                }
-
                 int i = 0;
                 for (const ComponentType& component : collection.components)
                 {
                     if (component.is_optional || component.default_value)
                     {
-                        if (module.tagging_default != TaggingMode::automatic) {
-                            ids = std::make_unique<std::vector<Identifier>>(outer_identifiers(component.named_type.type, module, tree));
+                        // With automatic tagging each member is identified by its position
+                        IndexedIdentifiers optional_identifiers;
+                        if (module.tagging_default == TaggingMode::automatic)
+                        {
+                            optional_identifiers.emplace_back(
+                                Identifier(Class::context_specific, static_cast<int64_t>(i)), 0);
                         }
-
-                        std::string id_check = "if (iterator->is_valid() && (false ";
-                        for (const Identifier& id : *ids)
+                        else
                         {
-                            id_check += " || " + id.name() + "::check_id_match(iterator->class_(), iterator->tag())";
+                            for (const Identifier& id : outer_identifiers(component.named_type.type, module, tree))
+                            {
+                                optional_identifiers.emplace_back(id, 0);
+                            }
                         }
-                        id_check += "))";
-                        block.add_line(id_check);
+                        const std::string set_name = "ids_" + component.named_type.name;
+                        block.add_line("static constexpr fast_ber::IdentifierSet<" +
+                                       std::to_string(optional_identifiers.size()) + "> " + set_name + "(" +
+                                       identifier_entries(optional_identifiers) + ");");
+                        block.add_line("if (" + set_name + ".contains(*iterator))");
 
                         {
                             auto scope2    = CodeScope(block);
@@ -476,7 +738,7 @@ CodeBlock create_collection_decode_functions(const std::string& name, const Coll
                                                    component.named_type.name + R"(] of collection [)" + name +
                                                    R"(]");)");
 
-                                    block.add_line("return res;");
+                                    block.add_line(member_decode_error(component));
                                 }
                             }
                             block.add_line("++iterator;");
@@ -519,7 +781,7 @@ CodeBlock create_collection_decode_functions(const std::string& name, const Coll
                             auto scope2 = CodeScope(block);
                             block.add_line(R"(FAST_BER_ERROR("failed to decode member [)" + component.named_type.name +
                                            R"(] of collection [)" + name + R"(]");)");
-                            block.add_line("return res;");
+                            block.add_line(member_decode_error(component));
                         }
                         block.add_line("++iterator;");
                     }
@@ -541,24 +803,32 @@ CodeBlock create_choice_decode_functions(const std::string& name, const ChoiceTy
     block.add_line(create_template_definition({"Identifier"}));
     block.add_line("inline DecodeResult " + name + "::decode_with_id(BerView input) noexcept");
     {
-        auto scope1 = CodeScope(block);
-        block.add_line("BerView content(input);");
+        auto scope1 = InstrumentedScope(block, "DecodeResult",
+                                        "fast_ber::instrument_decode(*this, \"" + name + "\", input, body_)");
+        block.add_line("BerView      content(input);");
+        block.add_line("DecodeResult res;");
+
+        auto add_alternative_result = [&](const NamedType& alternative) {
+            block.add_line(R"(	return res.success ? res : fast_ber::member_decode_error(res, input, content, ")" +
+                           name + "." + alternative.name + R"(");)");
+        };
+
+        block.add_line("if (!input.is_valid())");
+        {
+            auto scope2 = CodeScope(block);
+            block.add_line(R"(FAST_BER_ERROR("Invalid packet when decoding choice [)" + name + R"(]");)");
+            block.add_line(R"(return fast_ber::decode_error(DecodeError::invalid_packet, ")" + name + R"(");)");
+        }
         block.add_line("if (!IsChoiceId<Identifier>::value)");
         {
             auto scope2 = CodeScope(block);
-            block.add_line("if (!input.is_valid())");
-            {
-                auto scope3 = CodeScope(block);
-                block.add_line(R"(FAST_BER_ERROR("Invalid packet when decoding choice [)" + name + R"(]");)");
-                block.add_line("return DecodeResult{false};");
-            }
             block.add_line("if (!has_correct_header(input, Identifier{}, Construction::constructed))");
             {
                 auto scope3 = CodeScope(block);
                 block.add_line(
                     R"(FAST_BER_ERROR("Invalid header when decoding choice type [", input.identifier(), "] in choice [)" +
                     name + R"(]");)");
-                block.add_line("return DecodeResult{false};");
+                block.add_line(R"(return fast_ber::decode_error(DecodeError::invalid_header, ")" + name + R"(");)");
             }
 
             block.add_line(
@@ -567,77 +837,46 @@ CodeBlock create_choice_decode_functions(const std::string& name, const ChoiceTy
             {
                 auto scope3 = CodeScope(block);
                 block.add_line(R"(FAST_BER_ERROR("Invalid child packet when decoding choice [)" + name + R"(]");)");
-
-                block.add_line("return DecodeResult{false};");
+                block.add_line(R"(return fast_ber::decode_error(DecodeError::invalid_packet, ")" + name +
+                               R"(", fast_ber::offset_within(input, *child));)");
             }
             block.add_line("content = *child;");
         }
 
-        if (module.tagging_default == TaggingMode::automatic)
+        const IndexedIdentifiers alternative_identifiers = indexed_identifiers(choice.choices, module, tree);
+        block.add_line("static constexpr fast_ber::IdentifierTable<" +
+                       std::to_string(alternative_identifiers.size()) + "> alternatives(" +
+                       identifier_entries(alternative_identifiers) + ");");
+        block.add_line("switch (alternatives.find(content))");
         {
-            block.add_line("switch (content.tag())");
+            auto scope2 = CodeScope(block);
+            for (std::size_t i = 0; i < choice.choices.size(); i++)
             {
-                auto scope2 = CodeScope(block);
-                for (std::size_t i = 0; i < choice.choices.size(); i++)
-                {
-                    block.add_line("case " + std::to_string(i) + ":");
+                block.add_line("case " + std::to_string(i) + ":");
 
-                    auto valueType = std::get_if<DefinedType>(&choice.choices[i].type);
-                    if (module.tagging_default == TaggingMode::automatic && valueType &&
-                        (isAssignementOfType<SequenceType>(tree, *valueType) ||
-                         isAssignementOfType<ChoiceType>(tree, *valueType)))
-                    {
-                        block.add_line("	return this->template emplace<" + std::to_string(i) + ">()." +
-                                       make_component_function("decode_with_id<Id<Class::context_specific, " +
-                                                                   std::to_string(0) + ">>",
-                                                               choice.choices[i], module, tree) +
-                                       "(content);");
-                    }
-                    else
-                    {
-                        block.add_line("	return this->template emplace<" + std::to_string(i) + ">()." +
-                                       make_component_function("decode", choice.choices[i], module, tree) +
-                                       "(content);");
-                    }
+                auto valueType = std::get_if<DefinedType>(&choice.choices[i].type);
+                if (module.tagging_default == TaggingMode::automatic && valueType &&
+                    (isAssignementOfType<SequenceType>(tree, *valueType) ||
+                     isAssignementOfType<ChoiceType>(tree, *valueType)))
+                {
+                    block.add_line("	res = this->template emplace_or_reuse<" + std::to_string(i) + ">()." +
+                                   make_component_function("decode_with_id<Id<Class::context_specific, " +
+                                                               std::to_string(0) + ">>",
+                                                           choice.choices[i], module, tree) +
+                                   "(content);");
                 }
-            }
-        }
-        else
-        {
-            for (Class class_ : {
-                     Class::universal,
-                     Class::application,
-                     Class::context_specific,
-                     Class::private_,
-                 })
-            {
-                const std::vector<Identifier>& outer_ids = outer_identifiers(choice, module, tree);
-                if (std::any_of(outer_ids.begin(), outer_ids.end(),
-                                [class_](const Identifier& id) { return id.class_ == class_; }))
+                else
                 {
-                    block.add_line("switch (content.tag())");
-                    auto        scope2 = CodeScope(block);
-                    std::size_t i      = 0;
-                    for (const NamedType& named_type : choice.choices)
-                    {
-                        const std::vector<Identifier>& ids = outer_identifiers(named_type.type, module, tree);
-                        for (const Identifier& id : ids)
-                        {
-                            if (id.class_ == class_)
-                            {
-                                block.add_line("case " + std::to_string(id.tag_number) + ":");
-                                block.add_line("	return this->template emplace<" + std::to_string(i) + ">()." +
-                                               make_component_function("decode", choice.choices[i], module, tree) +
-                                               "(content);");
-                            }
-                        }
-                        i++;
-                    }
+                    block.add_line("	res = this->template emplace_or_reuse<" + std::to_string(i) + ">()." +
+                                   make_component_function("decode", choice.choices[i], module, tree) +
+                                   "(content);");
                 }
+                add_alternative_result(choice.choices[i]);
             }
         }
         block.add_line(R"(FAST_BER_ERROR("Unknown tag [", content.identifier(), "] in choice [)" + name + R"(]");)");
-        block.add_line("return DecodeResult{false};");
+        block.add_line(R"(return fast_ber::decode_error(DecodeError::unknown_alternative, ")" + name +
+                       R"(", fast_ber::offset_within(input, content));)");
     }
 
     block.add_line();
@@ -705,3 +944,317 @@ std::string create_decode_functions(const Assignment& assignment, const Module&
 
     return "";
 }
+
+// Identifier a member is encoded with, views only use it to remove explicit tags
+std::string view_member_identifier(const std::string& type_name, std::size_t automatic_tag, const NamedType& component,
+                                   const Module& module, const Asn1Tree& tree)
+{
+    auto valueType = std::get_if<DefinedType>(&component.type);
+    if (module.tagging_default == TaggingMode::automatic && valueType &&
+        (isAssignementOfType<SequenceType>(tree, *valueType) || isAssignementOfType<ChoiceType>(tree, *valueType)))
+    {
+        return "Id<Class::context_specific, " + std::to_string(automatic_tag) + ">";
+    }
+    if (is_generated(resolve_type(tree, module.module_reference, component).type))
+    {
+        auto id = identifier(component.type, module, tree);
+        if (!id.is_default_tagged)
+        {
+            return id.name();
+        }
+    }
+    return "::fast_ber::Identifier<" + type_name + ">";
+}
+
+std::string unqualified_name(const std::string& name)
+{
+    const std::size_t separator = name.rfind("::");
+    return separator == std::string::npos ? name : name.substr(separator + 2);
+}
+
+template <typename CollectionType>
+CodeBlock create_collection_view_definition(const std::string& name, const CollectionType& collection, const Module&,
+                                            const Asn1Tree&)
+{
+    const std::string type_name = unqualified_name(name);
+    const bool        ordered   = std::is_same<CollectionType, SequenceType>::value;
+
+    CodeBlock block;
+    block.add_line("struct " + name + "::View");
+    {
+        auto scope1 = CodeScope(block, true);
+        block.add_line("View() noexcept = default;");
+        block.add_line("explicit View(::fast_ber::BerView input) noexcept : m_members(input) {}");
+        block.add_line();
+        block.add_line("bool is_valid() const noexcept { return m_members.packet().is_valid(); }");
+        block.add_line("const ::fast_ber::BerView& packet() const noexcept { return m_members.packet(); }");
+        block.add_line();
+        for (const ComponentType& component : collection.components)
+        {
+            const std::string member_type = make_type_name(component.named_type.name, type_name);
+            if (component.is_optional || component.default_value)
+            {
+                block.add_line("std::optional<::fast_ber::ViewType<" + member_type + ">> " +
+                               component.named_type.name + "() const noexcept;");
+            }
+            else
+            {
+                block.add_line("::fast_ber::ViewType<" + member_type + "> " + component.named_type.name +
+                               "() const noexcept;");
+            }
+        }
+        block.add_line();
+        block.add_line("private:");
+        block.add_line("static bool matches(std::size_t member, ::fast_ber::Class class_, ::fast_ber::Tag tag) noexcept;");
+        block.add_line();
+        block.add_line("::fast_ber::LazyMembers<" + std::to_string(collection.components.size()) + ", " +
+                       (ordered ? "true" : "false") + "> m_members;");
+    }
+    block.add_line();
+    return block;
+}
+
+template <typename CollectionType>
+CodeBlock create_collection_view_functions(const std::string& name, const CollectionType& collection,
+                                           const Module& module, const Asn1Tree& tree)
+{
+    const std::string type_name = unqualified_name(name);
+    const bool        ordered   = std::is_same<CollectionType, SequenceType>::value;
+
+    CodeBlock block;
+    std::size_t i = 0;
+    for (const ComponentType& component : collection.components)
+    {
+        const std::string member_type = make_type_name(component.named_type.name, type_name);
+        const std::string make_view   = "::fast_ber::make_view<" + member_type + ", " +
+                                      view_member_identifier(member_type, i, component.named_type, module, tree) +
+                                      ">";
+        if (component.is_optional || component.default_value)
+        {
+            // Absent members are returned as empty, the default value of a DEFAULT member then applies
+            block.add_line("inline auto " + name + "::View::" + component.named_type.name +
+                           "() const noexcept -> std::optional<::fast_ber::ViewType<" + member_type + ">>");
+            auto scope1 = CodeScope(block);
+            block.add_line("const ::fast_ber::BerView member = m_members.find(" + std::to_string(i) + ", &matches);");
+            block.add_line("if (!member.is_valid())");
+            {
+                auto scope2 = CodeScope(block);
+                block.add_line("return std::nullopt;");
+            }
+            block.add_line("return " + make_view + "(member);");
+        }
+        else
+        {
+            block.add_line("inline auto " + name + "::View::" + component.named_type.name +
+                           "() const noexcept -> ::fast_ber::ViewType<" + member_type + ">");
+            auto scope1 = CodeScope(block);
+            block.add_line("return " + make_view + "(m_members.find(" + std::to_string(i) + ", &matches));");
+        }
+        block.add_line();
+        i++;
+    }
+
+    // Members of a SEQUENCE are matched in order, only optional members are checked against their identifiers, as in
+    // the generated decode function
+    block.add_line("inline bool " + name +
+                   "::View::matches(std::size_t member, ::fast_ber::Class class_, ::fast_ber::Tag tag) noexcept");
+    {
+        CodeBlock cases;
+        i = 0;
+        for (const ComponentType& component : collection.components)
+        {
+            if (!ordered || component.is_optional || component.default_value)
+            {
+                // With automatic tagging each member is identified by its position
+                const std::vector<Identifier> ids =
+                    module.tagging_default == TaggingMode::automatic
+                        ? std::vector<Identifier>{Identifier(Class::context_specific, static_cast<int64_t>(i))}
+                        : outer_identifiers(component.named_type.type, module, tree);
+                std::string id_check = "return false";
+                for (const Identifier& id : ids)
+                {
+                    id_check += " || " + id.name() + "::check_id_match(class_, tag)";
+                }
+                cases.add_line("case " + std::to_string(i) + ":");
+                cases.add_line("    " + id_check + ";");
+            }
+            i++;
+        }
+
+        auto scope1 = CodeScope(block);
+        if (cases.to_string().empty())
+        {
+            block.add_line("(void)member;");
+            block.add_line("(void)class_;");
+            block.add_line("(void)tag;");
+            block.add_line(std::string("return ") + (ordered ? "true" : "false") + ";");
+        }
+        else
+        {
+            block.add_line("switch (member)");
+            auto scope2 = CodeScope(block);
+            block.add_block(cases);
+            block.add_line("default:");
+            block.add_line(std::string("    return ") + (ordered ? "true" : "false") + ";");
+        }
+    }
+    block.add_line();
+    return block;
+}
+
+CodeBlock create_choice_view_definition(const std::string& name, const ChoiceType& choice, const Module&,
+                                        const Asn1Tree&)
+{
+    CodeBlock block;
+    block.add_line("struct " + name + "::View");
+    {
+        auto scope1 = CodeScope(block, true);
+        block.add_line("View() noexcept = default;");
+        block.add_line("explicit View(::fast_ber::BerView alternative) noexcept : m_alternative(alternative) {}");
+        block.add_line();
+        block.add_line("bool is_valid() const noexcept { return m_alternative.is_valid(); }");
+        block.add_line("const ::fast_ber::BerView& packet() const noexcept { return m_alternative; }");
+        block.add_line("// Index of the selected alternative, equal to the number of alternatives if not recognised");
+        block.add_line("std::size_t index() const noexcept;");
+        block.add_line();
+        for (const NamedType& named_type : choice.choices)
+        {
+            block.add_line("std::optional<::fast_ber::ViewType<" + make_type_name(named_type.name) + ">> " +
+                           named_type.name + "() const noexcept;");
+        }
+        block.add_line();
+        block.add_line("private:");
+        block.add_line("::fast_ber::BerView m_alternative;");
+    }
+    block.add_line();
+    return block;
+}
+
+CodeBlock create_choice_view_functions(const std::string& name, const ChoiceType& choice, const Module& module,
+                                       const Asn1Tree& tree)
+{
+    const std::string count = std::to_string(choice.choices.size());
+
+    CodeBlock block;
+    block.add_line("inline std::size_t " + name + "::View::index() const noexcept");
+    {
+        auto scope1 = CodeScope(block);
+        block.add_line("if (!m_alternative.is_valid())");
+        {
+            auto scope2 = CodeScope(block);
+            block.add_line("return " + count + ";");
+        }
+        if (module.tagging_default == TaggingMode::automatic)
+        {
+            // Alternatives are numbered by their context specific tags, as in the identifier table of decode
+            block.add_line("if (m_alternative.class_() != ::fast_ber::Class::context_specific || m_alternative.tag() >= " +
+                           count + ")");
+            {
+                auto scope2 = CodeScope(block);
+                block.add_line("return " + count + ";");
+            }
+            block.add_line("return static_cast<std::size_t>(m_alternative.tag());");
+        }
+        else
+        {
+            std::size_t i = 0;
+            for (const NamedType& named_type : choice.choices)
+            {
+                for (const Identifier& id : outer_identifiers(named_type.type, module, tree))
+                {
+                    block.add_line("if (" + id.name() + "::check_id_match(m_alternative.class_(), m_alternative.tag()))");
+                    {
+                        auto scope2 = CodeScope(block);
+                        block.add_line("return " + std::to_string(i) + ";");
+                    }
+                }
+                i++;
+            }
+            block.add_line("return " + count + ";");
+        }
+    }
+    block.add_line();
+
+    std::size_t i = 0;
+    for (const NamedType& named_type : choice.choices)
+    {
+        const std::string member_type = make_type_name(named_type.name);
+        block.add_line("inline auto " + name + "::View::" + named_type.name +
+                       "() const noexcept -> std::optional<::fast_ber::ViewType<" + member_type + ">>");
+        {
+            auto scope1 = CodeScope(block);
+            block.add_line("if (index() != " + std::to_string(i) + ")");
+            {
+                auto scope2 = CodeScope(block);
+                block.add_line("return std::nullopt;");
+            }
+            block.add_line("return ::fast_ber::make_view<" + member_type + ", " +
+                           view_member_identifier(member_type, i, named_type, module, tree) + ">(m_alternative);");
+        }
+        block.add_line();
+        i++;
+    }
+    return block;
+}
+
+CodeBlock create_view_definitions_impl(const Asn1Tree& tree, const Module& module, const Type& type,
+                                       const std::string& name)
+{
+    if (is_sequence(type))
+    {
+        const SequenceType& sequence = std::get<SequenceType>(std::get<BuiltinType>(type));
+        return create_collection_view_definition(name, sequence, module, tree);
+    }
+    else if (is_set(type))
+    {
+        const SetType& set = std::get<SetType>(std::get<BuiltinType>(type));
+        return create_collection_view_definition(name, set, module, tree);
+    }
+    else if (is_choice(type))
+    {
+        const ChoiceType& choice = std::get<ChoiceType>(std::get<BuiltinType>(type));
+        return create_choice_view_definition(name, choice, module, tree);
+    }
+    return {};
+}
+
+CodeBlock create_view_functions_impl(const Asn1Tree& tree, const Module& module, const Type& type,
+                                     const std::string& name)
+{
+    if (is_sequence(type))
+    {
+        const SequenceType& sequence = std::get<SequenceType>(std::get<BuiltinType>(type));
+        return create_collection_view_functions(name, sequence, module, tree);
+    }
+    else if (is_set(type))
+    {
+        const SetType& set = std::get<SetType>(std::get<BuiltinType>(type));
+        return create_collection_view_functions(name, set, module, tree);
+    }
+    else if (is_choice(type))
+    {
+        const ChoiceType& choice = std::get<ChoiceType>(std::get<BuiltinType>(type));
+        return create_choice_view_functions(name, choice, module, tree);
+    }
+    return {};
+}
+
+std::string create_view_definitions(const Assignment& assignment, const Module& module, const Asn1Tree& tree)
+{
+    if (std::holds_alternative<TypeAssignment>(assignment.specific))
+    {
+        return visit_all_types(tree, module, assignment, create_view_definitions_impl).to_string();
+    }
+
+    return "";
+}
+
+std::string create_view_functions(const Assignment& assignment, const Module& module, const Asn1Tree& tree)
+{
+    if (std::holds_alternative<TypeAssignment>(assignment.specific))
+    {
+        return visit_all_types(tree, module, assignment, create_view_functions_impl).to_string();
+    }
+
+    return "";
+}
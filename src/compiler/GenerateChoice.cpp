@@ -6,7 +6,8 @@
 #include "fast_ber/compiler/Visit.hpp"
 
 CodeBlock create_choice_definition(const ChoiceType& choice, const Module& module, const Asn1Tree& tree,
-                                   const std::string& name, const std::string& identifier_override)
+                                   const std::string& name, const std::string& identifier_override,
+                                   const TypeStorage& type_storage)
 {
     bool        is_first = true;
     std::string type_list;
@@ -35,12 +36,12 @@ CodeBlock create_choice_definition(const ChoiceType& choice, const Module& modul
             {
                 std::string choice_id = Identifier(Class::context_specific, tag_counter++).name();
                 block.add_block(create_type_assignment(make_type_name(named_type.name), named_type.type, module, tree,
-                                                       choice_id, false));
+                                                       choice_id, false, type_storage));
             }
             else
             {
-                block.add_block(
-                    create_type_assignment(make_type_name(named_type.name), named_type.type, module, tree, {}, false));
+                block.add_block(create_type_assignment(make_type_name(named_type.name), named_type.type, module, tree,
+                                                       {}, false, type_storage));
             }
         }
         block.add_line("using Storage = " + storage + ';');
@@ -124,6 +125,14 @@ CodeBlock create_choice_definition(const ChoiceType& choice, const Module& modul
                 block.add_line("return m_storage.emplace<i>(std::forward<Args>(args)...);");
             }
         }
+        block.add_line("template <std::size_t i>");
+        block.add_line("ToType<i>& emplace_or_reuse()");
+        {
+            CodeScope scope2(block);
+            {
+                block.add_line("return m_storage.template emplace_or_reuse<i>();");
+            }
+        }
         block.add_line();
 
         // Index
@@ -135,6 +144,12 @@ CodeBlock create_choice_definition(const ChoiceType& choice, const Module& modul
         block.add_line(create_template_definition({"Identifier"}));
         block.add_line("EncodeResult encode_with_id(std::span<uint8_t> output) const noexcept;");
         block.add_line(create_template_definition({"Identifier"}));
+        block.add_line("EncodeResult encode_reverse_with_id(std::span<uint8_t> output) const noexcept;");
+        block.add_line(create_template_definition({"Identifier"}));
+        block.add_line("EncodeResult encode_indefinite_with_id(std::span<uint8_t> output) const noexcept;");
+        block.add_line(create_template_definition({"Identifier"}));
+        block.add_line("EncodeResult encode_gather_with_id(GatherBuffer& output) const noexcept;");
+        block.add_line(create_template_definition({"Identifier"}));
         block.add_line("DecodeResult decode_with_id(BerView output) noexcept;");
         block.add_line();
 
@@ -142,12 +157,19 @@ CodeBlock create_choice_definition(const ChoiceType& choice, const Module& modul
         block.add_line("{ return encoded_length_with_id<" + id + ">(); }");
         block.add_line("EncodeResult encode(std::span<uint8_t> output) const noexcept");
         block.add_line("{ return encode_with_id<" + id + ">(output); }");
+        block.add_line("EncodeResult encode_reverse(std::span<uint8_t> output) const noexcept");
+        block.add_line("{ return encode_reverse_with_id<" + id + ">(output); }");
+        block.add_line("EncodeResult encode_indefinite(std::span<uint8_t> output) const noexcept");
+        block.add_line("{ return encode_indefinite_with_id<" + id + ">(output); }");
+        block.add_line("EncodeResult encode_gather(GatherBuffer& output) const noexcept");
+        block.add_line("{ return encode_gather_with_id<" + id + ">(output); }");
         block.add_line("DecodeResult decode(BerView input) noexcept");
         block.add_line("{ return decode_with_id<" + id + ">(input); }");
         block.add_line();
 
         // ID
         block.add_line("using AsnId = " + id + ";");
+        block.add_line("struct View;");
         block.add_line();
 
         // Impl Helper
@@ -0,0 +1,288 @@
+#include "fast_ber/compiler/GenerateRandom.hpp"
+
+#include "fast_ber/compiler/ResolveType.hpp"
+#include "fast_ber/compiler/Visit.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+
+// Name by which a type is configured in a RandomProfile, e.g. "Record.Nested" for fast_ber::Module::Record::Nested
+std::string random_profile_name(const Module& module, const std::string& name)
+{
+    const std::string prefix = "fast_ber::" + module.module_reference + "::";
+    size_t            begin  = name.compare(0, prefix.size(), prefix) == 0 ? prefix.size() : 0;
+
+    std::string result;
+    for (size_t separator = name.find("::", begin); separator != std::string::npos; separator = name.find("::", begin))
+    {
+        result.append(name, begin, separator - begin);
+        result += '.';
+        begin = separator + 2;
+    }
+    result.append(name, begin);
+    return result;
+}
+
+void add_random_signature(CodeBlock& block, const std::string& name)
+{
+    block.add_line("template <typename Rng>");
+    block.add_line("void generate_random(" + name + "& object, Rng& rng, const fast_ber::RandomProfile& profile)");
+}
+
+template <typename CollectionType>
+CodeBlock create_collection_random(const CollectionType& collection, const Module& module, const std::string& name)
+{
+    CodeBlock block;
+    add_random_signature(block, name);
+    {
+        CodeScope scope(block);
+        block.add_line("fast_ber::RandomNesting nesting;");
+        if (collection.components.empty())
+        {
+            block.add_line("(void)object;");
+            block.add_line("(void)rng;");
+            block.add_line("(void)profile;");
+        }
+
+        for (const ComponentType& component : collection.components)
+        {
+            const std::string& member = component.named_type.name;
+            if (component.is_optional)
+            {
+                block.add_line("if (fast_ber::random_presence(rng, profile, \"" +
+                               random_profile_name(module, name) + "." + member + "\"))");
+                {
+                    CodeScope scope2(block);
+                    block.add_line("generate_random(object." + member + ".emplace(), rng, profile);");
+                }
+                block.add_line("else");
+                {
+                    CodeScope scope2(block);
+                    block.add_line("object." + member + " = fast_ber::empty;");
+                }
+            }
+            else
+            {
+                block.add_line("generate_random(object." + member + ", rng, profile);");
+            }
+        }
+    }
+    block.add_line();
+    return block;
+}
+
+constexpr size_t unbounded_random_depth = std::numeric_limits<size_t>::max();
+
+size_t random_depth(const Asn1Tree& tree, const Module& module, const Type& type, const RandomDepths& depths);
+
+template <typename CollectionType>
+size_t random_collection_depth(const Asn1Tree& tree, const Module& module, const CollectionType& collection,
+                               const RandomDepths& depths)
+{
+    size_t depth = 0;
+    for (const ComponentType& component : collection.components)
+    {
+        if (!component.is_optional)
+        {
+            depth = std::max(depth, random_depth(tree, module, component.named_type.type, depths));
+        }
+    }
+    return depth == unbounded_random_depth ? depth : depth + 1;
+}
+
+size_t random_depth(const Asn1Tree& tree, const Module& module, const Type& type, const RandomDepths& depths)
+{
+    if (is_defined(type))
+    {
+        const DefinedType& defined          = std::get<DefinedType>(type);
+        std::string        module_reference = defined.module_reference.value_or(module.module_reference);
+        if (!defined.module_reference && !exists(tree, module, defined.type_reference))
+        {
+            for (const Import& import : module.imports)
+            {
+                if (std::find(import.imported_types.begin(), import.imported_types.end(), defined.type_reference) !=
+                    import.imported_types.end())
+                {
+                    module_reference = import.module_reference;
+                }
+            }
+        }
+
+        // Parameters and references outside of the tree are taken to be finite
+        const auto found = depths.find(module_reference + "." + defined.type_reference);
+        return found == depths.end() ? 0 : found->second;
+    }
+    if (is_sequence(type))
+    {
+        return random_collection_depth(tree, module, std::get<SequenceType>(std::get<BuiltinType>(type)), depths);
+    }
+    if (is_set(type))
+    {
+        return random_collection_depth(tree, module, std::get<SetType>(std::get<BuiltinType>(type)), depths);
+    }
+    if (is_choice(type))
+    {
+        size_t depth = unbounded_random_depth;
+        for (const NamedType& named_type : std::get<ChoiceType>(std::get<BuiltinType>(type)).choices)
+        {
+            depth = std::min(depth, random_depth(tree, module, named_type.type, depths));
+        }
+        return depth == unbounded_random_depth ? depth : depth + 1;
+    }
+    if (is_prefixed(type))
+    {
+        return random_depth(tree, module, std::get<PrefixedType>(std::get<BuiltinType>(type)).tagged_type->type,
+                            depths);
+    }
+    return 0;
+}
+
+// Depths only decrease between passes, so repeating them until none changes finds the shortest value of every type.
+// Types left unbounded have no finite values
+RandomDepths random_depths(const Asn1Tree& tree)
+{
+    RandomDepths depths;
+    for (const Module& module : tree.modules)
+    {
+        for (const Assignment& assignment : module.assignments)
+        {
+            if (is_type(assignment))
+            {
+                depths[module.module_reference + "." + assignment.name] = unbounded_random_depth;
+            }
+        }
+    }
+
+    bool changed = true;
+    while (changed)
+    {
+        changed = false;
+        for (const Module& module : tree.modules)
+        {
+            for (const Assignment& assignment : module.assignments)
+            {
+                if (is_type(assignment))
+                {
+                    size_t&      depth   = depths[module.module_reference + "." + assignment.name];
+                    const size_t shorter = random_depth(tree, module, type(assignment), depths);
+                    if (shorter < depth)
+                    {
+                        depth   = shorter;
+                        changed = true;
+                    }
+                }
+            }
+        }
+    }
+    return depths;
+}
+
+size_t random_terminating_alternative(const Asn1Tree& tree, const Module& module, const ChoiceType& choice,
+                                      const RandomDepths& depths)
+{
+    size_t alternative = 0;
+    size_t shortest    = unbounded_random_depth;
+    for (size_t i = 0; i < choice.choices.size(); i++)
+    {
+        const size_t depth = random_depth(tree, module, choice.choices[i].type, depths);
+        if (depth < shortest)
+        {
+            alternative = i;
+            shortest    = depth;
+        }
+    }
+    return alternative;
+}
+
+CodeBlock create_choice_random(const Asn1Tree& tree, const ChoiceType& choice, const Module& module,
+                               const std::string& name, const RandomDepths& depths)
+{
+    CodeBlock block;
+    add_random_signature(block, name);
+    {
+        CodeScope scope(block);
+        block.add_line("fast_ber::RandomNesting nesting;");
+        block.add_line("switch (fast_ber::random_alternative(rng, profile, \"" + random_profile_name(module, name) +
+                       "\", " + std::to_string(choice.choices.size()) + ", " +
+                       std::to_string(random_terminating_alternative(tree, module, choice, depths)) + "))");
+        {
+            CodeScope scope2(block);
+            for (size_t i = 0; i < choice.choices.size(); i++)
+            {
+                const std::string index = std::to_string(i);
+                block.add_line((i + 1 < choice.choices.size() ? "case " + index + ":" : std::string("default:")));
+                block.add_line("    generate_random(object.template emplace<" + index + ">(), rng, profile);");
+                block.add_line("    break;");
+            }
+        }
+    }
+    block.add_line();
+    return block;
+}
+
+CodeBlock create_enumerated_random(const EnumeratedType& enumerated, const std::string& name)
+{
+    const std::string values_name = name + "Values";
+
+    CodeBlock block;
+    block.add_line("template <typename Rng>");
+    block.add_line("void generate_random(" + values_name + "& object, Rng& rng, const fast_ber::RandomProfile&)");
+    {
+        CodeScope scope(block);
+        if (enumerated.enum_values.empty())
+        {
+            block.add_line("(void)object;");
+            block.add_line("(void)rng;");
+        }
+        else
+        {
+            block.add_line("constexpr " + values_name + " values[] = {");
+            for (const EnumerationValue& enum_value : enumerated.enum_values)
+            {
+                block.add_line("    " + values_name + "::" + enum_value.name + ",");
+            }
+            block.add_line("};");
+            block.add_line("object = values[std::uniform_int_distribution<size_t>(0, " +
+                           std::to_string(enumerated.enum_values.size() - 1) + ")(rng)];");
+        }
+    }
+    block.add_line();
+    return block;
+}
+
+CodeBlock create_random_functions_impl(const Asn1Tree& tree, const Module& module, const Type& type,
+                                       const std::string& name, const RandomDepths& depths)
+{
+    if (is_sequence(type))
+    {
+        return create_collection_random(std::get<SequenceType>(std::get<BuiltinType>(type)), module, name);
+    }
+    else if (is_set(type))
+    {
+        return create_collection_random(std::get<SetType>(std::get<BuiltinType>(type)), module, name);
+    }
+    else if (is_choice(type))
+    {
+        return create_choice_random(tree, std::get<ChoiceType>(std::get<BuiltinType>(type)), module, name, depths);
+    }
+    else if (is_enumerated(type))
+    {
+        return create_enumerated_random(std::get<EnumeratedType>(std::get<BuiltinType>(type)), name);
+    }
+    return {};
+}
+
+std::string create_random_functions(const Asn1Tree& tree, const Module& module, const Assignment& assignment,
+                                    const RandomDepths& depths)
+{
+    if (!tree.generate_random)
+    {
+        return {};
+    }
+    const auto create = [&depths](const Asn1Tree& tree_, const Module& module_, const Type& type,
+                                  const std::string& name) {
+        return create_random_functions_impl(tree_, module_, type, name, depths);
+    };
+    return visit_all_types(tree, module, assignment, create).to_string();
+}
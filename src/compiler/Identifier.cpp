@@ -77,13 +77,11 @@ TaggingInfo identifier(const ChoiceType& choice, const Module& module, const Asn
 }
 TaggingInfo identifier(const DateType&, const Module&, const Asn1Tree&)
 {
-    assert("Not implemented");
-    return {};
+    return TaggingInfo{{}, Identifier(UniversalTag::date), {}, true};
 }
 TaggingInfo identifier(const DateTimeType&, const Module&, const Asn1Tree&)
 {
-    assert("Not implemented");
-    return {};
+    return TaggingInfo{{}, Identifier(UniversalTag::date_time), {}, true};
 }
 TaggingInfo identifier(const DurationType&, const Module&, const Asn1Tree&)
 {
@@ -205,8 +203,7 @@ TaggingInfo identifier(const TimeType&, const Module&, const Asn1Tree&)
 }
 TaggingInfo identifier(const TimeOfDayType&, const Module&, const Asn1Tree&)
 {
-    assert("Not implemented");
-    return {};
+    return TaggingInfo{{}, Identifier(UniversalTag::time_of_day), {}, true};
 }
 TaggingInfo identifier(const UTCTimeType&, const Module&, const Asn1Tree&)
 {
@@ -292,13 +289,11 @@ std::vector<Identifier> outer_identifiers(const ChoiceType& choice, const Module
 
 std::vector<Identifier> outer_identifiers(const DateType&, const Module&, const Asn1Tree&)
 {
-    assert("Not implemented");
-    return {};
+    return {Identifier(UniversalTag::date)};
 }
 std::vector<Identifier> outer_identifiers(const DateTimeType&, const Module&, const Asn1Tree&)
 {
-    assert("Not implemented");
-    return {};
+    return {Identifier(UniversalTag::date_time)};
 }
 std::vector<Identifier> outer_identifiers(const DurationType&, const Module&, const Asn1Tree&)
 {
@@ -401,8 +396,7 @@ std::vector<Identifier> outer_identifiers(const TimeType&, const Module&, const
 }
 std::vector<Identifier> outer_identifiers(const TimeOfDayType&, const Module&, const Asn1Tree&)
 {
-    assert("Not implemented");
-    return {};
+    return {Identifier(UniversalTag::time_of_day)};
 }
 std::vector<Identifier> outer_identifiers(const UTCTimeType&, const Module&, const Asn1Tree&)
 {
@@ -19,7 +19,8 @@ std::string identifier_template_params(const Type&, const Module&, const Asn1Tre
 
 template <typename Collection>
 CodeBlock create_collection_definition(const Collection& collection, const Module& module, const Asn1Tree& tree,
-                                       const std::string& type_name, const std::string& identifier_override)
+                                       const std::string& type_name, const std::string& identifier_override,
+                                       const TypeStorage& type_storage)
 {
     CodeBlock block;
     block.add_line("struct " + type_name);
@@ -56,12 +57,14 @@ CodeBlock create_collection_definition(const Collection& collection, const Modul
             {
                 std::string id = Identifier(Class::context_specific, tag_counter++).name();
                 block.add_block(create_type_assignment(make_type_name(component.named_type.name, type_name),
-                                                       component.named_type.type, module, tree, id, false));
+                                                       component.named_type.type, module, tree, id, false,
+                                                       type_storage));
             }
             else
             {
                 block.add_block(create_type_assignment(make_type_name(component.named_type.name, type_name),
-                                                       component.named_type.type, module, tree, {}, false));
+                                                       component.named_type.type, module, tree, {}, false,
+                                                       type_storage));
             }
         }
         if (!collection.components.empty())
@@ -96,15 +99,28 @@ CodeBlock create_collection_definition(const Collection& collection, const Modul
         block.add_line(create_template_definition({"Identifier"}));
         block.add_line("EncodeResult encode_with_id(std::span<uint8_t>) const noexcept;");
         block.add_line(create_template_definition({"Identifier"}));
+        block.add_line("EncodeResult encode_reverse_with_id(std::span<uint8_t>) const noexcept;");
+        block.add_line(create_template_definition({"Identifier"}));
+        block.add_line("EncodeResult encode_indefinite_with_id(std::span<uint8_t>) const noexcept;");
+        block.add_line(create_template_definition({"Identifier"}));
+        block.add_line("EncodeResult encode_gather_with_id(GatherBuffer&) const noexcept;");
+        block.add_line(create_template_definition({"Identifier"}));
         block.add_line("DecodeResult decode_with_id(BerView) noexcept;");
 
         block.add_line("size_t encoded_length() const noexcept");
         block.add_line("{ return encoded_length_with_id<" + id + ">(); }");
         block.add_line("EncodeResult encode(std::span<uint8_t> output) const noexcept");
         block.add_line("{ return encode_with_id<" + id + ">(output); }");
+        block.add_line("EncodeResult encode_reverse(std::span<uint8_t> output) const noexcept");
+        block.add_line("{ return encode_reverse_with_id<" + id + ">(output); }");
+        block.add_line("EncodeResult encode_indefinite(std::span<uint8_t> output) const noexcept");
+        block.add_line("{ return encode_indefinite_with_id<" + id + ">(output); }");
+        block.add_line("EncodeResult encode_gather(GatherBuffer& output) const noexcept");
+        block.add_line("{ return encode_gather_with_id<" + id + ">(output); }");
         block.add_line("DecodeResult decode(BerView input) noexcept");
         block.add_line("{ return decode_with_id<" + id + ">(input); }");
         block.add_line("using AsnId = " + id + ";");
+        block.add_line("struct View;");
     }
     return block;
 }
@@ -284,7 +300,9 @@ std::string type_as_string(const SequenceOfType& sequence, const Module&, const
         }
     }
 
-    std::string res = "SequenceOf<::fast_ber::" + realModule + "::" + type_name + "Contained";
+    // Member types are not found at module scope, their contained type is declared alongside them
+    std::string res = realModule.empty() ? "SequenceOf<" + type_name + "Contained"
+                                         : "SequenceOf<::fast_ber::" + realModule + "::" + type_name + "Contained";
     if (identifier_override.empty())
     {
         res += ", ExplicitId<UniversalTag::sequence>";
@@ -294,7 +312,7 @@ std::string type_as_string(const SequenceOfType& sequence, const Module&, const
         res += ", " + identifier_override;
     }
 
-    res += ", " + to_string(sequence.storage);
+    res += ", " + storage_template_params(sequence);
     res += ">";
 
     return res;
@@ -402,8 +420,44 @@ std::string type_as_string(const Type& type, const Module& module, const Asn1Tre
     return std::visit(string_helper, type);
 }
 
+// Select the storage of a string or value type. Other types, and types referred to by name, are unchanged
+std::string with_storage(const std::string& type_string, const Type& type, const Module& module, const Asn1Tree& tree,
+                         const TypeStorage& type_storage)
+{
+    if (type_string.empty() || type_string.back() != '>')
+    {
+        return type_string;
+    }
+
+    const Type& resolved =
+        is_defined(type) ? resolve_type(tree, module.module_reference, std::get<DefinedType>(type)).type : type;
+
+    std::optional<StorageMode> storage;
+    if (is_octet_string(resolved) || is_bit_string(resolved) || is_character_string(resolved))
+    {
+        if (type_storage.strings != TypeStorage{}.strings)
+        {
+            storage = type_storage.strings;
+        }
+    }
+    else if (is_integer(resolved) || is_enumerated(resolved) || is_boolean(resolved) || is_real(resolved))
+    {
+        if (type_storage.values != TypeStorage{}.values)
+        {
+            storage = type_storage.values;
+        }
+    }
+
+    if (!storage)
+    {
+        return type_string;
+    }
+    return type_string.substr(0, type_string.size() - 1) + ", " + to_string(*storage) + ">";
+}
+
 CodeBlock create_type_assignment(const std::string& name, const Type& assignment_type, const Module& module,
-                                 const Asn1Tree& tree, const std::string& identifier_override, bool introduce_type)
+                                 const Asn1Tree& tree, const std::string& identifier_override, bool introduce_type,
+                                 const TypeStorage& type_storage)
 {
     CodeBlock block;
 
@@ -428,30 +482,30 @@ CodeBlock create_type_assignment(const std::string& name, const Type& assignment
     {
         const SetOfType& sequence = std::get<SetOfType>(std::get<BuiltinType>(assignment_type));
         const Type&      type     = sequence.has_name ? sequence.named_type->type : *sequence.type;
-        block.add_block(create_type_assignment(name + "Contained", type, module, tree, {}, false));
+        block.add_block(create_type_assignment(name + "Contained", type, module, tree, {}, false, type_storage));
     }
     else if (is_sequence_of(assignment_type))
     {
         const SequenceOfType& sequence = std::get<SequenceOfType>(std::get<BuiltinType>(assignment_type));
         const Type&           type     = sequence.has_name ? sequence.named_type->type : *sequence.type;
-        block.add_block(create_type_assignment(name + "Contained", type, module, tree, {}, false));
+        block.add_block(create_type_assignment(name + "Contained", type, module, tree, {}, false, type_storage));
     }
     else if (is_set(assignment_type))
     {
         const SetType& set = std::get<SetType>(std::get<BuiltinType>(assignment_type));
         check_valid(set, module, tree, name);
-        return create_collection_definition(set, module, tree, name, identifier_override);
+        return create_collection_definition(set, module, tree, name, identifier_override, type_storage);
     }
     else if (is_sequence(assignment_type))
     {
         const SequenceType& sequence = std::get<SequenceType>(std::get<BuiltinType>(assignment_type));
         check_valid(sequence, module, tree, name);
-        return create_collection_definition(sequence, module, tree, name, identifier_override);
+        return create_collection_definition(sequence, module, tree, name, identifier_override, type_storage);
     }
     else if (is_choice(assignment_type))
     {
         const ChoiceType& choice = std::get<ChoiceType>(std::get<BuiltinType>(assignment_type));
-        return create_choice_definition(choice, module, tree, name, identifier_override);
+        return create_choice_definition(choice, module, tree, name, identifier_override, type_storage);
     }
 
     if (is_prefixed(assignment_type))
@@ -463,7 +517,8 @@ CodeBlock create_type_assignment(const std::string& name, const Type& assignment
         }
 
         const PrefixedType& prefixed = std::get<PrefixedType>(std::get<BuiltinType>(assignment_type));
-        block.add_block(create_type_assignment(name, prefixed.tagged_type->type, module, tree, id, introduce_type));
+        block.add_block(create_type_assignment(name, prefixed.tagged_type->type, module, tree, id, introduce_type,
+                                               type_storage));
     }
     else
     {
@@ -483,14 +538,15 @@ CodeBlock create_type_assignment(const std::string& name, const Type& assignment
                                resolved.module.module_reference + "::" + defined_type.type_reference + "Values;");
             }
         }
+        const std::string type_string = with_storage(type_as_string(assignment_type, module, tree, name, id),
+                                                     assignment_type, module, tree, type_storage);
         if (introduce_type)
         {
-            block.add_line("FAST_BER_ALIAS(" + name + ", " + type_as_string(assignment_type, module, tree, name, id) +
-                           ");");
+            block.add_line("FAST_BER_ALIAS(" + name + ", " + type_string + ");");
         }
         else
         {
-            block.add_line("using " + name + " = " + type_as_string(assignment_type, module, tree, name, id) + ";");
+            block.add_line("using " + name + " = " + type_string + ";");
         }
     }
     return block;
@@ -499,5 +555,5 @@ CodeBlock create_type_assignment(const std::string& name, const Type& assignment
 CodeBlock create_type_assignment(const Assignment& assignment, const Module& module, const Asn1Tree& tree)
 {
     return create_type_assignment(assignment.name, std::get<TypeAssignment>(assignment.specific).type, module, tree,
-                                  {}, true);
+                                  {}, true, tree.storage_of(assignment.name));
 }
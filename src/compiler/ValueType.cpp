@@ -141,7 +141,7 @@ std::string value_type(const SequenceOfType& sequence, const Module& module, con
         res += ", " + identifier_override;
     }
 
-    res += ", " + to_string(sequence.storage);
+    res += ", " + storage_template_params(sequence);
     res += ">";
 
     return res;
@@ -166,7 +166,7 @@ std::string value_type(const SetOfType& set, const Module& module, const Asn1Tre
         res += ", " + identifier_override;
     }
 
-    res += ", " + to_string(set.storage);
+    res += ", " + storage_template_params(set);
     res += ">";
 
     return res;
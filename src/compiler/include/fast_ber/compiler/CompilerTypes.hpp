@@ -39,6 +39,15 @@ enum class StorageMode
     static_,
     small_buffer_optimised,
     dynamic,
+    borrowed,
+    native,
+};
+
+// Storage of the string types, and of the value types (INTEGER, ENUMERATED and BOOLEAN), within a generated type
+struct TypeStorage
+{
+    StorageMode strings = StorageMode::dynamic;
+    StorageMode values  = StorageMode::static_;
 };
 
 std::string to_string(Class class_, bool abbreviated = false);
@@ -87,6 +96,7 @@ enum class UniversalTag
     embedded_pdv      = 11,
     utf8_string       = 12,
     relative_oid      = 13,
+    time              = 14,
     sequence          = 16,
     sequence_of       = 16,
     set               = 17,
@@ -105,7 +115,11 @@ enum class UniversalTag
     general_string    = 27,
     universal_string  = 28,
     character_string  = 29,
-    bmp_string        = 30
+    bmp_string        = 30,
+    date              = 31,
+    time_of_day       = 32,
+    date_time         = 33,
+    duration          = 34
 };
 
 inline std::string to_string(UniversalTag t) noexcept
@@ -140,6 +154,8 @@ inline std::string to_string(UniversalTag t) noexcept
         return "utf8_string";
     case UniversalTag::relative_oid:
         return "relative_oid";
+    case UniversalTag::time:
+        return "time";
     case UniversalTag::sequence:
         return "sequence";
     case UniversalTag::set:
@@ -170,6 +186,14 @@ inline std::string to_string(UniversalTag t) noexcept
         return "character_string";
     case UniversalTag::bmp_string:
         return "bmp_string";
+    case UniversalTag::date:
+        return "date";
+    case UniversalTag::time_of_day:
+        return "time_of_day";
+    case UniversalTag::date_time:
+        return "date_time";
+    case UniversalTag::duration:
+        return "duration";
     }
     return "Unknown Universal Tag";
 }
@@ -395,7 +419,8 @@ struct SequenceOfType
     bool                       has_name;
     std::unique_ptr<NamedType> named_type;
     std::unique_ptr<Type>      type;
-    StorageMode                storage = StorageMode::small_buffer_optimised;
+    StorageMode                storage         = StorageMode::small_buffer_optimised;
+    size_t                     inline_capacity = 0; // Zero selects the library default
 
     SequenceOfType() = default;
     SequenceOfType(bool, std::unique_ptr<NamedType>&&, std::unique_ptr<Type>&&,
@@ -607,6 +632,33 @@ struct Module
 struct Asn1Tree
 {
     std::vector<Module> modules;
+
+    // Borrowed strings reference the decoded buffer instead of copying it. Native values are stored unencoded
+    TypeStorage           default_storage;
+    std::set<std::string> borrowed_string_types;
+    std::set<std::string> native_value_types;
+
+    // Inline element capacity of small buffer optimised SEQUENCE OF and SET OF types, zero uses the library default.
+    // Capacities are configured per assignment name, or per member as "Assignment.member"
+    size_t                        default_inline_capacity = 0;
+    std::map<std::string, size_t> inline_capacities;
+
+    // Generate a generate_random function for each type, producing random values controlled by a RandomProfile
+    bool generate_random = false;
+
+    TypeStorage storage_of(const std::string& assignment_name) const
+    {
+        TypeStorage storage = default_storage;
+        if (borrowed_string_types.count(assignment_name) > 0)
+        {
+            storage.strings = StorageMode::borrowed;
+        }
+        if (native_value_types.count(assignment_name) > 0)
+        {
+            storage.values = StorageMode::native;
+        }
+        return storage;
+    }
 };
 
 struct Identifier;
@@ -765,6 +817,9 @@ std::string santize_name(const std::string& name);
 
 std::string make_type_optional(const std::string& type, StorageMode mode);
 
+// Storage mode and inline capacity template arguments of a SequenceOf
+std::string storage_template_params(const SequenceOfType& sequence);
+
 bool is_bit_string(const Type& type);
 bool is_set(const Type& type);
 bool is_sequence(const Type& type);
@@ -775,7 +830,9 @@ bool is_choice(const Type& type);
 bool is_prefixed(const Type& type);
 bool is_integer(const Type& type);
 bool is_octet_string(const Type& type);
+bool is_character_string(const Type& type);
 bool is_boolean(const Type& type);
+bool is_real(const Type& type);
 bool is_oid(const Type& type);
 bool is_defined(const Type& type);
 bool is_generated(const Type& type);
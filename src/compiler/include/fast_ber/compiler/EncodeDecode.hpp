@@ -7,3 +7,7 @@ inline std::string collection_name(const SetType&) { return "set"; }
 
 std::string create_encode_functions(const Assignment& assignment, const Module& module, const Asn1Tree& tree);
 std::string create_decode_functions(const Assignment& assignment, const Module& module, const Asn1Tree& tree);
+
+// Lazy views of generated types, all views are defined before any of their accessors
+std::string create_view_definitions(const Assignment& assignment, const Module& module, const Asn1Tree& tree);
+std::string create_view_functions(const Assignment& assignment, const Module& module, const Asn1Tree& tree);
@@ -3,7 +3,8 @@
 #include "fast_ber/compiler/CompilerTypes.hpp"
 
 CodeBlock create_choice_definition(const ChoiceType& choice, const Module& module, const Asn1Tree& tree,
-                                   const std::string& name, const std::string& identifier_override);
+                                   const std::string& name, const std::string& identifier_override,
+                                   const TypeStorage& type_storage);
 
 std::string create_choice_functions(const Asn1Tree& tree, const Module& module, const Assignment& assignment);
 
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "fast_ber/compiler/CompilerTypes.hpp"
+
+#include <map>
+#include <string>
+
+// Depths of the shortest values of the type assignments, as generated beyond RandomProfile::max_depth where optional
+// members are absent, SEQUENCE OF are empty and choices take their terminating alternative. Keyed as "Module.Type"
+using RandomDepths = std::map<std::string, size_t>;
+
+// Found once per tree and shared by the random functions of all its assignments
+RandomDepths random_depths(const Asn1Tree& tree);
+
+// The alternative of a CHOICE with the shortest values, which generate_random takes beyond the maximum depth so that
+// recursive choices end. Each step into it reduces the depth of the shortest value, so the value generated is finite
+size_t random_terminating_alternative(const Asn1Tree& tree, const Module& module, const ChoiceType& choice,
+                                      const RandomDepths& depths);
+
+std::string create_random_functions(const Asn1Tree& tree, const Module& module, const Assignment& assignment,
+                                    const RandomDepths& depths);
@@ -117,5 +117,5 @@ inline std::string type_name(const Type& t) { return std::visit(TypeNameHelper{}
 
 CodeBlock create_type_assignment(const std::string& name, const Type& assignment_type, const Module& module,
                                  const Asn1Tree& tree, const std::string& identifier_override = {},
-                                 bool introduce_type = true);
+                                 bool introduce_type = true, const TypeStorage& type_storage = {});
 CodeBlock create_type_assignment(const Assignment& assignment, const Module& module, const Asn1Tree& tree);
@@ -6,6 +6,7 @@
 #include "fast_ber/compiler/EncodeDecode.hpp"
 #include "fast_ber/compiler/GenerateChoice.hpp"
 #include "fast_ber/compiler/GenerateHelpers.hpp"
+#include "fast_ber/compiler/GenerateRandom.hpp"
 #include "fast_ber/compiler/Identifier.hpp"
 #include "fast_ber/compiler/Logging.hpp"
 #include "fast_ber/compiler/ObjectClass.hpp"
@@ -162,6 +163,15 @@ std::string create_detail_body(const Asn1Tree& tree)
 
     std::string body = "\n";
 
+    for (const Module& module : tree.modules)
+    {
+        for (const Assignment& assignment : module.assignments)
+        {
+            body += create_view_definitions(assignment, module, tree);
+        }
+    }
+
+    const RandomDepths depths = tree.generate_random ? random_depths(tree) : RandomDepths{};
     for (const Module& module : tree.modules)
     {
         std::string helpers;
@@ -170,7 +180,9 @@ std::string create_detail_body(const Asn1Tree& tree)
             body += create_choice_functions(tree, module, assignment);
             body += create_encode_functions(assignment, module, tree);
             body += create_decode_functions(assignment, module, tree);
+            body += create_view_functions(assignment, module, tree);
             helpers += create_helper_functions(tree, module, assignment);
+            helpers += create_random_functions(tree, module, assignment, depths);
         }
 
         body += add_namespace(module.module_reference, helpers);
@@ -187,6 +199,10 @@ std::string create_output_file(const Asn1Tree& tree, const std::string& fwd_file
     std::string output;
     output += "#pragma once\n\n";
     output += create_include("fast_ber/ber_types/All.hpp");
+    if (tree.generate_random)
+    {
+        output += create_include("fast_ber/util/Random.hpp");
+    }
     output += create_include(strip_path(fwd_filename)) + '\n';
     output += "\n";
 
@@ -204,18 +220,218 @@ std::string create_output_file(const Asn1Tree& tree, const std::string& fwd_file
     return output;
 }
 
-int main(int argc, char** argv)
+// Types selected for a storage mode also apply it to the types they contain
+void add_contained_types(const Asn1Tree& tree, std::set<std::string>& selected_types)
 {
-    if (argc < 3)
+    for (const Module& module : tree.modules)
     {
-        std::cout << "Usage: INPUT.asn... OUTPUT_NAME\n";
-        return -1;
+        std::unordered_map<std::string, const Assignment*> assignment_map;
+        for (const Assignment& assignment : module.assignments)
+        {
+            assignment_map[assignment.name] = &assignment;
+        }
+
+        std::vector<std::string> pending(selected_types.begin(), selected_types.end());
+        while (!pending.empty())
+        {
+            const auto assignment = assignment_map.find(pending.back());
+            pending.pop_back();
+            if (assignment == assignment_map.end())
+            {
+                continue;
+            }
+
+            for (const Dependency& dependency : dependencies(*assignment->second))
+            {
+                if ((!dependency.module_reference || dependency.module_reference == module.module_reference) &&
+                    selected_types.insert(dependency.name).second)
+                {
+                    pending.push_back(dependency.name);
+                }
+            }
+        }
+    }
+}
+
+// SequenceOf held by a type, looking through any tags
+SequenceOfType* sequence_of_type(Type& type)
+{
+    if (is_prefixed(type))
+    {
+        return sequence_of_type(std::get<PrefixedType>(std::get<BuiltinType>(type)).tagged_type->type);
+    }
+    if (is_sequence_of(type))
+    {
+        return &std::get<SequenceOfType>(std::get<BuiltinType>(type));
+    }
+    if (is_set_of(type))
+    {
+        return &std::get<SetOfType>(std::get<BuiltinType>(type));
+    }
+    return nullptr;
+}
+
+void set_inline_capacity(Type& type, const std::string& path, const Asn1Tree& tree)
+{
+    SequenceOfType* sequence_of = sequence_of_type(type);
+    if (sequence_of)
+    {
+        const auto capacity          = tree.inline_capacities.find(path);
+        sequence_of->inline_capacity = (capacity == tree.inline_capacities.end()) ? tree.default_inline_capacity
+                                                                                   : capacity->second;
+    }
+}
+
+// Apply configured inline capacities to SEQUENCE OF and SET OF assignments and to members of collections and choices
+void set_inline_capacities(Asn1Tree& tree)
+{
+    for (Module& module : tree.modules)
+    {
+        for (Assignment& assignment : module.assignments)
+        {
+            if (!std::holds_alternative<TypeAssignment>(assignment.specific))
+            {
+                continue;
+            }
+
+            Type& assigned_type = std::get<TypeAssignment>(assignment.specific).type;
+            set_inline_capacity(assigned_type, assignment.name, tree);
+            if (is_sequence(assigned_type) || is_set(assigned_type))
+            {
+                Collection& collection =
+                    is_sequence(assigned_type)
+                        ? static_cast<Collection&>(std::get<SequenceType>(std::get<BuiltinType>(assigned_type)))
+                        : static_cast<Collection&>(std::get<SetType>(std::get<BuiltinType>(assigned_type)));
+                for (ComponentType& component : collection.components)
+                {
+                    set_inline_capacity(component.named_type.type, assignment.name + "." + component.named_type.name,
+                                        tree);
+                }
+            }
+            else if (is_choice(assigned_type))
+            {
+                for (NamedType& choice : std::get<ChoiceType>(std::get<BuiltinType>(assigned_type)).choices)
+                {
+                    set_inline_capacity(choice.type, assignment.name + "." + choice.name, tree);
+                }
+            }
+        }
     }
+}
+
+std::vector<std::string> split_list(const std::string& list)
+{
+    std::vector<std::string> items;
+    size_t                   start = 0;
+    while (start <= list.size())
+    {
+        size_t end = list.find(',', start);
+        if (end == std::string::npos)
+        {
+            end = list.size();
+        }
+        if (end > start)
+        {
+            items.push_back(list.substr(start, end - start));
+        }
+        start = end + 1;
+    }
+    return items;
+}
+
+// Parse an option which applies to all types, or to a comma separated list of types as "option=TypeA,TypeB"
+bool parse_storage_option(const std::string& argument, const std::string& option, StorageMode mode,
+                          StorageMode& default_mode, std::set<std::string>& selected_types)
+{
+    if (argument == option)
+    {
+        default_mode = mode;
+        return true;
+    }
+    if (argument.compare(0, option.size() + 1, option + "=") == 0)
+    {
+        for (const std::string& type : split_list(argument.substr(option.size() + 1)))
+        {
+            selected_types.insert(type);
+        }
+        return true;
+    }
+    return false;
+}
+
+// Parse "--inline-capacity=N" setting the default capacity, or a list of "Type=N" and "Type.member=N" capacities
+bool parse_inline_capacity_option(const std::string& argument, Asn1Tree& tree)
+{
+    const std::string option = "--inline-capacity=";
+    if (argument.compare(0, option.size(), option) != 0)
+    {
+        return false;
+    }
+
+    for (const std::string& item : split_list(argument.substr(option.size())))
+    {
+        const size_t      separator = item.rfind('=');
+        const std::string capacity  = (separator == std::string::npos) ? item : item.substr(separator + 1);
+        if (capacity.empty() || capacity.find_first_not_of("0123456789") != std::string::npos)
+        {
+            throw std::runtime_error("Invalid inline capacity [" + item + "]");
+        }
+
+        if (separator == std::string::npos)
+        {
+            tree.default_inline_capacity = std::stoul(capacity);
+        }
+        else
+        {
+            tree.inline_capacities[item.substr(0, separator)] = std::stoul(capacity);
+        }
+    }
+    return true;
+}
+
+// Parse an option which is either present or absent
+bool parse_flag_option(const std::string& argument, const std::string& option, bool& flag)
+{
+    if (argument != option)
+    {
+        return false;
+    }
+    flag = true;
+    return true;
+}
+
+// Parse a leading option, return false if the argument is not an option
+bool parse_option(const std::string& argument, Asn1Tree& tree)
+{
+    return parse_storage_option(argument, "--borrowed-strings", StorageMode::borrowed, tree.default_storage.strings,
+                                tree.borrowed_string_types) ||
+           parse_storage_option(argument, "--native-values", StorageMode::native, tree.default_storage.values,
+                                tree.native_value_types) ||
+           parse_inline_capacity_option(argument, tree) ||
+           parse_flag_option(argument, "--generate-random", tree.generate_random);
+}
+
+int main(int argc, char** argv)
+{
+    const std::string usage =
+        "Usage: [--borrowed-strings[=Type,...]] [--native-values[=Type,...]] [--inline-capacity=[Type[.member]=]N,...] "
+        "[--generate-random] INPUT.asn... OUTPUT_NAME\n";
 
     try
     {
         Context context;
-        for (int i = 1; i < argc - 1; i++)
+        int     first_input = 1;
+        while (first_input < argc && parse_option(argv[first_input], context.asn1_tree))
+        {
+            first_input++;
+        }
+        if (argc - first_input < 2)
+        {
+            std::cout << usage;
+            return -1;
+        }
+
+        for (int i = first_input; i < argc - 1; i++)
         {
             std::string   input_filename = argv[i];
             std::ifstream input_file(input_filename);
@@ -279,6 +495,9 @@ int main(int argc, char** argv)
         {
             module.assignments = reorder_assignments(module.assignments, context.asn1_tree, module);
         }
+        add_contained_types(context.asn1_tree, context.asn1_tree.borrowed_string_types);
+        add_contained_types(context.asn1_tree, context.asn1_tree.native_value_types);
+        set_inline_capacities(context.asn1_tree);
 
         output_file << create_output_file(context.asn1_tree, fwd_filame, detail_filame);
         fwd_output_file << create_fwd_body(context.asn1_tree);
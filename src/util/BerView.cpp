@@ -88,6 +88,15 @@ std::ostream& operator<<(std::ostream& os, BerView view) noexcept
                 case UniversalTag::bmp_string:
                     os << BMPString<>(view);
                     break;
+                case UniversalTag::date:
+                    os << Date<>(view);
+                    break;
+                case UniversalTag::time_of_day:
+                    os << TimeOfDay<>(view);
+                    break;
+                case UniversalTag::date_time:
+                    os << DateTime<>(view);
+                    break;
 
                 case UniversalTag::embedded_pdv:
                 case UniversalTag::relative_oid:
@@ -1,3 +1,4 @@
+#include "fast_ber/util/BerIndex.hpp"
 #include "fast_ber/util/BerView.hpp"
 
 #include <fstream>
@@ -7,6 +8,7 @@
 void usage()
 {
     std::cout << "Tool to inspect the contents of a BER PDU. Does not require schema.\n";
+    std::cout << "  Files containing several concatenated PDUs are displayed one PDU per line.\n";
     std::cout << "  usage: ./ber_view [pdu_to_decode.ber]\n";
 }
 
@@ -27,8 +29,17 @@ int main(int argc, const char** argv)
     }
 
     const auto buffer = std::vector<uint8_t>{std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>()};
-    auto       view   = fast_ber::BerView(buffer);
+    const auto index  = fast_ber::BerIndex(buffer);
+    if (!index.is_valid())
+    {
+        auto view = fast_ber::BerView(buffer);
+        std::cout << view;
+        return -1;
+    }
 
-    std::cout << view;
-    return view.is_valid() ? 0 : -1;
+    for (size_t i = 0; i < index.size(); i = index.next_sibling(i))
+    {
+        std::cout << index.view(i) << '\n';
+    }
+    return 0;
 }
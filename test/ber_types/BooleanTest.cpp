@@ -5,6 +5,9 @@
 
 #include <catch2/catch.hpp>
 
+#include <array>
+#include <type_traits>
+
 TEST_CASE("Boolean: Construction from bool")
 {
     REQUIRE(fast_ber::Boolean<>(false).value() == false);
@@ -55,3 +58,37 @@ TEST_CASE("Boolean: Tagged")
     test.encode(std::span(buffer.data(), buffer.size()));
     CHECK(fast_ber::has_correct_header(fast_ber::BerView(buffer), TestId{}, fast_ber::Construction::primitive));
 }
+
+TEST_CASE("Boolean: Native storage")
+{
+    using Identifier    = fast_ber::Id<fast_ber::Class::context_specific, 5>;
+    using NativeBoolean = fast_ber::Boolean<Identifier, fast_ber::StorageMode::native>;
+
+    static_assert(std::is_trivially_copyable<NativeBoolean>::value, "Trivially copyable");
+    static_assert(sizeof(NativeBoolean) < sizeof(fast_ber::Boolean<Identifier>), "Smaller than ber storage");
+
+    for (bool val : {true, false})
+    {
+        const fast_ber::Boolean<Identifier> encoded(val);
+        const NativeBoolean                 native(val);
+
+        std::array<uint8_t, 3> encoded_buffer = {};
+        std::array<uint8_t, 3> native_buffer  = {};
+        REQUIRE(encoded.encode(encoded_buffer).success);
+        REQUIRE(native.encode(native_buffer).success);
+        REQUIRE(native_buffer == encoded_buffer);
+
+        NativeBoolean decoded(!val);
+        REQUIRE(decoded.decode(fast_ber::BerView(native_buffer)).success);
+        REQUIRE(decoded == val);
+        REQUIRE(decoded == encoded);
+    }
+
+    const std::array<uint8_t, 3> non_canonical_true = {0x85, 0x01, 0x01};
+    NativeBoolean                native;
+    REQUIRE(native.decode(fast_ber::BerView(non_canonical_true)).success);
+    REQUIRE(native.value());
+
+    const std::array<uint8_t, 4> too_long = {0x85, 0x02, 0x00, 0x00};
+    REQUIRE(!native.decode(fast_ber::BerView(too_long)).success);
+}
@@ -3,6 +3,7 @@
 #include <catch2/catch.hpp>
 
 #include <array>
+#include <type_traits>
 
 enum class TestEnumValues
 {
@@ -43,3 +44,25 @@ TEST_CASE("Enumerated: Encode Decode")
 static_assert(
     std::is_same<fast_ber::Identifier<TestEnum>, fast_ber::ExplicitId<fast_ber::UniversalTag::enumerated>>::value,
     "Enum Identifier");
+
+TEST_CASE("Enumerated: Native storage")
+{
+    using NativeEnum = fast_ber::Enumerated<TestEnumValues, fast_ber::ExplicitId<fast_ber::UniversalTag::enumerated>,
+                                            fast_ber::StorageMode::native>;
+
+    static_assert(std::is_trivially_copyable<NativeEnum>::value, "Trivially copyable");
+
+    std::array<uint8_t, 100> native_data  = {};
+    std::array<uint8_t, 100> encoded_data = {};
+
+    const NativeEnum native  = TestEnum::Values::option_three;
+    const TestEnum   encoded = TestEnum::Values::option_three;
+    REQUIRE(fast_ber::encode(std::span<uint8_t>(native_data), native).success);
+    REQUIRE(fast_ber::encode(std::span<uint8_t>(encoded_data), encoded).success);
+    REQUIRE(native_data == encoded_data);
+
+    NativeEnum decoded;
+    REQUIRE(fast_ber::decode(std::span<const uint8_t>(native_data), decoded).success);
+    REQUIRE(decoded == TestEnumValues::option_three);
+    REQUIRE(decoded == encoded);
+}
@@ -1,74 +1,207 @@
-//#include "fast_ber/ber_types/GeneralizedTime.hpp"
-//#include "fast_ber/ber_types/Identifier.hpp"
-//#include "fast_ber/util/DecodeHelpers.hpp"
-//#include "fast_ber/util/EncodeHelpers.hpp"
-//
-//#include <catch2/catch.hpp>
-//#include <limits>
-//
-//
-//TEST_CASE("GeneralizedTime: Assign")
-//{
-//    const std::Time            now = std::Now();
-//    fast_ber::GeneralizedTime<> time(now);
-//    REQUIRE(fast_ber::GeneralizedTime<>(time.time()).string() == time.string());
-//
-//    time.set_time(std::UnixEpoch());
-//    REQUIRE(time.time() == std::UnixEpoch());
-//    REQUIRE(time.string() == "19700101000000Z");
-//    REQUIRE(time.format() == fast_ber::GeneralizedTime<>::TimeFormat::universal);
-//
-//    time.set_time(std::UnixEpoch(), 150);
-//    REQUIRE(time.time() == std::UnixEpoch());
-//    REQUIRE(time.string() == "19700101000000+0230");
-//    REQUIRE(time.format() == fast_ber::GeneralizedTime<>::TimeFormat::universal_with_timezone);
-//
-//    time.set_time(std::UnixEpoch(), -30);
-//    REQUIRE(time.time() == std::UnixEpoch());
-//    REQUIRE(time.string() == "19700101000000-0030");
-//    REQUIRE(time.format() == fast_ber::GeneralizedTime<>::TimeFormat::universal_with_timezone);
-//
-//    std::CivilSecond cs(2017, 1, 2, 3, 4, 5);
-//    time.set_time(cs);
-//    REQUIRE(time.time() == std::FromCivil(cs, std::LocalTimeZone()));
-//    REQUIRE(time.string() == "20170102030405");
-//    REQUIRE(time.format() == fast_ber::GeneralizedTime<>::TimeFormat::local);
-//}
-//
-//TEST_CASE("GeneralizedTime: Encode Decode")
-//
-//{
-//    std::array<uint8_t, 100> buffer = {};
-//
-//    fast_ber::GeneralizedTime<> first  = std::FromTimeT(1500000000);
-//    fast_ber::GeneralizedTime<> second = std::FromTimeT(1000000000);
-//
-//    fast_ber::EncodeResult encode_res = fast_ber::encode(std::span<uint8_t>(buffer), first);
-//    fast_ber::DecodeResult decode_res = fast_ber::decode(std::span<uint8_t>(buffer), second);
-//
-//    REQUIRE(encode_res.success);
-//    REQUIRE(decode_res.success);
-//
-//    REQUIRE(first == second);
-//}
-//
-//TEST_CASE("GeneralizdTime: Encoding")
-//
-//{
-//    std::array<uint8_t, 100> buffer   = {};
-//    std::array<uint8_t, 17>  expected = {0x18, 0x0F, 0x32, 0x30, 0x31, 0x39, 0x30, 0x33, 0x31,
-//                                        0x39, 0x32, 0x31, 0x30, 0x39, 0x34, 0x32, 0x5A};
-//
-//    fast_ber::GeneralizedTime<> time       = std::FromTimeT(1553029782);
-//    fast_ber::EncodeResult      encode_res = fast_ber::encode(std::span<uint8_t>(buffer), time);
-//
-//    REQUIRE(encode_res.success);
-//    REQUIRE(time.string() == "20190319210942Z");
-//    REQUIRE(std::span(buffer.data(), expected.size()) == std::span(expected.data(), expected.size()));
-//}
-//
-//TEST_CASE("GeneralizedTime: Default value")
-//{
-//    REQUIRE(fast_ber::GeneralizedTime<>().string() == "19700101000000Z");
-//    REQUIRE(fast_ber::GeneralizedTime<>().time() == std::UnixEpoch());
-//}
+#include "fast_ber/ber_types/GeneralizedTime.hpp"
+#include "fast_ber/ber_types/Identifier.hpp"
+#include "fast_ber/ber_types/OctetString.hpp"
+#include "fast_ber/ber_types/UTCTime.hpp"
+#include "fast_ber/util/DecodeHelpers.hpp"
+#include "fast_ber/util/EncodeHelpers.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+const fast_ber::TimePoint epoch{};
+
+fast_ber::TimePoint from_unix_seconds(int64_t seconds) { return fast_ber::TimePoint(std::chrono::seconds(seconds)); }
+
+// Decode a time from an encoding with the given contents
+template <typename T>
+fast_ber::DecodeResult decode_content(const std::string& content, T& time)
+{
+    std::array<uint8_t, 100> buffer = {};
+    REQUIRE(fast_ber::encode(std::span(buffer), fast_ber::OctetString<typename T::AsnId>(content)).success);
+    return fast_ber::decode(std::span(buffer), time);
+}
+
+} // namespace
+
+TEST_CASE("GeneralizedTime: Assign")
+{
+    const fast_ber::TimePoint   now = std::chrono::floor<std::chrono::microseconds>(std::chrono::system_clock::now());
+    fast_ber::GeneralizedTime<> time(now);
+    REQUIRE(time.time() == now);
+    REQUIRE(fast_ber::GeneralizedTime<>(time.time()).string() == time.string());
+
+    time.set_time(epoch);
+    REQUIRE(time.time() == epoch);
+    REQUIRE(time.string() == "19700101000000Z");
+    REQUIRE(time.format() == fast_ber::GeneralizedTime<>::TimeFormat::universal);
+
+    // Written as the local time at the offset
+    time.set_time(epoch, 150);
+    REQUIRE(time.time() == epoch);
+    REQUIRE(time.string() == "19700101023000+0230");
+    REQUIRE(time.format() == fast_ber::GeneralizedTime<>::TimeFormat::universal_with_timezone);
+
+    time.set_time(epoch, -30);
+    REQUIRE(time.time() == epoch);
+    REQUIRE(time.string() == "19691231233000-0030");
+    REQUIRE(time.format() == fast_ber::GeneralizedTime<>::TimeFormat::universal_with_timezone);
+
+    const std::chrono::local_seconds local =
+        std::chrono::local_days(std::chrono::year(2017) / 1 / 2) + std::chrono::hours(3) + std::chrono::minutes(4) +
+        std::chrono::seconds(5);
+    time.set_time(local);
+    REQUIRE(time.time().time_since_epoch() == local.time_since_epoch());
+    REQUIRE(time.string() == "20170102030405");
+    REQUIRE(time.format() == fast_ber::GeneralizedTime<>::TimeFormat::local);
+}
+
+TEST_CASE("GeneralizedTime: Fractions of a second")
+{
+    fast_ber::GeneralizedTime<> time(from_unix_seconds(1553029782) + std::chrono::milliseconds(500));
+    REQUIRE(time.string() == "20190319210942.5Z");
+
+    time.set_time(from_unix_seconds(1553029782) + std::chrono::microseconds(1));
+    REQUIRE(time.string() == "20190319210942.000001Z");
+
+    // Precision beyond a microsecond is truncated
+    time = fast_ber::GeneralizedTime<>(std::chrono::sys_time<std::chrono::nanoseconds>(std::chrono::nanoseconds(1999)));
+    REQUIRE(time.string() == "19700101000000.000001Z");
+}
+
+TEST_CASE("GeneralizedTime: Limits")
+{
+    fast_ber::GeneralizedTime<> time(std::chrono::sys_days(std::chrono::year(10000) / 1 / 1));
+    REQUIRE(time.string() == "99991231235959.999999Z");
+
+    time.set_time(std::chrono::sys_days(std::chrono::year(-1) / 1 / 1));
+    REQUIRE(time.string() == "00000101000000Z");
+
+    time.set_time(epoch, 100000);
+    REQUIRE(time.string() == "19700101235900+2359");
+}
+
+TEST_CASE("GeneralizedTime: Decode forms")
+{
+    fast_ber::GeneralizedTime<> time;
+    const fast_ber::TimePoint   expected = from_unix_seconds(1553029782);
+
+    const std::vector<std::pair<std::string, fast_ber::TimePoint>> valid = {
+        {"20190319210942Z", expected},
+        {"20190319220942+0100", expected},
+        {"20190319200942-01", expected},
+        {"201903192109Z", expected - std::chrono::seconds(42)},
+        {"2019031921Z", expected - std::chrono::seconds(582)},
+        {"2019031921.5Z", expected - std::chrono::seconds(582) + std::chrono::minutes(30)},
+        {"201903192109,7Z", expected},
+        {"20190319210942.123456789Z", expected + std::chrono::microseconds(123456)},
+        {"20161231235960Z", from_unix_seconds(1483228800)},
+        {"20190319210942", expected},
+    };
+    for (const auto& [content, value] : valid)
+    {
+        INFO(content);
+        REQUIRE(decode_content(content, time).success);
+        REQUIRE(time.string() == content);
+        REQUIRE(time.time() == value);
+    }
+
+    const std::vector<std::string> invalid = {"", "201903192", "20191319210942Z", "20190229210942Z",
+                                              "20190319240942Z", "20190319216042Z", "20190319210961Z",
+                                              "201903192109421Z", "20190319210942.Z", "20190319210942X",
+                                              "20190319210942+1", "20190319210942+2400", "20190319210942Z0",
+                                              "2019031921094Z", "2019-3192109Z"};
+    for (const std::string& content : invalid)
+    {
+        INFO(content);
+        const fast_ber::DecodeResult result = decode_content(content, time);
+        REQUIRE(!result.success);
+        REQUIRE(result.error == fast_ber::DecodeError::invalid_content);
+    }
+}
+
+TEST_CASE("GeneralizedTime: Encode Decode")
+{
+    std::array<uint8_t, 100> buffer = {};
+
+    fast_ber::GeneralizedTime<> first  = from_unix_seconds(1500000000);
+    fast_ber::GeneralizedTime<> second = from_unix_seconds(1000000000);
+
+    fast_ber::EncodeResult encode_res = fast_ber::encode(std::span<uint8_t>(buffer), first);
+    fast_ber::DecodeResult decode_res = fast_ber::decode(std::span<uint8_t>(buffer), second);
+
+    REQUIRE(encode_res.success);
+    REQUIRE(decode_res.success);
+
+    REQUIRE(first == second);
+}
+
+TEST_CASE("GeneralizedTime: Encoding")
+{
+    std::array<uint8_t, 100> buffer   = {};
+    std::array<uint8_t, 17>  expected = {0x18, 0x0F, 0x32, 0x30, 0x31, 0x39, 0x30, 0x33, 0x31,
+                                        0x39, 0x32, 0x31, 0x30, 0x39, 0x34, 0x32, 0x5A};
+
+    fast_ber::GeneralizedTime<> time       = from_unix_seconds(1553029782);
+    fast_ber::EncodeResult      encode_res = fast_ber::encode(std::span<uint8_t>(buffer), time);
+
+    REQUIRE(encode_res.success);
+    REQUIRE(time.string() == "20190319210942Z");
+    REQUIRE(std::equal(expected.begin(), expected.end(), buffer.begin()));
+}
+
+TEST_CASE("GeneralizedTime: Default value")
+{
+    REQUIRE(fast_ber::GeneralizedTime<>().string() == "19700101000000Z");
+    REQUIRE(fast_ber::GeneralizedTime<>().time() == epoch);
+}
+
+TEST_CASE("UTCTime: Assign")
+{
+    fast_ber::UTCTime<> time = from_unix_seconds(1553029782);
+    REQUIRE(time.string() == "190319210942Z");
+    REQUIRE(time.format() == fast_ber::UTCTime<>::TimeFormat::universal);
+
+    time.set_time(from_unix_seconds(1553029782), -90);
+    REQUIRE(time.string() == "190319193942-0130");
+    REQUIRE(time.time() == from_unix_seconds(1553029782));
+
+    // Two digit years are 1950 to 2049, fractions of a second cannot be represented
+    time.set_time(std::chrono::sys_days(std::chrono::year(1949) / 12 / 31));
+    REQUIRE(time.string() == "500101000000Z");
+    time.set_time(std::chrono::sys_days(std::chrono::year(2050) / 1 / 1));
+    REQUIRE(time.string() == "491231235959Z");
+    time.set_time(from_unix_seconds(0) + std::chrono::milliseconds(999));
+    REQUIRE(time.string() == "700101000000Z");
+
+    REQUIRE(fast_ber::UTCTime<>().string() == "700101000000Z");
+}
+
+TEST_CASE("UTCTime: Decode forms")
+{
+    fast_ber::UTCTime<> time;
+
+    REQUIRE(decode_content("1903192109Z", time).success);
+    REQUIRE(time.time() == from_unix_seconds(1553029740));
+    REQUIRE(decode_content("190319220942+0100", time).success);
+    REQUIRE(time.time() == from_unix_seconds(1553029782));
+    REQUIRE(decode_content("500101000000Z", time).success);
+    REQUIRE(time.time() == fast_ber::TimePoint(std::chrono::sys_days(std::chrono::year(1950) / 1 / 1)));
+    REQUIRE(decode_content("491231235959Z", time).success);
+    REQUIRE(time.time() ==
+            fast_ber::TimePoint(std::chrono::sys_days(std::chrono::year(2050) / 1 / 1)) - std::chrono::seconds(1));
+
+    for (const std::string content :
+         {"190319210942", "190319210942.5Z", "19031921Z", "191319210942Z", "1903192109421Z", "1903192109+01"})
+    {
+        INFO(content);
+        REQUIRE(!decode_content(content, time).success);
+    }
+}
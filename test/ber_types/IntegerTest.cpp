@@ -6,6 +6,8 @@
 
 #include <catch2/catch.hpp>
 #include <limits>
+#include <type_traits>
+#include <vector>
 
 TEST_CASE("Integer: Construction from int")
 {
@@ -109,3 +111,112 @@ TEST_CASE("Integer: Encode Decode")
     REQUIRE(dec_success);
     REQUIRE(i1 == i2);
 }
+
+TEST_CASE("Integer: Minimal encoding at each width")
+{
+    for (size_t width = 1; width <= 8; width++)
+    {
+        // Largest and smallest values of each width, and their neighbours needing one more octet
+        const int64_t max = static_cast<int64_t>(std::numeric_limits<uint64_t>::max() >> (65 - width * 8));
+        const int64_t min = -max - 1;
+        for (int64_t val : {max, min, width < 8 ? max + 1 : max, width < 8 ? min - 1 : min})
+        {
+            INFO(val);
+            const size_t expected_length = (val > max || val < min) ? width + 1 : width;
+
+            std::array<uint8_t, 8> content = {};
+            REQUIRE(fast_ber::encoded_integer_length(val) == expected_length);
+            REQUIRE(fast_ber::encode_integer(content, val) == expected_length);
+            REQUIRE(fast_ber::encode_integer(std::span(content.data(), expected_length - 1), val) == 0);
+
+            // Big endian two's complement
+            for (size_t i = 0; i < expected_length; i++)
+            {
+                const uint64_t shift = (expected_length - i - 1) * 8;
+                REQUIRE(content[i] == static_cast<uint8_t>(static_cast<uint64_t>(val) >> shift));
+            }
+
+            int64_t decoded = 0;
+            REQUIRE(fast_ber::decode_integer(std::span(content.data(), expected_length), decoded));
+            REQUIRE(decoded == val);
+        }
+    }
+
+    int64_t decoded = 0;
+    REQUIRE(!fast_ber::decode_integer(std::span<const uint8_t>(), decoded));
+    const std::array<uint8_t, 9> too_long = {};
+    REQUIRE(!fast_ber::decode_integer(too_long, decoded));
+}
+
+TEST_CASE("Integer: Native storage encodes as ber storage")
+{
+    using Identifier = fast_ber::DoubleId<fast_ber::Id<fast_ber::Class::application, 2>,
+                                          fast_ber::ExplicitId<fast_ber::UniversalTag::integer>>;
+    using NativeInteger = fast_ber::Integer<Identifier, fast_ber::StorageMode::native>;
+
+    static_assert(std::is_trivially_copyable<NativeInteger>::value, "Trivially copyable");
+    static_assert(sizeof(NativeInteger) < sizeof(fast_ber::Integer<Identifier>), "Smaller than ber storage");
+
+    std::initializer_list<int64_t> test_vals{0,
+                                             1,
+                                             -1,
+                                             127,
+                                             128,
+                                             -128,
+                                             -129,
+                                             255,
+                                             256,
+                                             32767,
+                                             -32768,
+                                             8388607,
+                                             -8388609,
+                                             std::numeric_limits<int32_t>::max(),
+                                             std::numeric_limits<int32_t>::min(),
+                                             int64_t{1} << 55,
+                                             -(int64_t{1} << 55) - 1,
+                                             std::numeric_limits<int64_t>::max(),
+                                             std::numeric_limits<int64_t>::min()};
+
+    for (int64_t val : test_vals)
+    {
+        const fast_ber::Integer<Identifier> encoded(val);
+        const NativeInteger                 native(val);
+
+        std::vector<uint8_t> encoded_buffer(100, 0x00);
+        std::vector<uint8_t> native_buffer(100, 0x00);
+
+        const fast_ber::EncodeResult encoded_result = encoded.encode(encoded_buffer);
+        const fast_ber::EncodeResult native_result  = native.encode(native_buffer);
+        REQUIRE(native_result.success);
+        REQUIRE(native_result.length == encoded_result.length);
+        REQUIRE(native.encoded_length() == encoded.encoded_length());
+        REQUIRE(native_buffer == encoded_buffer);
+
+        NativeInteger decoded;
+        REQUIRE(decoded.decode(fast_ber::BerView(native_buffer)).success);
+        REQUIRE(decoded == val);
+        REQUIRE(decoded == encoded);
+    }
+}
+
+TEST_CASE("Integer: Native storage conversion")
+{
+    using NativeInteger = fast_ber::Integer<fast_ber::ExplicitId<fast_ber::UniversalTag::integer>,
+                                            fast_ber::StorageMode::native>;
+
+    const fast_ber::Integer<> encoded = -500;
+    NativeInteger             native  = encoded;
+    REQUIRE(native.value() == -500);
+
+    native = 70000;
+    const fast_ber::Integer<> converted(native);
+    REQUIRE(converted.value() == 70000);
+    REQUIRE(converted == native);
+
+    std::array<uint8_t, 2> too_small = {};
+    REQUIRE(!native.encode(too_small).success);
+
+    const std::array<uint8_t, 2> wrong_tag = {0x04, 0x00};
+    REQUIRE(!native.decode(fast_ber::BerView(wrong_tag)).success);
+    REQUIRE(native.value() == 70000);
+}
@@ -61,3 +61,36 @@ TEST_CASE("Object Identifier: Encode decode")
     CHECK(oid1 == oid2);
     CHECK(fast_ber::has_correct_header(fast_ber::BerView(buffer), Identifier{}, fast_ber::Construction::primitive));
 }
+
+TEST_CASE("Object Identifier: Components")
+{
+    const fast_ber::ObjectIdentifier<> oid{1, 3, 6, 1, 4, 1, 1466, 115, 121, 1, 15};
+
+    REQUIRE(oid.number_of_components() == 11);
+    REQUIRE(oid.component_number(0) == 1);
+    REQUIRE(oid.component_number(1) == 3);
+    REQUIRE(oid.component_number(6) == 1466);
+    REQUIRE(oid.component_number(10) == 15);
+    REQUIRE(oid.component_number(11) == -1);
+    REQUIRE(oid.value().is_inline());
+    REQUIRE(fast_ber::ObjectIdentifier<>().component_number(0) == -1);
+}
+
+TEST_CASE("Object Identifier: Comparison")
+{
+    using Identifier = fast_ber::Id<fast_ber::Class::context_specific, 2>;
+
+    const fast_ber::ObjectIdentifier<>           oid{1, 2, 840, 113549, 1, 1, 11};
+    const fast_ber::ObjectIdentifier<Identifier> tagged{1, 2, 840, 113549, 1, 1, 11};
+
+    REQUIRE(oid == tagged);
+    REQUIRE(oid != fast_ber::ObjectIdentifier<>{1, 2, 840, 113549, 1, 1, 12});
+    REQUIRE(oid != fast_ber::ObjectIdentifier<>{1, 2, 840, 113549, 1, 1});
+    REQUIRE(oid == fast_ber::ObjectIdentifierComponents{1, 2, 840, 113549, 1, 1, 11});
+    REQUIRE(oid == std::vector<int64_t>{1, 2, 840, 113549, 1, 1, 11});
+    REQUIRE(oid != fast_ber::ObjectIdentifierComponents{1, 2, 840, 113549, 1, 1, 11, 0});
+    REQUIRE(oid != fast_ber::ObjectIdentifierComponents{1, 2, 840, 113549, 1, 1});
+    REQUIRE(oid != fast_ber::ObjectIdentifierComponents{1, 3, 840, 113549, 1, 1, 11});
+    REQUIRE(oid != fast_ber::ObjectIdentifierComponents{});
+    REQUIRE(fast_ber::ObjectIdentifier<>() == fast_ber::ObjectIdentifierComponents{});
+}
@@ -4,6 +4,10 @@
 
 #include <catch2/catch.hpp>
 
+#include <array>
+#include <utility>
+#include <vector>
+
 const static std::initializer_list<uint8_t> hello_world_packet = {0x04, 0x0B, 'H', 'e', 'l', 'l', 'o',
                                                                   ' ',  'w',  'o', 'r', 'l', 'd'};
 
@@ -141,3 +145,53 @@ TEST_CASE("OctetString: Tagging")
 
     static_assert(std::is_same<fast_ber::Identifier<TaggedOctetString>, Tag>::value, "Tagged Integer");
 }
+
+TEST_CASE("OctetString: Borrowed storage references decoded buffer")
+{
+    using BorrowedOctetString = fast_ber::OctetString<fast_ber::ExplicitId<fast_ber::UniversalTag::octet_string>,
+                                                      fast_ber::StorageMode::borrowed>;
+
+    const std::vector<uint8_t> buffer = hello_world_packet;
+    BorrowedOctetString        octet_string;
+
+    REQUIRE(octet_string == "");
+    REQUIRE(octet_string.decode(fast_ber::BerView(buffer)).success);
+    REQUIRE(octet_string == "Hello world");
+    REQUIRE(std::as_const(octet_string).data() == buffer.data() + 2);
+
+    const BorrowedOctetString copy = octet_string;
+    REQUIRE(copy.data() == buffer.data() + 2);
+
+    std::array<uint8_t, 100> output = {};
+    REQUIRE(copy.encode(output).success);
+    REQUIRE(std::equal(buffer.begin(), buffer.end(), output.begin()));
+
+    const fast_ber::OctetString<> owned = octet_string;
+    REQUIRE(owned == "Hello world");
+    REQUIRE(owned.data() != buffer.data() + 2);
+}
+
+TEST_CASE("OctetString: Borrowed storage copies when made owned")
+{
+    using BorrowedOctetString =
+        fast_ber::OctetString<fast_ber::Id<fast_ber::Class::context_specific, 0>, fast_ber::StorageMode::borrowed>;
+
+    std::vector<uint8_t> buffer = {0x80, 0x03, 'a', 'b', 'c'};
+    BorrowedOctetString  octet_string{fast_ber::BerView(buffer)};
+
+    octet_string.make_owned();
+    REQUIRE(octet_string.data() != buffer.data() + 2);
+    buffer[2] = 'x';
+    REQUIRE(octet_string == "abc");
+
+    octet_string.resize(1);
+    REQUIRE(octet_string == "a");
+
+    octet_string = "A longer string which is not borrowed";
+    const BorrowedOctetString copy = octet_string;
+    REQUIRE(copy == "A longer string which is not borrowed");
+    REQUIRE(copy.data() != octet_string.data());
+
+    octet_string.assign(std::span<const uint8_t>(octet_string.data() + 2, 6));
+    REQUIRE(octet_string == "longer");
+}
@@ -4,8 +4,12 @@
 
 #include <catch2/catch.hpp>
 
+#include <bit>
+#include <cmath>
 #include <limits>
+#include <random>
 #include <sstream>
+#include <string>
 
 TEST_CASE("Real: Construction from double")
 {
@@ -83,6 +87,196 @@ TEST_CASE("Real: Decoding")
     }
 }
 
+TEST_CASE("Real: Binary decoding")
+{
+    std::vector<TestData> test_data = {
+        {{0x80, 0x00, 0x01}, 1.0},
+        {{0xC0, 0xFF, 0x03}, -1.5},
+        // Base 8, and base 16 with a scaling factor of 2
+        {{0x90, 0x01, 0x01}, 8.0},
+        {{0xA8, 0xFF, 0x03}, 0.75},
+        // Two octet exponent, and exponent length given in an octet
+        {{0x81, 0x01, 0x00, 0x01}, std::ldexp(1.0, 256)},
+        {{0x83, 0x01, 0x01, 0x01}, 2.0},
+        // Leading zero mantissa octets, and mantissas longer than 8 octets
+        {{0x80, 0x00, 0x00, 0x00, 0x05}, 5.0},
+        {{0x80, 0x00, 0x01, 0, 0, 0, 0, 0, 0, 0, 0}, std::ldexp(1.0, 64)},
+        // 2^53 + 1 and 2^53 + 3 round to even, unless octets beyond the first 8 are non zero
+        {{0x80, 0x00, 0x20, 0, 0, 0, 0, 0, 0x01}, 9007199254740992.0},
+        {{0x80, 0x00, 0x20, 0, 0, 0, 0, 0, 0x03}, 9007199254740996.0},
+        {{0x80, 0x00, 0x20, 0, 0, 0, 0, 0, 0x01, 0, 0, 0, 0, 0, 0, 0, 0x01}, std::ldexp(9007199254740994.0, 64)},
+        // Subnormal values, 1.5 times the smallest rounds to even
+        {{0x81, 0xFB, 0xCE, 0x01}, std::numeric_limits<double>::denorm_min()},
+        {{0x81, 0xFB, 0xCD, 0x03}, 2 * std::numeric_limits<double>::denorm_min()},
+        // Overflow and underflow
+        {{0x81, 0x7F, 0xFF, 0x01}, std::numeric_limits<double>::infinity()},
+        {{0xC1, 0x7F, 0xFF, 0x01}, -std::numeric_limits<double>::infinity()},
+        {{0x81, 0x80, 0x00, 0x01}, 0.0},
+    };
+
+    for (const TestData& test : test_data)
+    {
+        INFO(test.value);
+        double decoded = 0;
+        REQUIRE(fast_ber::decode_real(test.data, decoded));
+        REQUIRE(std::bit_cast<uint64_t>(decoded) == std::bit_cast<uint64_t>(test.value));
+    }
+
+    const std::vector<std::vector<uint8_t>> invalid = {
+        {0x80, 0x00},                                     // No mantissa
+        {0xB0, 0x00, 0x01},                               // Reserved base
+        {0x80, 0x00, 0x00},                               // Zero mantissa
+        {0x81, 0x00, 0x01, 0x01},                         // Exponent starts with 9 identical bits
+        {0x83, 0x05, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01}, // Exponent too long
+        {0x43, 0x00},                                     // Special value with trailing octets
+        {0x44},                                           // Unknown special value
+    };
+    for (const std::vector<uint8_t>& data : invalid)
+    {
+        double decoded = 0;
+        REQUIRE(!fast_ber::decode_real(data, decoded));
+    }
+}
+
+TEST_CASE("Real: Decimal decoding")
+{
+    auto decode_decimal = [](uint8_t form, const std::string& number, double& output) {
+        std::vector<uint8_t> data = {form};
+        data.insert(data.end(), number.begin(), number.end());
+        return fast_ber::decode_real(data, output);
+    };
+
+    const std::vector<std::pair<std::string, double>> valid = {
+        {"0", 0.0},        {"  42", 42.0},   {"-7", -7.0},        {"+7", 7.0},         {"1.5", 1.5},
+        {"1,5", 1.5},      {".5", 0.5},      {"5.", 5.0},         {"-0,25", -0.25},    {"1.E3", 1000.0},
+        {"2,5e-1", 0.25},  {"+1.0E+2", 100}, {"6.5e30", 6.5e30},  {"1.e400", HUGE_VAL}, {"1.e-400", 0.0},
+    };
+    for (const auto& [number, value] : valid)
+    {
+        INFO(number);
+        double decoded = -1;
+        REQUIRE(decode_decimal(0x03, number, decoded));
+        REQUIRE(std::bit_cast<uint64_t>(decoded) == std::bit_cast<uint64_t>(value));
+    }
+
+    const std::vector<std::string> invalid = {"",     " ",   "-",   ".",    "1.2.3", "1 ",  "abc", "1e5",
+                                              "1.e",  "+-1", "--1", "1.5x", "inf",   "nan", "0x1", "1,e+"};
+    for (const std::string& number : invalid)
+    {
+        INFO(number);
+        double decoded = 0;
+        REQUIRE(!decode_decimal(0x03, number, decoded));
+    }
+
+    double decoded = 0;
+    REQUIRE(!decode_decimal(0x04, "1", decoded)); // Reserved form
+    REQUIRE(!decode_decimal(0x00, "1", decoded));
+}
+
+TEST_CASE("Real: Binary encoding")
+{
+    const std::vector<TestData> test_data = {
+        {{}, 0.0},
+        {{0x43}, -0.0},
+        {{0x40}, std::numeric_limits<double>::infinity()},
+        {{0x41}, -std::numeric_limits<double>::infinity()},
+        {{0x42}, std::numeric_limits<double>::quiet_NaN()},
+        {{0x80, 0x00, 0x01}, 1.0},
+        {{0xC0, 0x00, 0x03}, -3.0},
+        {{0x80, 0xFF, 0x01}, 0.5},
+        {{0x80, 0xFE, 0x05}, 1.25},
+        {{0x81, 0x03, 0xCB, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF}, std::numeric_limits<double>::max()},
+        {{0x81, 0xFC, 0x02, 0x01}, std::numeric_limits<double>::min()},
+        {{0x81, 0xFB, 0xCE, 0x01}, std::numeric_limits<double>::denorm_min()},
+    };
+
+    for (const TestData& test : test_data)
+    {
+        INFO(test.value);
+        std::array<uint8_t, fast_ber::detail::MaxBinaryEncodedLength> buffer{};
+        const size_t length = fast_ber::encode_real(buffer, test.value);
+        REQUIRE(std::vector<uint8_t>(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(length)) ==
+                test.data);
+        REQUIRE(fast_ber::encoded_real_length(test.value) == length);
+    }
+}
+
+TEST_CASE("Real: Round trip of random values")
+{
+    // Values are drawn from all bit patterns, covering subnormal, normal and special values
+    std::mt19937_64 generator(1234);
+    for (int i = 0; i < 100000; i++)
+    {
+        const uint64_t bits  = generator() >> (i % 3 == 0 ? 12 : 0);
+        const double   value = std::bit_cast<double>(bits);
+        INFO(bits);
+
+        std::array<uint8_t, fast_ber::detail::MaxBinaryEncodedLength> buffer{};
+        const size_t length  = fast_ber::encode_real(buffer, value);
+        double       decoded = 0;
+        REQUIRE(fast_ber::decode_real(std::span(buffer.data(), length), decoded));
+        if (std::isnan(value))
+        {
+            REQUIRE(std::isnan(decoded));
+        }
+        else
+        {
+            REQUIRE(std::bit_cast<uint64_t>(decoded) == bits);
+        }
+
+        // Decimal forms of the value decode to the same value
+        if (std::isfinite(value) && i % 10 == 0)
+        {
+            std::array<char, 64>         number{};
+            const std::to_chars_result   result = std::to_chars(number.data(), number.data() + number.size(), value,
+                                                                std::chars_format::scientific);
+            std::string                  nr3(number.data(), result.ptr);
+            if (nr3.find('.') == std::string::npos)
+            {
+                nr3.insert(nr3.find('e'), 1, '.');
+            }
+            std::vector<uint8_t> data = {0x03};
+            data.insert(data.end(), nr3.begin(), nr3.end());
+            REQUIRE(fast_ber::decode_real(data, decoded));
+            REQUIRE(std::bit_cast<uint64_t>(decoded) == bits);
+        }
+    }
+}
+
+TEST_CASE("Real: Native storage")
+{
+    using NativeReal =
+        fast_ber::Real<fast_ber::ExplicitId<fast_ber::UniversalTag::real>, fast_ber::StorageMode::native>;
+
+    for (double value : {0.0, -0.0, 1.0, -1234.5678, 1e-310, std::numeric_limits<double>::infinity()})
+    {
+        const fast_ber::Real<> stored(value);
+        const NativeReal       native(value);
+        REQUIRE(std::bit_cast<uint64_t>(native.value()) == std::bit_cast<uint64_t>(value));
+        REQUIRE(native.encoded_length() == stored.encoded_length());
+
+        std::array<uint8_t, 20> stored_buffer{};
+        std::array<uint8_t, 20> native_buffer{};
+        REQUIRE(stored.encode(stored_buffer).success);
+        REQUIRE(native.encode(native_buffer).success);
+        REQUIRE(stored_buffer == native_buffer);
+        REQUIRE(!native.encode(std::span(native_buffer.data(), native.encoded_length() - 1)).success);
+
+        NativeReal decoded;
+        REQUIRE(decoded.decode(fast_ber::BerView(stored_buffer)).success);
+        REQUIRE(std::bit_cast<uint64_t>(decoded.value()) == std::bit_cast<uint64_t>(value));
+
+        fast_ber::Real<> converted(native);
+        REQUIRE(converted == stored);
+        converted = NativeReal(2.5);
+        REQUIRE(converted == fast_ber::Real<>(2.5));
+    }
+
+    const uint8_t not_real[] = {0x02, 0x01, 0x01};
+    NativeReal    decoded;
+    REQUIRE(decoded.decode(fast_ber::BerView(not_real)).error == fast_ber::DecodeError::invalid_header);
+}
+
 TEST_CASE("Real: Default value") { REQUIRE(fast_ber::Real<>() == 0); }
 
 TEST_CASE("Real: Tagging")
@@ -8,6 +8,8 @@
 #include <catch2/catch.hpp>
 
 #include <array>
+#include <type_traits>
+#include <vector>
 
 template <typename T, typename Identifier>
 void test_sequences(const std::initializer_list<fast_ber::SequenceOf<T, Identifier>>& sequences)
@@ -83,3 +85,79 @@ TEST_CASE("SequenceOf: Encode decode string")
 
     test_sequences(sequences);
 }
+
+TEST_CASE("SequenceOf: Encode indefinite length")
+{
+    std::array<uint8_t, 100>                  buffer   = {};
+    fast_ber::SequenceOf<fast_ber::Integer<>> sequence = {1, 2, 3};
+    fast_ber::SequenceOf<fast_ber::Integer<>> copy;
+
+    fast_ber::EncodeResult encode_result = fast_ber::encode_indefinite(std::span(buffer), sequence);
+    REQUIRE(encode_result.success);
+    REQUIRE(encode_result.length == encoded_length(sequence) + 2);
+    REQUIRE(buffer[1] == 0x80);
+    REQUIRE(buffer[encode_result.length - 2] == 0x00);
+    REQUIRE(buffer[encode_result.length - 1] == 0x00);
+
+    fast_ber::BerView view(std::span(buffer.data(), encode_result.length));
+    REQUIRE(view.is_indefinite_length());
+    REQUIRE(copy.decode(view).success);
+    REQUIRE(copy == sequence);
+
+    REQUIRE(!fast_ber::encode_indefinite(std::span(buffer).first(encode_result.length - 1), sequence).success);
+}
+
+TEST_CASE("SequenceOf: Malformed elements")
+{
+    // Nested indefinite length sequence without end-of-contents octets
+    const std::array<uint8_t, 7> unterminated = {0x30, 0x05, 0x30, 0x80, 0x02, 0x01, 0x05};
+
+    using Nested = fast_ber::SequenceOf<fast_ber::SequenceOf<fast_ber::Integer<>>>;
+
+    Nested                       nested = {{1}};
+    const fast_ber::DecodeResult result = nested.decode(fast_ber::BerView(unterminated));
+    REQUIRE(!result.success);
+    REQUIRE(result.error == fast_ber::DecodeError::invalid_packet);
+    REQUIRE(result.offset == 2);
+    REQUIRE(nested.empty());
+
+    // Valid element followed by octets which are not a packet
+    const std::array<uint8_t, 6>              trailing = {0x30, 0x04, 0x02, 0x01, 0x05, 0x02};
+    fast_ber::SequenceOf<fast_ber::Integer<>> integers;
+    REQUIRE(integers.decode(fast_ber::BerView(trailing)).offset == 5);
+}
+
+TEST_CASE("SequenceOf: Small buffer storage")
+{
+    using Id              = fast_ber::ExplicitId<fast_ber::UniversalTag::sequence>;
+    using Sequence        = fast_ber::SequenceOf<fast_ber::Integer<>>;
+    using Small           = fast_ber::SequenceOf<fast_ber::Integer<>, Id, fast_ber::StorageMode::small_buffer_optimised, 2>;
+    using DynamicSequence = fast_ber::SequenceOf<fast_ber::Integer<>, Id, fast_ber::StorageMode::dynamic>;
+
+    static_assert(Sequence::Implementation::inline_size() == fast_ber::default_inline_capacity<fast_ber::Integer<>>());
+    static_assert(Small::Implementation::inline_size() == 2);
+    static_assert(std::is_same<DynamicSequence::Implementation,
+                               std::vector<fast_ber::Integer<>, fast_ber::ArenaAllocator<fast_ber::Integer<>>>>::value);
+
+    std::array<uint8_t, 100> buffer = {};
+    const Sequence           three  = {1, 2, 3};
+    REQUIRE(fast_ber::encode(std::span(buffer), three).success);
+
+    Sequence decoded;
+    REQUIRE(decoded.decode(fast_ber::BerView(buffer)).success);
+    REQUIRE(decoded == three);
+    REQUIRE(decoded.is_inline() == (three.size() <= Sequence::Implementation::inline_size()));
+
+    Small small;
+    REQUIRE(small.decode(fast_ber::BerView(buffer)).success);
+    REQUIRE(small == three);
+    REQUIRE(!small.is_inline());
+
+    const Small two = {1, 2};
+    REQUIRE(fast_ber::encode(std::span(buffer), two).success);
+    REQUIRE(small.decode(fast_ber::BerView(buffer)).success);
+    REQUIRE(small == two);
+
+    const DynamicSequence converted = small;
+    REQUIRE(converted == two);
+}
@@ -0,0 +1,141 @@
+#include "fast_ber/ber_types/Date.hpp"
+#include "fast_ber/ber_types/DateTime.hpp"
+#include "fast_ber/ber_types/OctetString.hpp"
+#include "fast_ber/ber_types/TimeOfDay.hpp"
+#include "fast_ber/util/DecodeHelpers.hpp"
+#include "fast_ber/util/EncodeHelpers.hpp"
+
+#ifdef FAST_BER_TEST_BOOST_TIME
+#include "fast_ber/util/BoostTime.hpp"
+#endif
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <chrono>
+#include <string>
+
+namespace
+{
+
+// Decode a time from an encoding with the given contents
+template <typename T>
+fast_ber::DecodeResult decode_content(const std::string& content, T& time)
+{
+    std::array<uint8_t, 100> buffer = {};
+    REQUIRE(fast_ber::encode(std::span(buffer), fast_ber::OctetString<typename T::AsnId>(content)).success);
+    return fast_ber::decode(std::span(buffer), time);
+}
+
+template <typename T>
+void check_round_trip(const T& time)
+{
+    std::array<uint8_t, 100> buffer = {};
+    T                        decoded;
+
+    const fast_ber::EncodeResult encode_result = fast_ber::encode(std::span(buffer), time);
+    REQUIRE(encode_result.success);
+    REQUIRE(encode_result.length == time.encoded_length());
+    REQUIRE(fast_ber::decode(std::span(buffer.data(), encode_result.length), decoded).success);
+    REQUIRE(decoded == time);
+    REQUIRE(decoded.string() == time.string());
+}
+
+} // namespace
+
+TEST_CASE("Date: Assign and decode")
+{
+    const std::chrono::sys_days day = std::chrono::year(2019) / 3 / 19;
+
+    fast_ber::Date<> date(day);
+    REQUIRE(date.string() == "2019-03-19");
+    REQUIRE(date.time() == day);
+    check_round_trip(date);
+
+    // The time of day is discarded
+    date = std::chrono::sys_seconds(day) + std::chrono::hours(23);
+    REQUIRE(date.time() == day);
+
+    REQUIRE(fast_ber::Date<>().string() == "1970-01-01");
+    REQUIRE(fast_ber::Date<>(std::chrono::year(12000) / 1 / 1).string() == "9999-12-31");
+
+    REQUIRE(decode_content("2020-02-29", date).success);
+    REQUIRE(date.time() == std::chrono::sys_days(std::chrono::year(2020) / 2 / 29));
+    for (const std::string content :
+         {"2019-02-29", "2019-13-01", "2019-00-10", "2019/03/19", "20190319", "2019-03-190"})
+    {
+        INFO(content);
+        REQUIRE(decode_content(content, date).error == fast_ber::DecodeError::invalid_content);
+        REQUIRE(date.string() == "2020-02-29");
+    }
+}
+
+TEST_CASE("TimeOfDay: Assign and decode")
+{
+    const std::chrono::seconds value = std::chrono::hours(21) + std::chrono::minutes(9) + std::chrono::seconds(42);
+
+    fast_ber::TimeOfDay<> time(value);
+    REQUIRE(time.string() == "21:09:42");
+    REQUIRE(time.time() == value);
+    check_round_trip(time);
+
+    REQUIRE(fast_ber::TimeOfDay<>().string() == "00:00:00");
+    REQUIRE(fast_ber::TimeOfDay<>(std::chrono::hours(30)).string() == "23:59:59");
+
+    REQUIRE(decode_content("23:59:59", time).success);
+    REQUIRE(time.time() == std::chrono::seconds(86399));
+    for (const std::string content : {"24:00:00", "12:60:00", "12:00:60", "12-00-00", "120000", "12:00:00Z"})
+    {
+        INFO(content);
+        REQUIRE(decode_content(content, time).error == fast_ber::DecodeError::invalid_content);
+    }
+}
+
+TEST_CASE("DateTime: Assign and decode")
+{
+    const std::chrono::sys_seconds value =
+        std::chrono::sys_days(std::chrono::year(2019) / 3 / 19) + std::chrono::seconds(76182);
+
+    fast_ber::DateTime<> time(value);
+    REQUIRE(time.string() == "2019-03-19T21:09:42");
+    REQUIRE(time.time() == value);
+    check_round_trip(time);
+
+    // Fractions of a second are discarded
+    time = value + std::chrono::milliseconds(900);
+    REQUIRE(time.time() == value);
+
+    REQUIRE(fast_ber::DateTime<>().string() == "1970-01-01T00:00:00");
+
+    for (const std::string content : {"2019-03-19 21:09:42", "2019-02-29T21:09:42", "2019-03-19T24:09:42",
+                                      "2019-03-19T21:09:42Z", "2019-03-19T21:09"})
+    {
+        INFO(content);
+        REQUIRE(decode_content(content, time).error == fast_ber::DecodeError::invalid_content);
+    }
+}
+
+TEST_CASE("Time: Identifiers")
+{
+    std::array<uint8_t, 100> buffer = {};
+
+    REQUIRE(fast_ber::encode(std::span(buffer), fast_ber::Date<>()).success);
+    REQUIRE(fast_ber::BerView(buffer).identifier() == fast_ber::RuntimeId{fast_ber::UniversalTag::date});
+    REQUIRE(fast_ber::encode(std::span(buffer), fast_ber::TimeOfDay<>()).success);
+    REQUIRE(fast_ber::BerView(buffer).identifier() == fast_ber::RuntimeId{fast_ber::UniversalTag::time_of_day});
+    REQUIRE(fast_ber::encode(std::span(buffer), fast_ber::DateTime<>()).success);
+    REQUIRE(fast_ber::BerView(buffer).identifier() == fast_ber::RuntimeId{fast_ber::UniversalTag::date_time});
+}
+
+#ifdef FAST_BER_TEST_BOOST_TIME
+TEST_CASE("Time: Boost conversions")
+{
+    const boost::posix_time::ptime time(boost::gregorian::date(2019, 3, 19),
+                                        boost::posix_time::time_duration(21, 9, 42) +
+                                            boost::posix_time::microseconds(250));
+    const fast_ber::TimePoint      point = fast_ber::to_time_point(time);
+
+    REQUIRE(point == fast_ber::TimePoint(std::chrono::seconds(1553029782)) + std::chrono::microseconds(250));
+    REQUIRE(fast_ber::to_ptime(point) == time);
+}
+#endif
@@ -0,0 +1,83 @@
+#include "fast_ber/compiler/GenerateRandom.hpp"
+#include "fast_ber/compiler/ResolveType.hpp"
+
+#include "catch2/catch.hpp"
+
+namespace
+{
+
+Type defined(const std::string& name) { return DefinedType{{}, name, {}}; }
+
+ComponentType required(const std::string& name, const Type& type)
+{
+    return ComponentType{{name, type}, false, {}, {}, {}};
+}
+
+Asn1Tree single_module(const std::vector<Assignment>& assignments)
+{
+    Asn1Tree tree;
+    tree.modules.push_back(Module{"Module", {}, {}, {}, assignments});
+    return tree;
+}
+
+const ChoiceType& choice(const Asn1Tree& tree, size_t assignment)
+{
+    return std::get<ChoiceType>(std::get<BuiltinType>(type(tree.modules[0].assignments[assignment])));
+}
+
+} // namespace
+
+TEST_CASE("GenerateRandom: Terminating alternative of a self referencing choice")
+{
+    // Expression ::= CHOICE { binary SEQUENCE { left Expression, right Expression }, leaf INTEGER }
+    SequenceType binary;
+    binary.components = {required("left", defined("Expression")), required("right", defined("Expression"))};
+
+    const Asn1Tree tree = single_module({
+        Assignment{"Expression",
+                   TypeAssignment{BuiltinType{ChoiceType{{{"binary", BuiltinType{binary}}, {"leaf", IntegerType{}}},
+                                                         StorageMode::dynamic}}},
+                   {},
+                   {}},
+    });
+
+    REQUIRE(random_terminating_alternative(tree, tree.modules[0], choice(tree, 0), random_depths(tree)) == 1);
+}
+
+TEST_CASE("GenerateRandom: Terminating alternatives of mutually recursive choices")
+{
+    // Taking the first alternative which can end would alternate between First and Second forever
+    const Asn1Tree tree = single_module({
+        Assignment{"First",
+                   TypeAssignment{BuiltinType{
+                       ChoiceType{{{"second", defined("Second")}, {"leaf", IntegerType{}}}, StorageMode::dynamic}}},
+                   {},
+                   {}},
+        Assignment{"Second",
+                   TypeAssignment{BuiltinType{
+                       ChoiceType{{{"first", defined("First")}, {"leaf", BooleanType{}}}, StorageMode::dynamic}}},
+                   {},
+                   {}},
+    });
+
+    REQUIRE(random_terminating_alternative(tree, tree.modules[0], choice(tree, 0), random_depths(tree)) == 1);
+    REQUIRE(random_terminating_alternative(tree, tree.modules[0], choice(tree, 1), random_depths(tree)) == 1);
+}
+
+TEST_CASE("GenerateRandom: Terminating alternative through a shallower type")
+{
+    // Outer takes the reference to Inner, whose values are shallower than the sequence wrapping it
+    SequenceType wrapped;
+    wrapped.components = {required("inner", defined("Inner"))};
+
+    const Asn1Tree tree = single_module({
+        Assignment{"Outer",
+                   TypeAssignment{BuiltinType{ChoiceType{
+                       {{"wrapped", BuiltinType{wrapped}}, {"inner", defined("Inner")}}, StorageMode::dynamic}}},
+                   {},
+                   {}},
+        Assignment{"Inner", TypeAssignment{BuiltinType{IntegerType{}}}, {}, {}},
+    });
+
+    REQUIRE(random_terminating_alternative(tree, tree.modules[0], choice(tree, 0), random_depths(tree)) == 1);
+}
@@ -0,0 +1,77 @@
+#include "autogen/set.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <string>
+#include <vector>
+
+// Built once for each of the counting and callback error policies, see test/CMakeLists.txt
+
+namespace
+{
+// SET { null, boolean FALSE, string "hi" }, missing the integer member
+const std::array<uint8_t, 11> missing_integer = {0x31, 0x09, 0x05, 0x00, 0x01, 0x01, 0x00, 0x0C, 0x02, 'h', 'i'};
+
+// SET { null, integer 50, boolean with two content octets, string "hi" }
+const std::array<uint8_t, 15> long_boolean = {0x31, 0x0D, 0x05, 0x00, 0x02, 0x01, 0x32, 0x01,
+                                              0x02, 0xFF, 0xFF, 0x0C, 0x02, 'h',  'i'};
+
+// SET { null, integer 50, string "hi" }
+const std::array<uint8_t, 11> valid = {0x31, 0x09, 0x05, 0x00, 0x02, 0x01, 0x32, 0x0C, 0x02, 'h', 'i'};
+
+void record(fast_ber::DecodeError error, const char* field, void* context)
+{
+    static_cast<std::vector<std::string>*>(context)->push_back(std::string(fast_ber::to_string(error)) + " " + field);
+}
+} // namespace
+
+#if FAST_BER_ERROR_POLICY == FAST_BER_ERROR_POLICY_COUNT
+
+TEST_CASE("ErrorPolicy: Decode errors of generated types are counted")
+{
+    std::vector<std::string> reported;
+    fast_ber::set_decode_error_callback(record, &reported);
+    fast_ber::reset_decode_error_counts();
+
+    fast_ber::Set_::Set_ set;
+    REQUIRE(fast_ber::decode(std::span(missing_integer), set).error == fast_ber::DecodeError::missing_member);
+    REQUIRE(fast_ber::decode(std::span(long_boolean), set).error == fast_ber::DecodeError::invalid_content);
+    REQUIRE(fast_ber::decode(std::span(long_boolean), set).error == fast_ber::DecodeError::invalid_content);
+    REQUIRE(fast_ber::decode(std::span(valid), set).success);
+
+    REQUIRE(fast_ber::decode_error_count(fast_ber::DecodeError::missing_member) == 1);
+    REQUIRE(fast_ber::decode_error_count(fast_ber::DecodeError::invalid_content) == 2);
+    REQUIRE(fast_ber::decode_error_count(fast_ber::DecodeError::unknown_member) == 0);
+    REQUIRE(reported.empty());
+
+    fast_ber::reset_decode_error_counts();
+    REQUIRE(fast_ber::decode_error_count(fast_ber::DecodeError::invalid_content) == 0);
+    fast_ber::set_decode_error_callback(nullptr);
+}
+
+#elif FAST_BER_ERROR_POLICY == FAST_BER_ERROR_POLICY_CALLBACK
+
+TEST_CASE("ErrorPolicy: Decode errors of generated types are passed to the callback")
+{
+    std::vector<std::string> reported;
+    fast_ber::set_decode_error_callback(record, &reported);
+    fast_ber::reset_decode_error_counts();
+
+    fast_ber::Set_::Set_ set;
+    REQUIRE(fast_ber::decode(std::span(missing_integer), set).error == fast_ber::DecodeError::missing_member);
+    REQUIRE(fast_ber::decode(std::span(long_boolean), set).error == fast_ber::DecodeError::invalid_content);
+    REQUIRE(fast_ber::decode(std::span(valid), set).success);
+
+    // Once removed the callback is no longer called
+    fast_ber::set_decode_error_callback(nullptr);
+    REQUIRE(!fast_ber::decode(std::span(missing_integer), set).success);
+
+    REQUIRE(reported == std::vector<std::string>{"missing member fast_ber::Set_::Set_.integer",
+                                                 "invalid content fast_ber::Set_::Set_.boolean"});
+    REQUIRE(fast_ber::decode_error_count(fast_ber::DecodeError::missing_member) == 0);
+}
+
+#else
+#error "The error policy tests are built with the COUNT or CALLBACK policy"
+#endif
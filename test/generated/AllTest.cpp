@@ -1,9 +1,12 @@
-#include "fast_ber/ber_types/All.hpp"
+﻿#include "fast_ber/ber_types/All.hpp"
 
 #include "autogen/all_types.hpp"
 
 #include <catch2/catch.hpp>
-#include <boost/date_time.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <random>
 
 namespace dflt
 {
@@ -38,6 +41,39 @@ struct IsDefault<fast_ber::Default<T, U>> : std::true_type
 {
 };
 
+// Records with only the mandatory members, or every member, present
+template <typename Record>
+Record make_record(bool with_optionals)
+{
+    Record record;
+    record.record_type              = 18;
+    record.served_imsi              = "imsi";
+    record.charging_id              = 1234567890;
+    record.duration                 = 3600;
+    record.cause_for_closing        = 16;
+    record.charging_characteristics = "cc";
+    if (with_optionals)
+    {
+        record.served_imei            = "imei";
+        record.access_point_name      = "apn";
+        record.record_sequence_number = 7;
+        record.node_id                = "node";
+        record.local_sequence_number  = 99;
+        record.apn_selection_mode     = Record::Apn_selection_modeValues::network_provided;
+        record.served_msisdn          = "msisdn";
+        record.roaming                = true;
+    }
+    return record;
+}
+
+template <typename T>
+T random_value(std::mt19937_64& rng)
+{
+    T value;
+    generate_random(value, rng, fast_ber::RandomProfile{});
+    return value;
+}
+
 template <typename T>
 void test_type(const T& a)
 {
@@ -114,15 +150,15 @@ TEST_CASE("AllTypes: Check all types share a unified interface")
     test_type(fast_ber::All::The_Boolean(true));
     test_type(fast_ber::All::The_CharacterString("TestString"));
     test_type(fast_ber::All::The_Choice(fast_ber::All::The_Choice::Member_one(true)));
-    // test_type(fast_ber::Date<>);
-    // test_type(fast_ber::DateTime<>);
+    test_type(fast_ber::All::The_Date(std::chrono::sys_days(std::chrono::year(2019) / 3 / 19)));
+    test_type(fast_ber::All::The_DateTime(std::chrono::floor<std::chrono::seconds>(std::chrono::system_clock::now())));
     test_type(fast_ber::Default<fast_ber::Integer<>, dflt::IntDefault>(dflt::IntDefault::get_value()));
     test_type(fast_ber::Default<fast_ber::All::The_Integer, dflt::IntDefault>(-123456));
     test_type(fast_ber::Default<fast_ber::All::The_OctetString, dflt::StringDefault>(dflt::StringDefault::get_value()));
     test_type(fast_ber::Default<fast_ber::OctetString<>, dflt::StringDefault>("Non default string value"));
     // test_type(fast_ber::Duration<>);
     test_type(fast_ber::All::The_Enum(fast_ber::All::The_Enum::Values::pear));
-    test_type(fast_ber::All::The_GeneralizedTime(boost::posix_time::microsec_clock::local_time()));
+    test_type(fast_ber::All::The_GeneralizedTime(std::chrono::system_clock::now()));
     test_type(fast_ber::All::The_Integer(5));
     test_type(fast_ber::All::The_Null());
     test_type(fast_ber::All::The_ObjectIdentifier(fast_ber::ObjectIdentifierComponents{1, 2, 500, 9999}));
@@ -137,7 +173,64 @@ TEST_CASE("AllTypes: Check all types share a unified interface")
                                    fast_ber::StorageMode::dynamic>({1, 4, 6, 100, 2555}));
     test_type(fast_ber::All::The_Set{"Hello", 42});
     test_type(fast_ber::All::The_SetOf({"A", "list", "of", "strings"}));
+    test_type(make_record<fast_ber::All::The_Record>(false));
+    test_type(make_record<fast_ber::All::The_Record>(true));
+    test_type(make_record<fast_ber::All::The_Record_Sequence>(false));
+    test_type(make_record<fast_ber::All::The_Record_Sequence>(true));
     // test_type(fast_ber::Time);
-    // test_type(fast_ber::TimeOfDay);
+    test_type(fast_ber::All::The_TimeOfDay(std::chrono::seconds(76182)));
     test_type(fast_ber::All::The_VisibleString("TestString"));
 }
+
+TEST_CASE("AllTypes: Random values")
+{
+    std::mt19937_64 rng(1);
+
+    for (int i = 0; i < 3; i++)
+    {
+        test_type(random_value<fast_ber::All::The_BitString>(rng));
+        test_type(random_value<fast_ber::All::The_Boolean>(rng));
+        test_type(random_value<fast_ber::All::The_CharacterString>(rng));
+        test_type(random_value<fast_ber::All::The_Choice>(rng));
+        test_type(random_value<fast_ber::All::The_Date>(rng));
+        test_type(random_value<fast_ber::All::The_DateTime>(rng));
+        test_type(random_value<fast_ber::Default<fast_ber::Integer<>, dflt::IntDefault>>(rng));
+        test_type(random_value<fast_ber::All::The_Duration>(rng));
+        test_type(random_value<fast_ber::All::The_Enum>(rng));
+        test_type(random_value<fast_ber::All::The_GeneralizedTime>(rng));
+        test_type(random_value<fast_ber::All::The_Integer>(rng));
+        test_type(random_value<fast_ber::All::The_Null>(rng));
+        test_type(random_value<fast_ber::All::The_ObjectIdentifier>(rng));
+        test_type(random_value<fast_ber::All::The_OctetString>(rng));
+        test_type(random_value<fast_ber::All::The_Real>(rng));
+        test_type(random_value<fast_ber::All::The_Sequence>(rng));
+        test_type(random_value<fast_ber::All::The_SequenceOf>(rng));
+        test_type(random_value<fast_ber::All::The_Set>(rng));
+        test_type(random_value<fast_ber::All::The_SetOf>(rng));
+        test_type(random_value<fast_ber::All::The_Record>(rng));
+        test_type(random_value<fast_ber::All::The_Record_Sequence>(rng));
+        test_type(random_value<fast_ber::All::The_Time>(rng));
+        test_type(random_value<fast_ber::All::The_TimeOfDay>(rng));
+        test_type(random_value<fast_ber::All::The_VisibleString>(rng));
+    }
+}
+
+TEST_CASE("AllTypes: Choice view of automatic tags")
+{
+    using View = fast_ber::All::The_Choice::View;
+
+    const std::array<uint8_t, 3> member_one = {0x80, 0x01, 0xFF};
+    const std::array<uint8_t, 2> member_two = {0x81, 0x00};
+    REQUIRE(View(fast_ber::BerView(member_one)).index() == 0);
+    REQUIRE(View(fast_ber::BerView(member_two)).index() == 1);
+
+    // Universal BOOLEAN shares its tag number with member_two, but is not an alternative under automatic tags
+    const std::array<uint8_t, 3> universal = {0x01, 0x01, 0xFF};
+    const View                   view{fast_ber::BerView(universal)};
+    REQUIRE(view.index() == 2);
+    REQUIRE(!view.member_one().has_value());
+    REQUIRE(!view.member_two().has_value());
+
+    fast_ber::All::The_Choice choice;
+    REQUIRE(!fast_ber::decode(std::span(universal), choice).success);
+}
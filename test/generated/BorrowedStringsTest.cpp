@@ -0,0 +1,153 @@
+#include "autogen/borrowed_strings.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <utility>
+#include <vector>
+
+template <typename String>
+bool references(const String& string, const std::vector<uint8_t>& buffer)
+{
+    const uint8_t* data = std::as_const(string).data();
+    return data >= buffer.data() && data + string.size() <= buffer.data() + buffer.size();
+}
+
+template <typename String>
+constexpr bool has_c_str = requires(const String& string) { string.c_str(); };
+
+template <typename String>
+constexpr bool has_mutable_data = requires(String& string) {
+    { string.data() } -> std::same_as<uint8_t*>;
+};
+
+fast_ber::BorrowedStrings::Message make_message()
+{
+    fast_ber::BorrowedStrings::Message message;
+    message.name     = "name";
+    message.payload  = "payload";
+    message.flags    = "flags";
+    message.tagged   = "tagged";
+    message.comment  = "comment";
+    message.list     = {"first", "second"};
+    message.alt      = fast_ber::BorrowedStrings::Message::Alt::Text("text");
+    return message;
+}
+
+TEST_CASE("BorrowedStrings: Decoded strings reference the input buffer")
+{
+    const fast_ber::BorrowedStrings::Message message = make_message();
+
+    std::vector<uint8_t> buffer(message.encoded_length());
+    REQUIRE(fast_ber::encode(std::span(buffer), message).success);
+
+    fast_ber::BorrowedStrings::Message decoded;
+    REQUIRE(fast_ber::decode(std::span(buffer), decoded).success);
+    REQUIRE(decoded == message);
+
+    REQUIRE(references(decoded.name, buffer));
+    REQUIRE(references(decoded.payload, buffer));
+    REQUIRE(references(decoded.flags, buffer));
+    REQUIRE(references(decoded.tagged, buffer));
+    REQUIRE(references(*decoded.comment, buffer));
+    REQUIRE(references(decoded.list[0], buffer));
+    REQUIRE(references(decoded.list[1], buffer));
+    REQUIRE(references(fast_ber::get<0>(std::as_const(decoded).alt), buffer));
+
+    const fast_ber::BorrowedStrings::Message copy = decoded;
+    REQUIRE(references(copy.name, buffer));
+
+    std::vector<uint8_t> reencoded(copy.encoded_length());
+    REQUIRE(fast_ber::encode(std::span(reencoded), copy).success);
+    REQUIRE(reencoded == buffer);
+}
+
+TEST_CASE("BorrowedStrings: Modified strings do not alter the input buffer")
+{
+    const fast_ber::BorrowedStrings::Message message = make_message();
+
+    std::vector<uint8_t> buffer(message.encoded_length());
+    REQUIRE(fast_ber::encode(std::span(buffer), message).success);
+    const std::vector<uint8_t> original = buffer;
+
+    fast_ber::BorrowedStrings::Message decoded;
+    REQUIRE(fast_ber::decode(std::span(buffer), decoded).success);
+
+    decoded.payload = "replaced payload";
+    REQUIRE(decoded.payload == "replaced payload");
+    REQUIRE(!references(decoded.payload, buffer));
+    REQUIRE(references(decoded.flags, buffer));
+    REQUIRE(buffer == original);
+}
+
+TEST_CASE("BorrowedStrings: Borrowed strings are copied only when made owned")
+{
+    const fast_ber::BorrowedStrings::Message message = make_message();
+    static_assert(!has_mutable_data<decltype(fast_ber::BorrowedStrings::Message::name)>);
+    static_assert(has_mutable_data<decltype(fast_ber::BorrowedStrings::OwnedMessage::name)>);
+
+    std::vector<uint8_t> buffer(message.encoded_length());
+    REQUIRE(fast_ber::encode(std::span(buffer), message).success);
+
+    fast_ber::BorrowedStrings::Message decoded;
+    REQUIRE(fast_ber::decode(std::span(buffer), decoded).success);
+
+    // Access through a non const string still references the input buffer
+    REQUIRE(decoded.name.data() == std::as_const(decoded.name).data());
+    REQUIRE(references(decoded.name, buffer));
+
+    decoded.name.make_owned();
+    REQUIRE(!references(decoded.name, buffer));
+    REQUIRE(references(decoded.payload, buffer));
+
+    // The input buffer may then be released
+    std::fill(buffer.begin(), buffer.end(), 0);
+    REQUIRE(decoded.name == "name");
+}
+
+TEST_CASE("BorrowedStrings: Unselected types copy decoded strings")
+{
+    const fast_ber::BorrowedStrings::OwnedMessage message{"name", "payload"};
+
+    std::vector<uint8_t> buffer(message.encoded_length());
+    REQUIRE(fast_ber::encode(std::span(buffer), message).success);
+
+    fast_ber::BorrowedStrings::OwnedMessage decoded;
+    REQUIRE(fast_ber::decode(std::span(buffer), decoded).success);
+    REQUIRE(decoded == message);
+    REQUIRE(!references(decoded.name, buffer));
+    REQUIRE(!references(decoded.payload, buffer));
+
+    std::vector<uint8_t> label_buffer = {0x13, 0x03, 'a', 'b', 'c'};
+    fast_ber::BorrowedStrings::Label label;
+    REQUIRE(fast_ber::decode(std::span(label_buffer), label).success);
+    REQUIRE(label == "abc");
+    REQUIRE(references(label, label_buffer));
+}
+
+TEST_CASE("BorrowedStrings: Only owned strings are NUL terminated C strings")
+{
+    const fast_ber::BorrowedStrings::Message      message = make_message();
+    const fast_ber::BorrowedStrings::OwnedMessage owned{"name", "payload"};
+    static_assert(!has_c_str<decltype(message.name)>);
+    static_assert(has_c_str<decltype(owned.name)>);
+
+    // Borrowed contents are followed by the remainder of the decoded buffer
+    std::vector<uint8_t> buffer(message.encoded_length());
+    REQUIRE(fast_ber::encode(std::span(buffer), message).success);
+
+    fast_ber::BorrowedStrings::Message decoded;
+    REQUIRE(fast_ber::decode(std::span(buffer), decoded).success);
+    REQUIRE(std::string_view(decoded.name) == "name");
+    REQUIRE(decoded.name.value() == "name");
+    REQUIRE(std::as_const(decoded.name).data()[decoded.name.size()] != '\0');
+
+    std::vector<uint8_t> owned_buffer(owned.encoded_length());
+    REQUIRE(fast_ber::encode(std::span(owned_buffer), owned).success);
+
+    fast_ber::BorrowedStrings::OwnedMessage owned_decoded;
+    REQUIRE(fast_ber::decode(std::span(owned_buffer), owned_decoded).success);
+    REQUIRE(std::string_view(owned_decoded.name.c_str()) == "name");
+}
@@ -271,3 +271,57 @@ TEST_CASE("Choice: Inplace")
     fast_ber::SimpleChoice::Simple choice(fast_ber::in_place_index_t<1>{}, "Test string");
     CHECK(fast_ber::get<1>(choice) == "Test string");
 }
+
+TEST_CASE("Choice: Reverse encode")
+{
+    std::array<uint8_t, 100> forward_buffer = {};
+    std::array<uint8_t, 100> reverse_buffer = {};
+
+    fast_ber::MakeAChoice::Collection collection;
+    collection.the_choice = fast_ber::MakeAChoice::Collection::The_choice::Integer(5);
+
+    fast_ber::EncodeResult forward_result = fast_ber::encode(std::span(forward_buffer), collection);
+    fast_ber::EncodeResult reverse_result = fast_ber::encode_reverse(std::span(reverse_buffer), collection);
+
+    REQUIRE(reverse_result.success);
+    REQUIRE(reverse_result.length == forward_result.length);
+    REQUIRE(std::ranges::equal(std::span(forward_buffer).first(forward_result.length),
+                               std::span(reverse_buffer).last(reverse_result.length)));
+
+    fast_ber::ExplicitChoice::MyChoice choice = fast_ber::ExplicitChoice::MyChoice::Sequence{};
+
+    forward_result = fast_ber::encode(std::span(forward_buffer), choice);
+    reverse_result = fast_ber::encode_reverse(std::span(reverse_buffer), choice);
+
+    REQUIRE(reverse_result.success);
+    REQUIRE(reverse_result.length == forward_result.length);
+    REQUIRE(std::ranges::equal(std::span(forward_buffer).first(forward_result.length),
+                               std::span(reverse_buffer).last(reverse_result.length)));
+}
+
+TEST_CASE("Choice: Gather encode")
+{
+    std::array<uint8_t, 100> forward_buffer = {};
+    fast_ber::GatherBuffer   gather;
+
+    fast_ber::MakeAChoice::Collection collection;
+    collection.the_choice = fast_ber::MakeAChoice::Collection::The_choice::Integer(5);
+
+    fast_ber::EncodeResult forward_result = fast_ber::encode(std::span(forward_buffer), collection);
+    fast_ber::EncodeResult gather_result  = fast_ber::encode(gather, collection);
+
+    REQUIRE(gather_result.success);
+    REQUIRE(gather_result.length == forward_result.length);
+    REQUIRE(gather.segments().size() == 1);
+    REQUIRE(std::ranges::equal(std::span(forward_buffer).first(forward_result.length), gather.segments()[0]));
+
+    fast_ber::ExplicitChoice::MyChoice choice = fast_ber::ExplicitChoice::MyChoice::Sequence{};
+
+    forward_result = fast_ber::encode(std::span(forward_buffer), choice);
+    gather_result  = fast_ber::encode(gather, choice);
+
+    REQUIRE(gather_result.success);
+    REQUIRE(gather_result.length == forward_result.length);
+    REQUIRE(gather.segments().size() == 1);
+    REQUIRE(std::ranges::equal(std::span(forward_buffer).first(forward_result.length), gather.segments()[0]));
+}
@@ -4,6 +4,8 @@
 
 #include "catch2/catch.hpp"
 
+#include <random>
+
 TEST_CASE("Circular Types: Optional Members")
 {
     fast_ber::Circular::CircularSequence1 copy;
@@ -97,4 +99,45 @@ TEST_CASE("Circular Types: Choice Self Reference")
     CHECK(fast_ber::get<0>(fast_ber::get<1>(fast_ber::get<1>(fast_ber::get<1>(copy)))) == "Hello!");
 }
 
+TEST_CASE("Circular Types: Random Values")
+{
+    // Alternatives and elements keep recursing until the maximum depth, where the generated values must end
+    fast_ber::RandomProfile profile;
+    profile.max_depth                       = 8;
+    profile.optional_probability            = 1.0;
+    profile.sequence_of_length              = {1, 3};
+    profile.choice_weights["Expression"]    = {1.0, 1.0, 0.0};
+    profile.choice_weights["SelfReference"] = {0.0, 1.0};
+
+    std::mt19937_64 rng(1);
+    for (int i = 0; i < 20; i++)
+    {
+        fast_ber::Circular::Expression        expression;
+        fast_ber::Circular::SelfReference     self;
+        fast_ber::Circular::CircularSequence1 sequence;
+        generate_random(expression, rng, profile);
+        generate_random(self, rng, profile);
+        generate_random(sequence, rng, profile);
+
+        fast_ber::Circular::Expression        expression_copy;
+        fast_ber::Circular::SelfReference     self_copy;
+        fast_ber::Circular::CircularSequence1 sequence_copy;
+
+        std::vector<uint8_t> buffer(fast_ber::encoded_length(expression));
+        CHECK(fast_ber::encode(std::span<uint8_t>(buffer), expression).success);
+        CHECK(fast_ber::decode(std::span<uint8_t>(buffer), expression_copy).success);
+        CHECK(expression_copy == expression);
+
+        buffer.resize(fast_ber::encoded_length(self));
+        CHECK(fast_ber::encode(std::span<uint8_t>(buffer), self).success);
+        CHECK(fast_ber::decode(std::span<uint8_t>(buffer), self_copy).success);
+        CHECK(self_copy == self);
+
+        buffer.resize(fast_ber::encoded_length(sequence));
+        CHECK(fast_ber::encode(std::span<uint8_t>(buffer), sequence).success);
+        CHECK(fast_ber::decode(std::span<uint8_t>(buffer), sequence_copy).success);
+        CHECK(sequence_copy == sequence);
+    }
+}
+
 #endif
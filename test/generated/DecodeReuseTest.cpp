@@ -0,0 +1,94 @@
+#include "autogen/decode_reuse.hpp"
+
+#include "fast_ber/util/Arena.hpp"
+
+#include "util/CountingResource.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+fast_ber::DecodeReuse::Record make_record(size_t size, bool text)
+{
+    fast_ber::DecodeReuse::Record record;
+    record.name = std::string(40 + size, 'n');
+    for (size_t i = 0; i < size; i++)
+    {
+        record.values.push_back(static_cast<int64_t>(i * 1000));
+        record.labels.push_back(std::string(30 + i, 'l'));
+    }
+    if (text)
+    {
+        record.payload.emplace<1>(std::string(50, 't'));
+        fast_ber::DecodeReuse::Record parent;
+        parent.name = std::string(35, 'p');
+        parent.payload.emplace<0>(5);
+        record.parent = parent;
+    }
+    else
+    {
+        record.payload.emplace<2>().inner.emplace<0>(static_cast<int64_t>(size));
+    }
+    return record;
+}
+
+std::vector<uint8_t> encode_records(size_t count, size_t size, bool text)
+{
+    fast_ber::DecodeReuse::Records records;
+    for (size_t i = 0; i < count; i++)
+    {
+        records.push_back(make_record(size + i, text));
+    }
+    std::vector<uint8_t> buffer(records.encoded_length());
+    REQUIRE(fast_ber::encode(std::span(buffer), records).success);
+    return buffer;
+}
+
+TEST_CASE("DecodeReuse: Decoding into a used object")
+{
+    const std::vector<uint8_t> large = encode_records(6, 4, true);
+    const std::vector<uint8_t> small = encode_records(2, 1, false);
+
+    fast_ber::DecodeReuse::Records expected_large;
+    fast_ber::DecodeReuse::Records expected_small;
+    REQUIRE(fast_ber::decode(std::span(large), expected_large).success);
+    REQUIRE(fast_ber::decode(std::span(small), expected_small).success);
+    REQUIRE(expected_large.size() == 6);
+    REQUIRE(expected_small.size() == 2);
+
+    // Each decode replaces the whole value, whatever the shape of the previous packet
+    fast_ber::DecodeReuse::Records records;
+    for (int i = 0; i < 3; i++)
+    {
+        REQUIRE(fast_ber::decode(std::span(large), records).success);
+        REQUIRE(records == expected_large);
+        REQUIRE(fast_ber::decode(std::span(small), records).success);
+        REQUIRE(records == expected_small);
+    }
+}
+
+TEST_CASE("DecodeReuse: Decoding packets of the same shape does not allocate")
+{
+    const std::vector<uint8_t> first  = encode_records(6, 4, true);
+    std::vector<uint8_t>       second = first;
+    std::replace(second.begin(), second.end(), uint8_t('l'), uint8_t('m'));
+
+    CountingResource counter;
+    {
+        fast_ber::ArenaScope           scope(counter);
+        fast_ber::DecodeReuse::Records records;
+        REQUIRE(fast_ber::decode(std::span(first), records).success);
+        REQUIRE(counter.allocations > 0);
+
+        const size_t allocations = counter.allocations;
+        REQUIRE(fast_ber::decode(std::span(second), records).success);
+        REQUIRE(fast_ber::decode(std::span(first), records).success);
+        REQUIRE(counter.allocations == allocations);
+
+        fast_ber::DecodeReuse::Records expected;
+        REQUIRE(fast_ber::decode(std::span(first), expected).success);
+        REQUIRE(records == expected);
+    }
+}
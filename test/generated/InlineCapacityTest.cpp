@@ -0,0 +1,31 @@
+#include "autogen/inline_capacity.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <vector>
+
+static_assert(fast_ber::InlineCapacity::Record::Small::Implementation::inline_size() == 1);
+static_assert(fast_ber::InlineCapacity::Record::Large::Implementation::inline_size() == 8);
+static_assert(fast_ber::InlineCapacity::Record::Defaults::Implementation::inline_size() == 3);
+static_assert(fast_ber::InlineCapacity::Record::Numbers::Implementation::inline_size() == 16);
+static_assert(fast_ber::InlineCapacity::Alternatives::First::Implementation::inline_size() == 5);
+
+TEST_CASE("InlineCapacity: Decoded elements within capacity are stored inline")
+{
+    fast_ber::InlineCapacity::Record record;
+    record.small    = {1, 2};
+    record.large    = {"a", "b", "c", "d", "e", "f", "g", "h"};
+    record.defaults = {1, 2, 3};
+    record.numbers  = {-1, -2, -3, -4, -5};
+
+    std::vector<uint8_t> buffer(record.encoded_length());
+    REQUIRE(fast_ber::encode(std::span(buffer), record).success);
+
+    fast_ber::InlineCapacity::Record decoded;
+    REQUIRE(fast_ber::decode(std::span(buffer), decoded).success);
+    REQUIRE(decoded == record);
+    REQUIRE(!decoded.small.is_inline());
+    REQUIRE(decoded.large.is_inline());
+    REQUIRE(decoded.defaults.is_inline());
+    REQUIRE(decoded.numbers.is_inline());
+}
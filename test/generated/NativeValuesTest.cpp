@@ -0,0 +1,70 @@
+#include "autogen/native_values.hpp"
+
+#include "catch2/catch.hpp"
+
+#include <type_traits>
+#include <vector>
+
+static_assert(std::is_trivially_copyable<fast_ber::NativeValues::Record::Count>::value);
+static_assert(std::is_trivially_copyable<fast_ber::NativeValues::Record::Enabled>::value);
+static_assert(std::is_trivially_copyable<fast_ber::NativeValues::Record::Colour>::value);
+static_assert(std::is_trivially_copyable<fast_ber::NativeValues::Record::Offset>::value);
+static_assert(std::is_trivially_copyable<fast_ber::NativeValues::Record::Ratio>::value);
+
+template <typename Record>
+Record make_record(int64_t count)
+{
+    Record record;
+    record.count   = count;
+    record.enabled = true;
+    record.colour  = fast_ber::NativeValues::Colour::Values::blue;
+    record.offset  = -count;
+    record.limit   = 1000;
+    record.samples = {0, -1, 128, -129, 0x7FFFFFFFFFFFFFFF};
+    record.ratio   = static_cast<double>(count) / 8;
+    record.name    = "record";
+    return record;
+}
+
+TEST_CASE("NativeValues: Encoding matches ber storage")
+{
+    for (int64_t count : {int64_t(0), int64_t(127), int64_t(-128), int64_t(65535), int64_t(-4000000000)})
+    {
+        const auto native  = make_record<fast_ber::NativeValues::Record>(count);
+        const auto encoded = make_record<fast_ber::NativeValues::EncodedRecord>(count);
+
+        REQUIRE(native.encoded_length() == encoded.encoded_length());
+
+        std::vector<uint8_t> native_buffer(native.encoded_length());
+        std::vector<uint8_t> encoded_buffer(encoded.encoded_length());
+        REQUIRE(fast_ber::encode(std::span(native_buffer), native).success);
+        REQUIRE(fast_ber::encode(std::span(encoded_buffer), encoded).success);
+        REQUIRE(native_buffer == encoded_buffer);
+    }
+}
+
+TEST_CASE("NativeValues: Decode")
+{
+    const auto encoded = make_record<fast_ber::NativeValues::EncodedRecord>(-300);
+
+    std::vector<uint8_t> buffer(encoded.encoded_length());
+    REQUIRE(fast_ber::encode(std::span(buffer), encoded).success);
+
+    fast_ber::NativeValues::Record decoded;
+    REQUIRE(fast_ber::decode(std::span(buffer), decoded).success);
+    REQUIRE(decoded == make_record<fast_ber::NativeValues::Record>(-300));
+    REQUIRE(decoded.count == -300);
+    REQUIRE(decoded.enabled);
+    REQUIRE(decoded.colour == fast_ber::NativeValues::Colour::Values::blue);
+    REQUIRE(decoded.offset == 300);
+    REQUIRE(*decoded.limit == 1000);
+    REQUIRE(decoded.samples.size() == 5);
+    REQUIRE(decoded.samples[4] == 0x7FFFFFFFFFFFFFFF);
+    REQUIRE(decoded.ratio == -37.5);
+
+    buffer[buffer.size() - 1] = 'X';
+    fast_ber::NativeValues::EncodedRecord reencoded;
+    REQUIRE(fast_ber::decode(std::span(buffer), reencoded).success);
+    REQUIRE(reencoded.name == "recorX");
+    REQUIRE(reencoded.count == decoded.count);
+}
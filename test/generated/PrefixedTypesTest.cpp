@@ -4,14 +4,9 @@
 
 #include "catch2/catch.hpp"
 
+#include <algorithm>
 #include <vector>
 
-template <typename T, size_t n>
-bool operator==(std::span<T> l, std::array<uint8_t, n> r)
-{
-    return std::equal(l.begin(), l.end(), r.begin(), r.end());
-}
-
 TEST_CASE("Prefixed Types: Encoding, matching 8.14 of X.690")
 {
     std::array<uint8_t, 100> buffer_storage = {};
@@ -26,25 +21,25 @@ TEST_CASE("Prefixed Types: Encoding, matching 8.14 of X.690")
 
     res = fast_ber::encode(buffer, type1);
     REQUIRE(res.success);
-    REQUIRE(std::span(buffer.data(), 7) == std::array<uint8_t, 7>{0x1A, 0x05, 0x4A, 0x6F, 0x6E, 0x65, 0x73});
+    REQUIRE(std::ranges::equal(std::span(buffer.data(), 7), std::array<uint8_t, 7>{0x1A, 0x05, 0x4A, 0x6F, 0x6E, 0x65, 0x73}));
 
     res = fast_ber::encode(std::span(buffer.data(), buffer.size()), type2);
     REQUIRE(res.success);
-    REQUIRE(std::span(buffer.data(), 7) == std::array<uint8_t, 7>{0x43, 0x05, 0x4A, 0x6F, 0x6E, 0x65, 0x73});
+    REQUIRE(std::ranges::equal(std::span(buffer.data(), 7), std::array<uint8_t, 7>{0x43, 0x05, 0x4A, 0x6F, 0x6E, 0x65, 0x73}));
 
     res = fast_ber::encode(std::span(buffer.data(), buffer.size()), type3);
     REQUIRE(res.success);
-    REQUIRE(std::span(buffer.data(), 9) ==
-            std::array<uint8_t, 9>{0xA2, 0x07, 0x43, 0x05, 0x4A, 0x6F, 0x6E, 0x65, 0x73});
+    REQUIRE(std::ranges::equal(std::span(buffer.data(), 9),
+            std::array<uint8_t, 9>{0xA2, 0x07, 0x43, 0x05, 0x4A, 0x6F, 0x6E, 0x65, 0x73}));
 
     res = fast_ber::encode(buffer, type4);
     REQUIRE(res.success);
-    REQUIRE(std::span(buffer.data(), 9) ==
-            std::array<uint8_t, 9>{0x67, 0x07, 0x43, 0x05, 0x4A, 0x6F, 0x6E, 0x65, 0x73});
+    REQUIRE(std::ranges::equal(std::span(buffer.data(), 9),
+            std::array<uint8_t, 9>{0x67, 0x07, 0x43, 0x05, 0x4A, 0x6F, 0x6E, 0x65, 0x73}));
 
     res = fast_ber::encode(buffer, type5);
     REQUIRE(res.success);
-    REQUIRE(std::span(buffer.data(), 7) == std::array<uint8_t, 7>{0x82, 0x05, 0x4A, 0x6F, 0x6E, 0x65, 0x73});
+    REQUIRE(std::ranges::equal(std::span(buffer.data(), 7), std::array<uint8_t, 7>{0x82, 0x05, 0x4A, 0x6F, 0x6E, 0x65, 0x73}));
 }
 
 TEST_CASE("Prefixed Types: Prefixed Types in a Collection")
@@ -63,13 +58,13 @@ TEST_CASE("Prefixed Types: Prefixed Types in a Collection")
     res = fast_ber::encode(buffer, collection);
     REQUIRE(res.success);
     fast_ber::BerViewIterator itr = fast_ber::BerView(buffer).begin();
-    REQUIRE(itr->ber() == std::array<uint8_t, 7>{0x1A, 0x05, 0x4A, 0x6F, 0x6E, 0x65, 0x73});
+    REQUIRE(std::ranges::equal(itr->ber(), std::array<uint8_t, 7>{0x1A, 0x05, 0x4A, 0x6F, 0x6E, 0x65, 0x73}));
     ++itr;
-    REQUIRE(itr->ber() == std::array<uint8_t, 7>{0x43, 0x05, 0x4A, 0x6F, 0x6E, 0x65, 0x73});
+    REQUIRE(std::ranges::equal(itr->ber(), std::array<uint8_t, 7>{0x43, 0x05, 0x4A, 0x6F, 0x6E, 0x65, 0x73}));
     ++itr;
-    REQUIRE(itr->ber() == std::array<uint8_t, 9>{0xA2, 0x07, 0x43, 0x05, 0x4A, 0x6F, 0x6E, 0x65, 0x73});
+    REQUIRE(std::ranges::equal(itr->ber(), std::array<uint8_t, 9>{0xA2, 0x07, 0x43, 0x05, 0x4A, 0x6F, 0x6E, 0x65, 0x73}));
     ++itr;
-    REQUIRE(itr->ber() == std::array<uint8_t, 9>{0x67, 0x07, 0x43, 0x05, 0x4A, 0x6F, 0x6E, 0x65, 0x73});
+    REQUIRE(std::ranges::equal(itr->ber(), std::array<uint8_t, 9>{0x67, 0x07, 0x43, 0x05, 0x4A, 0x6F, 0x6E, 0x65, 0x73}));
     ++itr;
-    REQUIRE(itr->ber() == std::array<uint8_t, 7>{0x82, 0x05, 0x4A, 0x6F, 0x6E, 0x65, 0x73});
+    REQUIRE(std::ranges::equal(itr->ber(), std::array<uint8_t, 7>{0x82, 0x05, 0x4A, 0x6F, 0x6E, 0x65, 0x73}));
 }
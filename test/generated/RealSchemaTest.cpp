@@ -2,13 +2,10 @@
 
 #include "catch2/catch.hpp"
 
+#include <algorithm>
 #include <array>
-
-template <typename T, size_t n>
-bool operator==(std::span<T> l, std::array<uint8_t, n> r)
-{
-    return std::equal(l.begin(), l.end(), r.begin(), r.end());
-}
+#include <random>
+#include <vector>
 
 
 const fast_ber::SGSN_2009A_CDR::SGSNPDPRecord test_record = {
@@ -135,5 +132,76 @@ TEST_CASE("RealSchema: Expected Output")
 
     REQUIRE(fast_ber::encode(std::span<uint8_t>(buffer), record).success);
     REQUIRE(fast_ber::encoded_length(record) == test_record_expected_encoding.size());
-    REQUIRE(std::span(buffer.data(), test_record_expected_encoding.size()) == test_record_expected_encoding);
+    REQUIRE(std::ranges::equal(std::span(buffer.data(), test_record_expected_encoding.size()), test_record_expected_encoding));
+}
+
+namespace
+{
+
+void check_round_trip(const fast_ber::SGSN_2009A_CDR::CallEventRecord& record)
+{
+    std::vector<uint8_t>                       buffer(fast_ber::encoded_length(record));
+    std::vector<uint8_t>                       reencoded(buffer.size());
+    fast_ber::SGSN_2009A_CDR::CallEventRecord decoded;
+
+    REQUIRE(fast_ber::encode(std::span(buffer), record).length == buffer.size());
+    REQUIRE(fast_ber::decode(std::span<const uint8_t>(buffer), decoded).success);
+    REQUIRE(decoded == record);
+    REQUIRE(fast_ber::encode(std::span(reencoded), decoded).success);
+    REQUIRE(reencoded == buffer);
+}
+
+} // namespace
+
+TEST_CASE("RealSchema: Random records")
+{
+    std::mt19937_64                            rng(1);
+    fast_ber::RandomProfile                    profile;
+    fast_ber::SGSN_2009A_CDR::CallEventRecord record;
+
+    for (int i = 0; i < 200; i++)
+    {
+        fast_ber::SGSN_2009A_CDR::generate_random(record, rng, profile);
+        check_round_trip(record);
+    }
+
+    // The same seed generates the same records
+    std::mt19937_64                            first_rng(3);
+    std::mt19937_64                            second_rng(3);
+    fast_ber::SGSN_2009A_CDR::CallEventRecord first;
+    fast_ber::SGSN_2009A_CDR::CallEventRecord second;
+    fast_ber::SGSN_2009A_CDR::generate_random(first, first_rng, profile);
+    fast_ber::SGSN_2009A_CDR::generate_random(second, second_rng, profile);
+    REQUIRE(first == second);
+}
+
+TEST_CASE("RealSchema: Random record profile")
+{
+    std::mt19937_64                            rng(2);
+    fast_ber::RandomProfile                    profile;
+    fast_ber::SGSN_2009A_CDR::CallEventRecord record;
+
+    profile.choice_weights["CallEventRecord"]                  = {0.0, 1.0};
+    profile.optional_probability                               = 0.0;
+    profile.optional_probabilities["SGSNSMORecord.servedIMEI"] = 1.0;
+    profile.string_length                                      = {8, 8};
+    for (int i = 0; i < 20; i++)
+    {
+        fast_ber::SGSN_2009A_CDR::generate_random(record, rng, profile);
+        REQUIRE(record.index() == 1);
+
+        const fast_ber::SGSN_2009A_CDR::SGSNSMORecord& smo = fast_ber::get<1>(record);
+        REQUIRE(smo.servedIMSI.length() == 8);
+        REQUIRE(smo.servedIMEI.has_value());
+        REQUIRE(!smo.servedMSISDN.has_value());
+        check_round_trip(record);
+    }
+
+    profile.optional_probability              = 1.0;
+    profile.sequence_of_length                = {3, 3};
+    profile.choice_weights["CallEventRecord"] = {1.0};
+    fast_ber::SGSN_2009A_CDR::generate_random(record, rng, profile);
+    REQUIRE(record.index() == 0);
+    REQUIRE(fast_ber::get<0>(record).listOfTrafficVolumes->size() == 3);
+    check_round_trip(record);
 }
@@ -2,7 +2,9 @@
 
 #include "catch2/catch.hpp"
 
+#include <algorithm>
 #include <array>
+#include <string>
 
 TEST_CASE("Set: Empty")
 {
@@ -220,6 +222,8 @@ TEST_CASE("Set: Decode Fail - Missing Members")
 
     fast_ber::DecodeResult decode_result = fast_ber::decode(std::span(buffer.data(), buffer.size()), set);
     REQUIRE(!decode_result.success);
+    REQUIRE(decode_result.error == fast_ber::DecodeError::missing_member);
+    REQUIRE(std::string(decode_result.field) == "fast_ber::Set_::Set_.integer");
 }
 
 TEST_CASE("Set: Decode Fail - Duplicate Members")
@@ -247,3 +251,67 @@ TEST_CASE("Set: Decode Fail - Duplicate Members")
     fast_ber::DecodeResult decode_result = fast_ber::decode(std::span(buffer.data(), buffer.size()), set);
     REQUIRE(!decode_result.success);
 }
+
+TEST_CASE("Set: View Unordered")
+{
+    // Check that members of a set are found by a view regardless of their encoded order
+    std::array<uint8_t, 100> buffer = {};
+    fast_ber::Null<>         null;
+    fast_ber::Integer<>      integer    = 50;
+    fast_ber::UTF8String<>   utf_string = "View Unordered";
+
+    auto inner_buffer = std::span<uint8_t>(buffer);
+
+    inner_buffer = inner_buffer.subspan(utf_string.encode(inner_buffer).length);
+    inner_buffer = inner_buffer.subspan(integer.encode(inner_buffer).length);
+    inner_buffer = inner_buffer.subspan(null.encode(inner_buffer).length);
+
+    size_t content_length = buffer.size() - inner_buffer.size();
+    fast_ber::wrap_with_ber_header(std::span<uint8_t>(buffer), content_length,
+                                   fast_ber::ExplicitId<fast_ber::UniversalTag::set>());
+
+    const fast_ber::Set_::Set_::View view{fast_ber::BerView(std::span<const uint8_t>(buffer))};
+    REQUIRE(view.integer() == 50);
+    REQUIRE(view.string() == "View Unordered");
+    REQUIRE(!view.boolean().has_value());
+    REQUIRE(view.null() == null);
+}
+
+TEST_CASE("Set: Decode Fail - Error Location")
+{
+    // Check that the failing member, its offset and the kind of failure are reported
+    std::array<uint8_t, 100> buffer = {};
+    fast_ber::Set_::Set_     set    = {};
+    fast_ber::Null<>         null;
+    fast_ber::Integer<>      integer    = 50;
+    fast_ber::UTF8String<>   utf_string = "Decode Error";
+
+    auto inner_buffer = std::span<uint8_t>(buffer).subspan(2);
+
+    inner_buffer = inner_buffer.subspan(null.encode(inner_buffer).length);
+    inner_buffer = inner_buffer.subspan(integer.encode(inner_buffer).length);
+
+    // Boolean with two bytes of content
+    const size_t  boolean_offset = buffer.size() - inner_buffer.size();
+    const uint8_t bad_boolean[]  = {0x01, 0x02, 0xFF, 0xFF};
+    std::copy(std::begin(bad_boolean), std::end(bad_boolean), inner_buffer.begin());
+    inner_buffer = inner_buffer.subspan(sizeof(bad_boolean));
+    inner_buffer = inner_buffer.subspan(utf_string.encode(inner_buffer).length);
+
+    size_t content_length = buffer.size() - inner_buffer.size() - 2;
+    fast_ber::encode_header(std::span<uint8_t>(buffer), content_length,
+                            fast_ber::ExplicitId<fast_ber::UniversalTag::set>(), fast_ber::Construction::constructed);
+
+    fast_ber::DecodeResult decode_result = fast_ber::decode(std::span(buffer.data(), buffer.size()), set);
+    REQUIRE(!decode_result.success);
+    REQUIRE(decode_result.error == fast_ber::DecodeError::invalid_content);
+    REQUIRE(decode_result.offset == boolean_offset);
+    REQUIRE(std::string(decode_result.field) == "fast_ber::Set_::Set_.boolean");
+
+    // Unknown members are located within the set
+    buffer[boolean_offset] = 0x09;
+    decode_result = fast_ber::decode(std::span(buffer.data(), buffer.size()), set);
+    REQUIRE(!decode_result.success);
+    REQUIRE(decode_result.error == fast_ber::DecodeError::unknown_member);
+    REQUIRE(decode_result.offset == boolean_offset);
+}
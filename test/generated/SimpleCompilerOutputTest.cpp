@@ -2,6 +2,8 @@
 
 #include "catch2/catch.hpp"
 
+#include <algorithm>
+#include <iostream>
 #include <vector>
 
 TEST_CASE("SimpleCompilerOutput: Testing a generated ber container")
@@ -47,3 +49,163 @@ TEST_CASE("SimpleCompilerOutput: Testing a generated ber container")
 
     std::cout << "fast_ber::Simple::Collection: " << collection << std::endl;
 }
+
+TEST_CASE("SimpleCompilerOutput: Reverse encode matches forward encode")
+{
+    std::array<uint8_t, 5000> forward_buffer = {};
+    std::array<uint8_t, 5000> reverse_buffer = {};
+
+    fast_ber::Simple::Collection collection{
+        "Hello world!",
+        "Good bye world!",
+        5,
+        true,
+        fast_ber::Simple::Child{-42, {}},
+        fast_ber::Simple::Child{999999999, {"The", "second", "child", std::string(2000, 'x')}},
+        decltype(collection.the_choice){fast_ber::in_place_index_t<1>(), "I chose a string!"}};
+
+    fast_ber::EncodeResult forward_result = fast_ber::encode(std::span(forward_buffer), collection);
+    fast_ber::EncodeResult reverse_result = fast_ber::encode_reverse(std::span(reverse_buffer), collection);
+
+    REQUIRE(forward_result.success);
+    REQUIRE(reverse_result.success);
+    REQUIRE(reverse_result.length == forward_result.length);
+    REQUIRE(std::ranges::equal(std::span(forward_buffer).first(forward_result.length),
+                               std::span(reverse_buffer).last(reverse_result.length)));
+
+    std::array<uint8_t, 10> small_buffer = {};
+    REQUIRE(!fast_ber::encode_reverse(std::span(small_buffer), collection).success);
+}
+
+TEST_CASE("SimpleCompilerOutput: Gather encode matches forward encode")
+{
+    std::array<uint8_t, 5000> forward_buffer = {};
+
+    fast_ber::Simple::Collection collection{
+        "Hello world!",
+        "Good bye world!",
+        5,
+        true,
+        fast_ber::Simple::Child{-42, {}},
+        fast_ber::Simple::Child{999999999, {"The", "second", "child", std::string(2000, 'x')}},
+        decltype(collection.the_choice){fast_ber::in_place_index_t<1>(), "I chose a string!"}};
+
+    fast_ber::GatherBuffer gather;
+    fast_ber::EncodeResult forward_result = fast_ber::encode(std::span(forward_buffer), collection);
+    fast_ber::EncodeResult gather_result  = fast_ber::encode(gather, collection);
+
+    REQUIRE(forward_result.success);
+    REQUIRE(gather_result.success);
+    REQUIRE(gather_result.length == forward_result.length);
+    REQUIRE(gather.length() == forward_result.length);
+
+    std::vector<uint8_t> joined;
+    for (std::span<const uint8_t> segment : gather.segments())
+    {
+        joined.insert(joined.end(), segment.begin(), segment.end());
+    }
+    REQUIRE(std::ranges::equal(std::span(forward_buffer).first(forward_result.length), joined));
+
+    // Headers and small members are combined, the large string is referenced where it is stored
+    const fast_ber::OctetString<>& large = collection.optional_child->list[3];
+    REQUIRE(gather.segments().size() == 3);
+    REQUIRE(gather.segments()[1].data() + gather.segments()[1].size() == large.data() + large.size());
+    REQUIRE(gather.iovecs().size() == 3);
+    REQUIRE(gather.iovecs()[1].iov_len == large.encoded_length());
+
+    fast_ber::GatherBuffer small_scratch(10);
+    REQUIRE(!fast_ber::encode(small_scratch, collection).success);
+    REQUIRE(small_scratch.segments().empty());
+}
+
+TEST_CASE("SimpleCompilerOutput: Indefinite length encode decode")
+{
+    std::array<uint8_t, 5000> buffer = {};
+
+    fast_ber::Simple::Collection collection{
+        "Hello world!",
+        "Good bye world!",
+        5,
+        true,
+        fast_ber::Simple::Child{-42, {}},
+        fast_ber::Simple::Child{999999999, {"The", "second", "child", std::string(2000, 'x')}},
+        decltype(collection.the_choice){fast_ber::in_place_index_t<1>(), "I chose a string!"}};
+    fast_ber::Simple::Collection copy;
+
+    fast_ber::EncodeResult encode_result = fast_ber::encode_indefinite(std::span(buffer), collection);
+    REQUIRE(encode_result.success);
+    REQUIRE(buffer[1] == 0x80);
+
+    fast_ber::BerView view(std::span(buffer.data(), encode_result.length));
+    REQUIRE(view.is_valid());
+    REQUIRE(view.ber_length() == encode_result.length);
+    REQUIRE(copy.decode(view).success);
+    REQUIRE(copy == collection);
+}
+
+TEST_CASE("SimpleCompilerOutput: View reads members without decoding")
+{
+    std::array<uint8_t, 5000> buffer = {};
+
+    fast_ber::Simple::Collection collection{
+        "Hello world!",
+        "Good bye world!",
+        5,
+        true,
+        fast_ber::Simple::Child{-42, {}},
+        fast_ber::Simple::Child{999999999, {"The", "second", "child"}},
+        decltype(collection.the_choice){fast_ber::in_place_index_t<1>(), "I chose a string!"}};
+
+    fast_ber::EncodeResult encode_result = fast_ber::encode(std::span(buffer), collection);
+    REQUIRE(encode_result.success);
+
+    const fast_ber::Simple::Collection::View view{fast_ber::BerView(std::span(buffer).first(encode_result.length))};
+    REQUIRE(view.is_valid());
+    REQUIRE(view.boolean() == true);
+    REQUIRE(view.integer() == 5);
+    REQUIRE(view.hello() == "Hello world!");
+    REQUIRE(view.goodbye() == "Good bye world!");
+    REQUIRE(view.child().meaning_of_life() == -42);
+    REQUIRE(view.child().list().empty());
+
+    REQUIRE(view.optional_child().has_value());
+    REQUIRE(view.optional_child()->meaning_of_life() == 999999999);
+    std::vector<std::string_view> list;
+    for (std::string_view element : view.optional_child()->list())
+    {
+        list.push_back(element);
+    }
+    REQUIRE(list == std::vector<std::string_view>{"The", "second", "child"});
+    REQUIRE(view.optional_child()->list().size() == 3);
+
+    REQUIRE(view.the_choice().index() == 1);
+    REQUIRE(!view.the_choice().hello().has_value());
+    REQUIRE(view.the_choice().goodbye() == "I chose a string!");
+}
+
+TEST_CASE("SimpleCompilerOutput: View of absent and malformed members")
+{
+    std::array<uint8_t, 5000> buffer = {};
+
+    fast_ber::Simple::Collection collection;
+    collection.integer        = -1;
+    collection.optional_child = fast_ber::empty;
+    collection.the_choice     = fast_ber::Simple::UnnamedChoice0::Integer(7);
+
+    fast_ber::EncodeResult encode_result = fast_ber::encode(std::span(buffer), collection);
+    REQUIRE(encode_result.success);
+
+    const fast_ber::Simple::Collection::View view{fast_ber::BerView(std::span(buffer).first(encode_result.length))};
+    REQUIRE(!view.optional_child().has_value());
+    REQUIRE(!view.child().meaning_of_life().has_value());
+    REQUIRE(view.the_choice().integer() == 7);
+    REQUIRE(view.integer() == -1);
+    REQUIRE(view.hello().empty());
+
+    const fast_ber::Simple::Collection::View empty_view;
+    REQUIRE(!empty_view.is_valid());
+    REQUIRE(empty_view.hello().empty());
+    REQUIRE(empty_view.integer() == 0);
+    REQUIRE(!empty_view.optional_child().has_value());
+    REQUIRE(empty_view.the_choice().index() == 4);
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "fast_ber/util/EncodeHelpers.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <span>
+#include <vector>
+
+#include <cstdint>
+
+// Encode record to the end of buffer, building a buffer of concatenated records for tests
+template <typename T>
+void append_record(std::vector<uint8_t>& buffer, const T& record)
+{
+    const size_t offset = buffer.size();
+    buffer.resize(offset + record.encoded_length());
+    REQUIRE(fast_ber::encode(std::span(buffer).subspan(offset), record).success);
+}
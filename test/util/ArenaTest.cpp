@@ -0,0 +1,155 @@
+#include "fast_ber/ber_types/Integer.hpp"
+#include "fast_ber/ber_types/OctetString.hpp"
+#include "fast_ber/ber_types/Optional.hpp"
+#include "fast_ber/ber_types/SequenceOf.hpp"
+#include "fast_ber/util/Arena.hpp"
+#include "fast_ber/util/BerContainer.hpp"
+#include "fast_ber/util/DynamicVariant.hpp"
+#include "fast_ber/util/FixedIdBerContainer.hpp"
+
+#include "util/CountingResource.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <memory_resource>
+#include <string>
+
+TEST_CASE("Arena: Owning types allocate from the scope active when constructed")
+{
+    using Id       = fast_ber::ExplicitId<fast_ber::UniversalTag::sequence>;
+    using Sequence = fast_ber::SequenceOf<fast_ber::Integer<>, Id, fast_ber::StorageMode::dynamic>;
+
+    CountingResource resource;
+    {
+        const std::string long_string(100, 'x');
+
+        fast_ber::ArenaScope                                                    scope(resource);
+        Sequence                                                                sequence;
+        fast_ber::Optional<fast_ber::Integer<>, fast_ber::StorageMode::dynamic> optional;
+        fast_ber::dynamic::DynamicVariant<int, std::string>                     variant;
+        fast_ber::OctetString<>                                                 string;
+        fast_ber::BerContainer                                                  container;
+
+        sequence = {1, 2, 3};
+        REQUIRE(resource.allocated > 0);
+
+        size_t previous = resource.allocated;
+        optional        = fast_ber::Integer<>(5);
+        REQUIRE(resource.allocated > previous);
+
+        previous = resource.allocated;
+        variant  = std::string("variant");
+        REQUIRE(resource.allocated > previous);
+
+        previous = resource.allocated;
+        string   = long_string;
+        REQUIRE(resource.allocated > previous);
+
+        previous = resource.allocated;
+        container.assign_content(std::span(reinterpret_cast<const uint8_t*>(long_string.data()), 100));
+        REQUIRE(resource.allocated > previous);
+
+        REQUIRE(sequence == Sequence{1, 2, 3});
+        REQUIRE(*optional == 5);
+        REQUIRE(fast_ber::dynamic::get<std::string>(variant) == "variant");
+        REQUIRE(string == long_string);
+        REQUIRE(container.content_length() == 100);
+
+        // Freed storage is returned to the resource it was taken from
+        previous = resource.allocated;
+        optional = fast_ber::empty;
+        REQUIRE(resource.allocated < previous);
+    }
+    REQUIRE(resource.allocated == 0);
+}
+
+TEST_CASE("Arena: Objects constructed outside of a scope use the heap")
+{
+    using Id       = fast_ber::ExplicitId<fast_ber::UniversalTag::sequence>;
+    using Sequence = fast_ber::SequenceOf<fast_ber::Integer<>, Id, fast_ber::StorageMode::dynamic>;
+
+    CountingResource                                                        resource;
+    Sequence                                                                sequence;
+    fast_ber::Optional<fast_ber::Integer<>, fast_ber::StorageMode::dynamic> optional;
+    fast_ber::dynamic::DynamicVariant<int, std::string>                     variant;
+    {
+        fast_ber::ArenaScope scope(resource);
+        sequence.assign({1, 2, 3});
+        optional.emplace(5);
+        variant.emplace<std::string>("variant");
+    }
+    REQUIRE(resource.allocations == 0);
+
+    // Copies take memory from the scope active when they are made, moves keep the memory of their source
+    Sequence heap_sequence;
+    {
+        fast_ber::ArenaScope scope(resource);
+        Sequence             copy = sequence;
+        REQUIRE(resource.allocated > 0);
+
+        heap_sequence = std::move(copy);
+    }
+    REQUIRE(resource.allocated > 0);
+    heap_sequence = Sequence{};
+    REQUIRE(resource.allocated == 0);
+}
+
+TEST_CASE("Arena: Nested scopes")
+{
+    CountingResource outer;
+    CountingResource inner;
+    {
+        fast_ber::ArenaScope                                                    outer_scope(outer);
+        fast_ber::Optional<fast_ber::Integer<>, fast_ber::StorageMode::dynamic> a = fast_ber::Integer<>(1);
+        fast_ber::Optional<fast_ber::Integer<>, fast_ber::StorageMode::dynamic> b;
+        {
+            fast_ber::ArenaScope inner_scope(inner);
+            b = fast_ber::Integer<>(2);
+
+            fast_ber::Optional<fast_ber::Integer<>, fast_ber::StorageMode::dynamic> c = fast_ber::Integer<>(3);
+            REQUIRE(inner.allocated > 0);
+            REQUIRE(outer.allocated == 2 * inner.allocated);
+        }
+        REQUIRE(inner.allocated == 0);
+
+        a = fast_ber::empty;
+        b = fast_ber::empty;
+        REQUIRE(outer.allocated == 0);
+    }
+}
+
+TEST_CASE("Arena: Decode into an arena")
+{
+    using Id       = fast_ber::ExplicitId<fast_ber::UniversalTag::sequence>;
+    using Sequence = fast_ber::SequenceOf<fast_ber::OctetString<>, Id, fast_ber::StorageMode::dynamic>;
+
+    Sequence original;
+    for (int i = 0; i < 20; i++)
+    {
+        original.emplace_back(std::string(50, char('a' + i)));
+    }
+    std::array<uint8_t, 2000> buffer = {};
+    const auto                encode_result = fast_ber::encode(std::span(buffer), original);
+    REQUIRE(encode_result.success);
+
+    fast_ber::Arena arena;
+    const void*     first_element = nullptr;
+    for (int i = 0; i < 3; i++)
+    {
+        {
+            fast_ber::ArenaScope scope(arena);
+            Sequence             decoded;
+            REQUIRE(decoded.decode(fast_ber::BerView(std::span(buffer).first(encode_result.length))).success);
+            REQUIRE(decoded == original);
+
+            // Memory released by reset is reused by the next message
+            if (i == 0)
+            {
+                first_element = decoded.data();
+            }
+            REQUIRE(decoded.data() == first_element);
+        }
+        arena.reset();
+    }
+}
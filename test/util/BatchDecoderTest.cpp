@@ -0,0 +1,191 @@
+#include "fast_ber/ber_types/Integer.hpp"
+#include "fast_ber/ber_types/OctetString.hpp"
+#include "fast_ber/ber_types/SequenceOf.hpp"
+#include "fast_ber/util/BatchDecoder.hpp"
+#include "fast_ber/util/MappedFile.hpp"
+
+#include "util/AppendRecord.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+std::vector<std::string> decode_all(std::span<const uint8_t>                 input,
+                                    std::vector<fast_ber::BatchDecodeError>& errors,
+                                    std::vector<size_t>*                     offsets = nullptr)
+{
+    std::vector<std::string>                        decoded;
+    fast_ber::BatchDecoder<fast_ber::OctetString<>> decoder(input);
+    fast_ber::OctetString<>                         record;
+    while (decoder.next(record))
+    {
+        decoded.push_back(std::string(record.value()));
+        if (offsets)
+        {
+            offsets->push_back(decoder.record_offset());
+        }
+    }
+    REQUIRE(decoder.at_end());
+    errors = decoder.errors();
+    return decoded;
+}
+
+} // namespace
+
+TEST_CASE("BatchDecoder: Concatenated records")
+{
+    std::vector<uint8_t> buffer;
+    append_record(buffer, fast_ber::OctetString<>("first"));
+    append_record(buffer, fast_ber::OctetString<>(std::string(300, 'x')));
+    append_record(buffer, fast_ber::OctetString<>(""));
+
+    std::vector<fast_ber::BatchDecodeError> errors;
+    std::vector<size_t>                     offsets;
+    REQUIRE(decode_all(buffer, errors, &offsets) == std::vector<std::string>{"first", std::string(300, 'x'), ""});
+    REQUIRE(errors.empty());
+    REQUIRE(offsets == std::vector<size_t>{0, 7, 7 + 304});
+
+    REQUIRE(decode_all({}, errors).empty());
+    REQUIRE(errors.empty());
+}
+
+TEST_CASE("BatchDecoder: Well formed records of the wrong type are skipped")
+{
+    std::vector<uint8_t> buffer;
+    append_record(buffer, fast_ber::OctetString<>("first"));
+    append_record(buffer, fast_ber::Integer<>(5));
+    append_record(buffer, fast_ber::Integer<>(6));
+    append_record(buffer, fast_ber::OctetString<>("second"));
+
+    std::vector<fast_ber::BatchDecodeError> errors;
+    REQUIRE(decode_all(buffer, errors) == std::vector<std::string>{"first", "second"});
+    REQUIRE(errors.size() == 1);
+    REQUIRE(errors[0].offset == 7);
+    REQUIRE(errors[0].length == 6);
+}
+
+TEST_CASE("BatchDecoder: Resynchronize after malformed data")
+{
+    std::vector<uint8_t> buffer;
+    append_record(buffer, fast_ber::OctetString<>("first"));
+    const size_t garbage_offset = buffer.size();
+    // Length exceeds the remaining input
+    buffer.insert(buffer.end(), {0x04, 0x7f, 0x01, 0x02});
+    append_record(buffer, fast_ber::OctetString<>("second"));
+    append_record(buffer, fast_ber::OctetString<>("third"));
+    const size_t truncated_offset = buffer.size();
+    append_record(buffer, fast_ber::OctetString<>("truncated"));
+    buffer.pop_back();
+
+    std::vector<fast_ber::BatchDecodeError> errors;
+    REQUIRE(decode_all(buffer, errors) == std::vector<std::string>{"first", "second", "third"});
+    REQUIRE(errors.size() == 2);
+    REQUIRE(errors[0].offset == garbage_offset);
+    REQUIRE(errors[0].length == 4);
+    REQUIRE(errors[1].offset == truncated_offset);
+    REQUIRE(errors[1].length == buffer.size() - truncated_offset);
+}
+
+TEST_CASE("BatchDecoder: Unterminated indefinite length record")
+{
+    using Record = fast_ber::SequenceOf<fast_ber::Integer<>>;
+
+    std::vector<uint8_t> buffer;
+    append_record(buffer, Record{1, 2});
+    const size_t unterminated_offset = buffer.size();
+    buffer.insert(buffer.end(), {0x30, 0x80, 0x02, 0x01, 0x05});
+
+    fast_ber::BatchDecoder<Record> decoder(buffer);
+    Record                         record;
+    REQUIRE(decoder.next(record));
+    REQUIRE(record == Record{1, 2});
+    REQUIRE(!decoder.next(record));
+    REQUIRE(decoder.at_end());
+    REQUIRE(decoder.errors() == std::vector<fast_ber::BatchDecodeError>{{unterminated_offset, 5}});
+}
+
+TEST_CASE("BatchDecoder: Resynchronize across a large corrupt region")
+{
+    // Nested indefinite length headers, each of which would be walked to the end of the input if candidates were
+    // checked by constructing a BerView. The scan must instead be linear in the size of the region
+    constexpr size_t garbage_length = size_t(1) << 20;
+
+    std::vector<uint8_t> buffer;
+    append_record(buffer, fast_ber::OctetString<>("first"));
+    const size_t garbage_offset = buffer.size();
+    for (size_t i = 0; i < garbage_length / 2; i++)
+    {
+        buffer.insert(buffer.end(), {0x30, 0x80});
+    }
+    // Identifiers of the record type whose lengths overrun the input
+    for (size_t i = 0; i < garbage_length / 2; i++)
+    {
+        buffer.insert(buffer.end(), {0x04, 0x84});
+    }
+    const size_t last_offset = buffer.size();
+    append_record(buffer, fast_ber::OctetString<>("last"));
+
+    std::vector<fast_ber::BatchDecodeError> errors;
+    std::vector<size_t>                     offsets;
+    REQUIRE(decode_all(buffer, errors, &offsets) == std::vector<std::string>{"first", "last"});
+    REQUIRE(offsets == std::vector<size_t>{0, last_offset});
+    REQUIRE(errors == std::vector<fast_ber::BatchDecodeError>{{garbage_offset, last_offset - garbage_offset}});
+}
+
+TEST_CASE("BatchDecoder: Packets and decode_batch")
+{
+    std::vector<uint8_t> buffer;
+    for (int i = 0; i < 100; i++)
+    {
+        append_record(buffer, fast_ber::Integer<>(i * 1000));
+    }
+
+    fast_ber::BatchDecoder<fast_ber::Integer<>> decoder(buffer);
+    fast_ber::BerView                          packet;
+    size_t                                     count = 0;
+    while (decoder.next_packet(packet))
+    {
+        REQUIRE(packet.ber_data() == buffer.data() + decoder.record_offset());
+        count++;
+    }
+    REQUIRE(count == 100);
+
+    int64_t    sum    = 0;
+    const auto result = fast_ber::decode_batch<fast_ber::Integer<>>(
+        buffer, [&sum](const fast_ber::Integer<>& record, size_t) { sum += record.value(); });
+    REQUIRE(result.records == 100);
+    REQUIRE(result.errors.empty());
+    REQUIRE(sum == 4950000);
+}
+
+TEST_CASE("BatchDecoder: Mapped file")
+{
+    std::vector<uint8_t> buffer;
+    append_record(buffer, fast_ber::OctetString<>("mapped"));
+    append_record(buffer, fast_ber::OctetString<>("file"));
+
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "fast_ber_batch_decoder_test.ber";
+    {
+        std::ofstream output(path, std::ios::binary);
+        output.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+    }
+
+    fast_ber::MappedFile file(path.string());
+    REQUIRE(file.is_open());
+    REQUIRE(file.size() == buffer.size());
+
+    fast_ber::MappedFile                    moved = std::move(file);
+    std::vector<fast_ber::BatchDecodeError> errors;
+    REQUIRE(decode_all(moved.data(), errors) == std::vector<std::string>{"mapped", "file"});
+    REQUIRE(errors.empty());
+
+    moved.close();
+    std::filesystem::remove(path);
+    REQUIRE(!fast_ber::MappedFile(path.string()).is_open());
+}
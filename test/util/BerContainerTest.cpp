@@ -5,6 +5,7 @@
 #include <catch2/catch.hpp>
 
 #include <array>
+#include <cstring>
 
 template <typename Container>
 void empty_construction()
@@ -166,6 +167,7 @@ TEST_CASE("BerContainer: Resize larger")
     resize_larger<fast_ber::FixedIdBerContainer<SingleTestId>>();
     resize_larger<fast_ber::FixedIdBerContainer<DoubleTestId>>();
     resize_larger<fast_ber::FixedIdBerContainer<LongTestId>>();
+    resize_larger<fast_ber::FixedIdBerContainer<SingleTestId, 4>>();
     resize_larger<fast_ber::SmallFixedIdBerContainer<SingleTestId, 75>>(75);
     resize_larger<fast_ber::SmallFixedIdBerContainer<DoubleTestId, 75>>(73);
     resize_larger<fast_ber::SmallFixedIdBerContainer<LongTestId, 75>>(66);
@@ -177,6 +179,7 @@ TEST_CASE("BerContainer: Resize smaller")
     resize_smaller<fast_ber::FixedIdBerContainer<SingleTestId>>();
     resize_smaller<fast_ber::FixedIdBerContainer<DoubleTestId>>();
     resize_smaller<fast_ber::FixedIdBerContainer<LongTestId>>();
+    resize_smaller<fast_ber::FixedIdBerContainer<SingleTestId, 4>>();
     resize_smaller<fast_ber::SmallFixedIdBerContainer<SingleTestId, 9>>();
     resize_smaller<fast_ber::SmallFixedIdBerContainer<DoubleTestId, 9>>();
     resize_smaller<fast_ber::SmallFixedIdBerContainer<LongTestId, 9>>();
@@ -308,3 +311,55 @@ TEST_CASE("BerContainer: SmallFixedIdBerContainer Different ID Assign")
     CHECK(std::equal(dcon.begin(), dcon.end(), scon.begin(), scon.end()));
     CHECK(std::equal(lcon.begin(), lcon.end(), scon.begin(), scon.end()));
 }
+
+TEST_CASE("BerContainer: Inline storage")
+{
+    using Container = fast_ber::FixedIdBerContainer<SingleTestId>;
+
+    const auto is_inline = [](const Container& container) {
+        const uint8_t* object = reinterpret_cast<const uint8_t*>(&container);
+        return container.ber_data() >= object && container.ber_data() < object + sizeof(container);
+    };
+
+    const std::array<uint8_t, 8> imsi = {0x32, 0x54, 0x76, 0x98, 0x10, 0x32, 0x54, 0xF6};
+    Container                    container(imsi, fast_ber::ConstructionMethod::construct_with_provided_content);
+    CHECK(is_inline(container));
+
+    const Container decoded(container.view());
+    CHECK(is_inline(decoded));
+    CHECK(decoded == container);
+
+    const std::array<uint8_t, fast_ber::default_inline_ber_length> long_content = {};
+    container.assign_content(long_content);
+    CHECK(!is_inline(container));
+    CHECK(container.content_length() == long_content.size());
+
+    Container moved = std::move(container);
+    CHECK(moved.content_length() == long_content.size());
+    CHECK(moved.view().is_valid());
+}
+
+TEST_CASE("BerContainer: Content is followed by a zero byte")
+{
+    using Container = fast_ber::FixedIdBerContainer<SingleTestId>;
+
+    // Storage is filled with non zero bytes first, so that a missing terminator is noticed
+    Container container;
+    container.assign_content(std::array<uint8_t, 20>{0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                                                     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF});
+    const std::array<uint8_t, 3> hello = {'h', 'e', 'y'};
+    container.assign_content(hello);
+    CHECK(container.content_data()[3] == 0);
+    CHECK(std::strlen(reinterpret_cast<const char*>(container.content_data())) == 3);
+
+    container.resize_content(2);
+    CHECK(container.content_data()[2] == 0);
+
+    const Container decoded(container.view());
+    CHECK(decoded.content_data()[2] == 0);
+
+    Container moved = std::move(container);
+    CHECK(moved.content_data()[2] == 0);
+    CHECK(container.ber_length() == 0);
+    CHECK(container.content_data()[0] == 0);
+}
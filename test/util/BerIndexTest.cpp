@@ -0,0 +1,99 @@
+#include "fast_ber/util/BerIndex.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <array>
+#include <vector>
+
+const static std::array<uint8_t, 31> index_sample_packet = {
+    0x30, 0x1d, 0x80, 0x06, 0x46, 0x61, 0x6c, 0x63, 0x6f, 0x6e, 0x82, 0x01, 0x00, 0xa3, 0x04, 0x80,
+    0x02, 0x46, 0x50, 0xa4, 0x0a, 0x0c, 0x03, 0x43, 0x61, 0x72, 0x0c, 0x03, 0x47, 0x50, 0x53};
+
+void check_matches_view(const fast_ber::BerIndex& index, size_t i, fast_ber::BerView expected)
+{
+    const fast_ber::BerView view = index.view(i);
+    REQUIRE(view.is_valid());
+    REQUIRE(view.identifier() == expected.identifier());
+    REQUIRE(view.header_length() == expected.header_length());
+    REQUIRE(view.content_length() == expected.content_length());
+    REQUIRE(view.ber_length() == expected.ber_length());
+    REQUIRE(view.ber_data() == expected.ber_data());
+    REQUIRE(index[i].ber_length() == expected.ber_length());
+}
+
+TEST_CASE("BerIndex: Sample data")
+{
+    fast_ber::BerIndex index(index_sample_packet);
+
+    REQUIRE(index.is_valid());
+    REQUIRE(index.size() == 8);
+
+    const std::vector<uint16_t> depths = {0, 1, 1, 1, 2, 1, 2, 2};
+    const std::vector<uint32_t> tags   = {16, 0, 2, 3, 0, 4, 12, 12};
+    for (size_t i = 0; i < index.size(); i++)
+    {
+        REQUIRE(index[i].depth == depths[i]);
+        REQUIRE(index[i].tag == tags[i]);
+    }
+
+    REQUIRE(index.next_sibling(0) == 8);
+    REQUIRE(index.next_sibling(3) == 5);
+    REQUIRE(index.next_sibling(5) == 8);
+
+    // Matches a tree walk using BerView
+    fast_ber::BerView root(index_sample_packet);
+    check_matches_view(index, 0, root);
+
+    size_t child_index = index.first_child(0);
+    for (const fast_ber::BerView child : root)
+    {
+        REQUIRE(child_index < index.next_sibling(0));
+        check_matches_view(index, child_index, child);
+        child_index = index.next_sibling(child_index);
+    }
+    REQUIRE(child_index == index.next_sibling(0));
+}
+
+TEST_CASE("BerIndex: Concatenated and indefinite length packets")
+{
+    const std::vector<uint8_t> packets = {0x02, 0x01, 0x05, 0x30, 0x80, 0x30, 0x80, 0x04, 0x01, 0xff,
+                                          0x00, 0x00, 0x00, 0x00, 0x9f, 0x81, 0x00, 0x01, 0x01};
+    fast_ber::BerIndex         index(packets);
+
+    REQUIRE(index.is_valid());
+    REQUIRE(index.size() == 5);
+    REQUIRE(index.next_sibling(0) == 1);
+    REQUIRE(index.next_sibling(1) == 4);
+    REQUIRE(index[1].indefinite_length);
+    REQUIRE(index[1].content_length == 7);
+    REQUIRE(index[1].ber_length() == 11);
+    REQUIRE(index[2].depth == 1);
+    REQUIRE(index[2].content_length == 3);
+    REQUIRE(index[3].depth == 2);
+    REQUIRE(index[4].depth == 0);
+    REQUIRE(index[4].tag == 128);
+    REQUIRE(index[4].class_() == fast_ber::Class::context_specific);
+    check_matches_view(index, 1, fast_ber::BerView(std::span(packets).subspan(3)));
+}
+
+TEST_CASE("BerIndex: Invalid data")
+{
+    const std::vector<std::vector<uint8_t>> invalid_packets = {
+        {0x30, 0x05, 0x02, 0x01},             // Content overruns buffer
+        {0x30, 0x03, 0x02, 0x02, 0x00, 0x00}, // Child overruns parent
+        {0x30, 0x80, 0x02, 0x01, 0x00},       // Missing end-of-contents
+        {0x04, 0x80, 0x00, 0x00},             // Primitive indefinite length
+        {0x30},                               // Truncated header
+    };
+
+    for (const auto& packet : invalid_packets)
+    {
+        fast_ber::BerIndex index(packet);
+        REQUIRE(!index.is_valid());
+    }
+
+    fast_ber::BerIndex index;
+    REQUIRE(!index.is_valid());
+    REQUIRE(index.build(std::span<const uint8_t>()));
+    REQUIRE(index.empty());
+}
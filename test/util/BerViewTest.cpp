@@ -2,8 +2,11 @@
 
 #include <catch2/catch.hpp>
 
+#include <algorithm>
 #include <array>
+#include <iostream>
 #include <sstream>
+#include <vector>
 
 const static std::array<uint8_t, 31> sample_packet = {0x30, 0x1d, 0x80, 0x06, 0x46, 0x61, 0x6c, 0x63, 0x6f, 0x6e, 0x82,
                                                       0x01, 0x00, 0xa3, 0x04, 0x80, 0x02, 0x46, 0x50, 0xa4, 0x0a, 0x0c,
@@ -11,6 +14,11 @@ const static std::array<uint8_t, 31> sample_packet = {0x30, 0x1d, 0x80, 0x06, 0x
 
 const static std::array<uint8_t, 2> empty_packet = {0x00, 0x00};
 
+// Same content as sample_packet, with the outer sequence and the [4] member using indefinite length
+const static std::array<uint8_t, 35> indefinite_packet = {
+    0x30, 0x80, 0x80, 0x06, 0x46, 0x61, 0x6c, 0x63, 0x6f, 0x6e, 0x82, 0x01, 0x00, 0xa3, 0x04, 0x80, 0x02, 0x46,
+    0x50, 0xa4, 0x80, 0x0c, 0x03, 0x43, 0x61, 0x72, 0x0c, 0x03, 0x47, 0x50, 0x53, 0x00, 0x00, 0x00, 0x00};
+
 TEST_CASE("BerView: Sample data")
 {
     fast_ber::BerView view(sample_packet);
@@ -40,6 +48,108 @@ TEST_CASE("BerView: Empty packet")
     REQUIRE(view.content().empty());
 }
 
+TEST_CASE("BerView: Indefinite length")
+{
+    fast_ber::BerView view(indefinite_packet);
+
+    REQUIRE(view.is_valid());
+    REQUIRE(view.is_indefinite_length());
+    REQUIRE(view.tag() == 16);
+    REQUIRE(view.header_length() == 2);
+    REQUIRE(view.content_length() == 31);
+    REQUIRE(view.ber_length() == 35);
+
+    std::vector<fast_ber::BerView> children(view.begin(), view.end());
+    REQUIRE(children.size() == 4);
+    REQUIRE(!children[2].is_indefinite_length());
+    REQUIRE(children[3].is_indefinite_length());
+    REQUIRE(children[3].ber_length() == 14);
+    REQUIRE(std::distance(children[3].begin(), children[3].end()) == 2);
+    REQUIRE(children[3].begin()->content().size() == 3);
+}
+
+TEST_CASE("BerView: Invalid indefinite length")
+{
+    // Missing end-of-contents octets, found once the length is needed
+    const fast_ber::BerView truncated{std::span(indefinite_packet).first(33)};
+    REQUIRE(truncated.is_valid());
+    REQUIRE(truncated.ber_length() == 0);
+    REQUIRE(!truncated.is_valid());
+
+    // Primitive packets must have a definite length
+    const std::array<uint8_t, 5> primitive = {0x04, 0x80, 0x01, 0x00, 0x00};
+    REQUIRE(!fast_ber::BerView(primitive).is_valid());
+
+    // Child overruns the end of the buffer
+    const std::array<uint8_t, 6> overrun = {0x30, 0x80, 0x04, 0x05, 0x00, 0x00};
+    const fast_ber::BerView      overrun_view(overrun);
+    REQUIRE(overrun_view.content_length() == 0);
+    REQUIRE(!overrun_view.is_valid());
+
+    // Too short to hold the end-of-contents octets
+    const std::array<uint8_t, 3> short_packet = {0x30, 0x80, 0x00};
+    REQUIRE(!fast_ber::BerView(short_packet).is_valid());
+}
+
+TEST_CASE("BerView: Indefinite length located lazily")
+{
+    // Trailing octets after the packet
+    std::array<uint8_t, 40> buffer = {};
+    std::copy(indefinite_packet.begin(), indefinite_packet.end(), buffer.begin());
+    buffer[35] = 0x04;
+
+    const fast_ber::BerView view(buffer);
+    REQUIRE(view.is_valid());
+
+    // Iteration stops at the end-of-contents octets, without the length of the packet
+    std::vector<fast_ber::BerView> children(view.begin(), view.end());
+    REQUIRE(children.size() == 4);
+    REQUIRE(children[3].ber_length() == 14);
+
+    // Which the iterated elements then give without searching again
+    size_t consumed = 0;
+    for (const fast_ber::BerView& child : children)
+    {
+        consumed += child.ber_length();
+    }
+    REQUIRE(!view.ends_after(children[0].ber_length()));
+    REQUIRE(view.ends_after(consumed));
+    REQUIRE(view.content_length() == 31);
+    REQUIRE(view.ber_length() == 35);
+    REQUIRE(std::distance(view.begin(), view.end()) == 4);
+}
+
+TEST_CASE("BerView: Unterminated nested indefinite length")
+{
+    // Definite length packet holding an indefinite length packet without end-of-contents octets
+    const std::array<uint8_t, 7> nested = {0x30, 0x05, 0x30, 0x80, 0x02, 0x01, 0x05};
+
+    const fast_ber::BerView view(nested);
+    REQUIRE(view.is_valid());
+
+    // The child fails the search for its end-of-contents octets when advanced past, which ends iteration
+    size_t count = 0;
+    for (auto child = view.begin(); child != view.end() && count < 10; ++child)
+    {
+        count++;
+    }
+    REQUIRE(count == 1);
+
+    auto child = view.begin();
+    REQUIRE(child->ber_length() == 0);
+    REQUIRE(!child->is_valid());
+    REQUIRE(++child == view.end());
+    REQUIRE(!view.ends_after(0));
+}
+
+TEST_CASE("BerView: Largest definite length")
+{
+    // Is not mistaken for the indefinite form, the content overruns the buffer
+    const std::array<uint8_t, 14> packet = {0x30, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                                            0xFF, 0xFF, 0xFF, 0x02, 0x01, 0x00, 0x00};
+    REQUIRE(!fast_ber::BerView(packet).is_valid());
+}
+
 TEST_CASE("BerView: Output")
 {
     fast_ber::BerView view(sample_packet);
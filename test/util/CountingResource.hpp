@@ -0,0 +1,27 @@
+#pragma once
+
+#include <memory_resource>
+
+#include <cstddef>
+
+// Memory resource for tests, counting the allocations made from it and the bytes currently allocated
+class CountingResource : public std::pmr::memory_resource
+{
+  public:
+    size_t allocations = 0;
+    size_t allocated   = 0;
+
+  private:
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+        allocations++;
+        allocated += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override
+    {
+        allocated -= bytes;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
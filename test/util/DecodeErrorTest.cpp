@@ -0,0 +1,31 @@
+#include "fast_ber/ber_types/Integer.hpp"
+#include "fast_ber/ber_types/SequenceOf.hpp"
+#include "fast_ber/util/DecodeHelpers.hpp"
+
+#include <catch2/catch.hpp>
+
+namespace
+{
+using NativeInteger =
+    fast_ber::Integer<fast_ber::ExplicitId<fast_ber::UniversalTag::integer>, fast_ber::StorageMode::native>;
+} // namespace
+
+TEST_CASE("DecodeError: Library types report the kind and location of failures")
+{
+    NativeInteger integer;
+
+    const uint8_t wrong_tag[] = {0x04, 0x01, 0x05};
+    REQUIRE(fast_ber::decode(std::span(wrong_tag), integer).error == fast_ber::DecodeError::invalid_header);
+
+    const uint8_t empty_integer[] = {0x02, 0x00};
+    REQUIRE(fast_ber::decode(std::span(empty_integer), integer).error == fast_ber::DecodeError::invalid_content);
+
+    // Third element of a sequence is an empty integer
+    fast_ber::SequenceOf<NativeInteger> sequence;
+    const uint8_t                       bad_element[] = {0x30, 0x08, 0x02, 0x01, 0x01, 0x02, 0x01, 0x02, 0x02, 0x00};
+    const fast_ber::DecodeResult        result        = fast_ber::decode(std::span(bad_element), sequence);
+    REQUIRE(!result.success);
+    REQUIRE(result.error == fast_ber::DecodeError::invalid_content);
+    REQUIRE(result.offset == 8);
+    REQUIRE(result.field == nullptr);
+}
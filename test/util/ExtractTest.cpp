@@ -2,6 +2,7 @@
 
 #include <catch2/catch.hpp>
 
+#include <limits>
 #include <utility>
 #include <vector>
 
@@ -36,3 +37,31 @@ TEST_CASE("Extract: Lengths")
         REQUIRE(length == packet.length);
     };
 }
+
+TEST_CASE("Extract: Indefinite length")
+{
+    const std::vector<uint8_t> packet = {0x30, 0x80, 0x04, 0x01, 0xff, 0x30, 0x80, 0x00, 0x00, 0x00, 0x00};
+
+    size_t length     = 0;
+    bool   indefinite = false;
+    REQUIRE(fast_ber::extract_length(packet, length, 1, indefinite) == 1);
+    REQUIRE(indefinite);
+    REQUIRE(fast_ber::extract_length(packet, length, 1) == 0);
+
+    REQUIRE(fast_ber::extract_indefinite_content_length(std::span(packet).subspan(2), length));
+    REQUIRE(length == 7);
+    REQUIRE(!fast_ber::extract_indefinite_content_length(std::span(packet).subspan(2, 7), length));
+}
+
+TEST_CASE("Extract: Largest definite length")
+{
+    // Eight length octets encode the largest length, which is definite however large it is
+    const std::vector<uint8_t> header = {0x30, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+
+    size_t length     = 0;
+    bool   indefinite = true;
+    REQUIRE(fast_ber::extract_length(header, length, 1, indefinite) == 9);
+    REQUIRE(!indefinite);
+    REQUIRE(length == std::numeric_limits<size_t>::max());
+    REQUIRE(fast_ber::extract_length(header, length, 1) == 9);
+}
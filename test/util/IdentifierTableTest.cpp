@@ -0,0 +1,70 @@
+#include "fast_ber/ber_types/Integer.hpp"
+#include "fast_ber/util/IdentifierTable.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <array>
+
+namespace
+{
+
+constexpr fast_ber::IdentifierTable<4> table(std::array<fast_ber::IdentifierEntry, 4>{{
+    {fast_ber::Class::universal, 2, 0},
+    {fast_ber::Class::context_specific, 2, 1},
+    {fast_ber::Class::context_specific, 30, 2},
+    {fast_ber::Class::application, 1000, 3},
+}});
+
+} // namespace
+
+TEST_CASE("IdentifierTable: Find by class and tag")
+{
+    STATIC_REQUIRE(table.find(fast_ber::Class::universal, 2) == 0);
+    STATIC_REQUIRE(table.find(fast_ber::Class::context_specific, 2) == 1);
+    STATIC_REQUIRE(table.find(fast_ber::Class::context_specific, 30) == 2);
+    STATIC_REQUIRE(table.find(fast_ber::Class::application, 1000) == 3);
+    STATIC_REQUIRE(table.find(fast_ber::Class::application, 2) == table.no_match);
+    STATIC_REQUIRE(table.find(fast_ber::Class::context_specific, 1000) == table.no_match);
+}
+
+TEST_CASE("IdentifierTable: Find by packet")
+{
+    // Primitive and constructed encodings have the same identifier
+    const uint8_t primitive[]   = {0x82, 0x01, 0x05};
+    const uint8_t constructed[] = {0xA2, 0x03, 0x02, 0x01, 0x05};
+    const uint8_t long_tag[]    = {0x5F, 0x87, 0x68, 0x01, 0x05};
+    const uint8_t unknown[]     = {0x83, 0x01, 0x05};
+    const uint8_t truncated[]   = {0x82, 0x05, 0x05};
+
+    REQUIRE(table.find(fast_ber::BerView(primitive)) == 1);
+    REQUIRE(table.find(fast_ber::BerView(constructed)) == 1);
+    REQUIRE(table.find(fast_ber::BerView(long_tag)) == 3);
+    REQUIRE(table.find(fast_ber::BerView(unknown)) == table.no_match);
+    REQUIRE(table.find(fast_ber::BerView(truncated)) == table.no_match);
+
+    std::array<uint8_t, 10> buffer{};
+    REQUIRE(fast_ber::encode(std::span(buffer), fast_ber::Integer<>(5)).success);
+    REQUIRE(table.find(fast_ber::BerView(buffer)) == 0);
+}
+
+TEST_CASE("IdentifierSet: Contains")
+{
+    constexpr fast_ber::IdentifierSet<3> set(std::array<fast_ber::IdentifierEntry, 3>{{
+        {fast_ber::Class::private_, 0, 0},
+        {fast_ber::Class::context_specific, 31, 0},
+        {fast_ber::Class::universal, 16, 0},
+    }});
+
+    STATIC_REQUIRE(set.contains(fast_ber::Class::private_, 0));
+    STATIC_REQUIRE(set.contains(fast_ber::Class::context_specific, 31));
+    STATIC_REQUIRE(!set.contains(fast_ber::Class::universal, 0));
+    STATIC_REQUIRE(!set.contains(fast_ber::Class::context_specific, 16));
+
+    const uint8_t sequence[] = {0x30, 0x00};
+    const uint8_t long_tag[] = {0x9F, 0x1F, 0x00};
+    const uint8_t other[]    = {0x04, 0x00};
+    REQUIRE(set.contains(fast_ber::BerView(sequence)));
+    REQUIRE(set.contains(fast_ber::BerView(long_tag)));
+    REQUIRE(!set.contains(fast_ber::BerView(other)));
+    REQUIRE(!set.contains(fast_ber::BerView()));
+}
@@ -0,0 +1,170 @@
+#include "fast_ber/util/DecodeHelpers.hpp"
+#include "fast_ber/util/EncodeHelpers.hpp"
+#include "fast_ber/util/InstrumentationHooks.hpp"
+#include "fast_ber/util/InstrumentationProfile.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+// Stand ins for generated types, each keeping its own statistics
+struct DefaultRecord
+{
+};
+struct CountedRecord
+{
+};
+struct TimedOuter
+{
+};
+struct TimedInner
+{
+};
+struct SampledOuter
+{
+};
+struct SampledInner
+{
+};
+
+const uint8_t packet[] = {0x04, 0x02, 'a', 'b'};
+
+template <typename Policy, typename Outer, typename Inner>
+fast_ber::DecodeResult decode_nested(const fast_ber::BerView& input)
+{
+    return fast_ber::instrument_decode<Policy>(Outer{}, "Outer", input, [&]() noexcept {
+        for (int i = 0; i < 2; i++)
+        {
+            fast_ber::instrument_decode<Policy>(Inner{}, "Inner", input,
+                                                []() noexcept { return fast_ber::DecodeResult{true}; });
+        }
+        return fast_ber::DecodeResult{true};
+    });
+}
+
+} // namespace
+
+TEST_CASE("Instrumentation: Default policy only calls the function")
+{
+    const fast_ber::BerView      input(packet);
+    const fast_ber::DecodeResult result = fast_ber::instrument_decode(DefaultRecord{}, "DefaultRecord", input, []() {
+        return fast_ber::decode_error(fast_ber::DecodeError::invalid_content, "DefaultRecord");
+    });
+    REQUIRE(!result.success);
+    REQUIRE(result.error == fast_ber::DecodeError::invalid_content);
+    REQUIRE(!fast_ber::detail::instrumented_type<DefaultRecord>.registered);
+}
+
+TEST_CASE("Instrumentation: Counting policy")
+{
+    using Policy = fast_ber::CountingInstrumentation;
+
+    const fast_ber::BerView input(packet);
+    for (int i = 0; i < 3; i++)
+    {
+        fast_ber::instrument_decode<Policy>(CountedRecord{}, "CountedRecord", input,
+                                            []() noexcept { return fast_ber::DecodeResult{true}; });
+    }
+    fast_ber::instrument_decode<Policy>(CountedRecord{}, "CountedRecord", input,
+                                        []() noexcept { return fast_ber::DecodeResult{false}; });
+    fast_ber::instrument_encode<Policy>(CountedRecord{}, "CountedRecord",
+                                        []() noexcept { return fast_ber::EncodeResult{true, 7}; });
+
+    const fast_ber::InstrumentedType& type = fast_ber::instrumented_type<CountedRecord>("CountedRecord");
+    REQUIRE(std::string(type.name) == "CountedRecord");
+    REQUIRE(type[fast_ber::Operation::decode].calls == 4);
+    REQUIRE(type[fast_ber::Operation::decode].failures == 1);
+    REQUIRE(type[fast_ber::Operation::decode].bytes == 16);
+    REQUIRE(type[fast_ber::Operation::decode].cycles == 0);
+    REQUIRE(type[fast_ber::Operation::encode].calls == 1);
+    REQUIRE(type[fast_ber::Operation::encode].bytes == 7);
+
+    bool registered = false;
+    for (const fast_ber::InstrumentedType* it = fast_ber::instrumented_types(); it != nullptr; it = it->next)
+    {
+        registered = registered || it == &type;
+    }
+    REQUIRE(registered);
+}
+
+TEST_CASE("Instrumentation: Cycle policy separates time in nested types")
+{
+    using Policy = fast_ber::CycleInstrumentation;
+
+    const fast_ber::BerView input(packet);
+    for (int i = 0; i < 10; i++)
+    {
+        REQUIRE(decode_nested<Policy, TimedOuter, TimedInner>(input).success);
+    }
+
+    const fast_ber::OperationStatistics& outer =
+        fast_ber::instrumented_type<TimedOuter>("Outer")[fast_ber::Operation::decode];
+    const fast_ber::OperationStatistics& inner =
+        fast_ber::instrumented_type<TimedInner>("Inner")[fast_ber::Operation::decode];
+    REQUIRE(outer.calls == 10);
+    REQUIRE(inner.calls == 20);
+    REQUIRE(inner.cycles == inner.self_cycles);
+    REQUIRE(outer.self_cycles + inner.cycles == outer.cycles);
+
+    const std::vector<fast_ber::ProfileEntry> profile = fast_ber::flat_profile();
+    double                                    total   = 0.0;
+    for (size_t i = 0; i < profile.size(); i++)
+    {
+        total += profile[i].share;
+        if (i > 0)
+        {
+            REQUIRE(profile[i - 1].self_cycles >= profile[i].self_cycles);
+        }
+    }
+    REQUIRE(total == Approx(1.0));
+
+    std::ostringstream output;
+    fast_ber::write_flat_profile(output);
+    REQUIRE(output.str().find("Outer") != std::string::npos);
+    REQUIRE(output.str().find("Inner") != std::string::npos);
+
+    fast_ber::reset_instrumentation();
+    REQUIRE(outer.calls == 0);
+    REQUIRE(inner.cycles == 0);
+}
+
+TEST_CASE("Instrumentation: Sampling policy records whole calls")
+{
+    using Policy = fast_ber::SamplingInstrumentation<4>;
+
+    std::vector<fast_ber::TraceEvent> events;
+    fast_ber::set_trace_callback(
+        [](const fast_ber::TraceEvent& event, void* context) {
+            static_cast<std::vector<fast_ber::TraceEvent>*>(context)->push_back(event);
+        },
+        &events);
+
+    const fast_ber::BerView input(packet);
+    for (int i = 0; i < 8; i++)
+    {
+        REQUIRE(decode_nested<Policy, SampledOuter, SampledInner>(input).success);
+    }
+    fast_ber::set_trace_callback(nullptr);
+
+    // Two of the outermost calls are sampled, each with both of its nested calls, and counts are scaled by the period
+    REQUIRE(events.size() == 6);
+    REQUIRE(std::string(events[0].type) == "Inner");
+    REQUIRE(events[0].depth == 1);
+    REQUIRE(std::string(events[2].type) == "Outer");
+    REQUIRE(events[2].depth == 0);
+    REQUIRE(events[2].bytes == 4);
+
+    const fast_ber::OperationStatistics& outer =
+        fast_ber::instrumented_type<SampledOuter>("Outer")[fast_ber::Operation::decode];
+    const fast_ber::OperationStatistics& inner =
+        fast_ber::instrumented_type<SampledInner>("Inner")[fast_ber::Operation::decode];
+    REQUIRE(outer.calls == 8);
+    REQUIRE(inner.calls == 16);
+    REQUIRE(outer.bytes == 32);
+    REQUIRE(outer.self_cycles + inner.cycles == outer.cycles);
+}
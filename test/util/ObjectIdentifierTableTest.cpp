@@ -0,0 +1,84 @@
+#include "fast_ber/util/ObjectIdentifierTable.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <array>
+
+namespace
+{
+
+enum KnownOid : fast_ber::ObjectIdentifierHandle
+{
+    unknown,
+    sha256_with_rsa,
+    subject_alt_name,
+    common_name
+};
+
+const char* name(const fast_ber::ObjectIdentifierTable& table, const fast_ber::ObjectIdentifier<>& oid)
+{
+    switch (table.find(oid))
+    {
+    case sha256_with_rsa:
+        return "sha256WithRSAEncryption";
+    case subject_alt_name:
+        return "subjectAltName";
+    case common_name:
+        return "commonName";
+    default:
+        return "unknown";
+    }
+}
+
+} // namespace
+
+TEST_CASE("ObjectIdentifierTable: Handles")
+{
+    const fast_ber::ObjectIdentifierTable table = {{1, 2, 840, 113549, 1, 1, 11}, {2, 5, 29, 17}, {2, 5, 4, 3}};
+
+    REQUIRE(table.size() == 3);
+    REQUIRE(table.find(fast_ber::ObjectIdentifier<>{2, 5, 29, 17}) == subject_alt_name);
+    REQUIRE(table.find(fast_ber::ObjectIdentifier<>{2, 5, 29, 18}) == fast_ber::unknown_object_identifier);
+    REQUIRE(table.find(fast_ber::ObjectIdentifier<>()) == fast_ber::unknown_object_identifier);
+
+    REQUIRE(std::string(name(table, fast_ber::ObjectIdentifier<>{1, 2, 840, 113549, 1, 1, 11})) ==
+            "sha256WithRSAEncryption");
+    REQUIRE(std::string(name(table, fast_ber::ObjectIdentifier<>{2, 5, 4, 3})) == "commonName");
+    REQUIRE(std::string(name(table, fast_ber::ObjectIdentifier<>{2, 5, 4, 4})) == "unknown");
+}
+
+TEST_CASE("ObjectIdentifierTable: Intern")
+{
+    fast_ber::ObjectIdentifierTable table;
+
+    const fast_ber::ObjectIdentifier<>                                                   oid{2, 5, 29, 17};
+    const fast_ber::ObjectIdentifier<fast_ber::Id<fast_ber::Class::context_specific, 0>> tagged{2, 5, 29, 17};
+
+    const fast_ber::ObjectIdentifierHandle handle = table.intern(oid);
+    REQUIRE(handle == 1);
+    REQUIRE(table.intern(tagged) == handle);
+    REQUIRE(table.find(tagged) == handle);
+    REQUIRE(table.intern(fast_ber::ObjectIdentifier<>{2, 5, 4, 3}) == 2);
+    REQUIRE(table.size() == 2);
+
+    const std::span<const uint8_t> content = table.content(handle);
+    REQUIRE(std::ranges::equal(content, oid.content()));
+    REQUIRE(table.content(fast_ber::unknown_object_identifier).empty());
+    REQUIRE(table.content(3).empty());
+
+    // Lookups are by the encoded contents, decoded identifiers need not be converted
+    std::array<uint8_t, 5> encoded = {0x06, 0x03, 0x55, 0x1D, 0x11};
+    REQUIRE(table.find(fast_ber::ObjectIdentifier<>(fast_ber::BerView(encoded))) == handle);
+}
+
+TEST_CASE("ObjectIdentifierTable: Global table")
+{
+    fast_ber::ObjectIdentifierTable&   table       = fast_ber::global_object_identifier_table();
+    const fast_ber::ObjectIdentifier<> server_auth = {1, 3, 6, 1, 5, 5, 7, 3, 1};
+
+    const fast_ber::ObjectIdentifierHandle handle = table.intern(server_auth);
+    REQUIRE(handle != fast_ber::unknown_object_identifier);
+    REQUIRE(&fast_ber::global_object_identifier_table() == &table);
+    REQUIRE(fast_ber::global_object_identifier_table().find(server_auth) == handle);
+}
@@ -0,0 +1,136 @@
+#include "fast_ber/ber_types/Integer.hpp"
+#include "fast_ber/ber_types/OctetString.hpp"
+#include "fast_ber/ber_types/SequenceOf.hpp"
+#include "fast_ber/util/ParallelDecoder.hpp"
+
+#include "util/AppendRecord.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+// Records of varying size, with malformed data, records of the wrong type and a truncated record
+std::vector<uint8_t> make_input(size_t count)
+{
+    std::vector<uint8_t> buffer;
+    for (size_t i = 0; i < count; i++)
+    {
+        append_record(buffer, fast_ber::OctetString<>(std::string(i % 200, char('a' + i % 26))));
+        if (i % 97 == 5)
+        {
+            buffer.insert(buffer.end(), {0x04, 0x84, 0x7f, 0xff, 0xff, 0xff});
+        }
+        if (i % 131 == 7)
+        {
+            append_record(buffer, fast_ber::Integer<>(static_cast<int64_t>(i)));
+        }
+    }
+    append_record(buffer, fast_ber::OctetString<>("truncated"));
+    buffer.pop_back();
+    return buffer;
+}
+
+using Decoded = std::vector<std::pair<size_t, std::string>>;
+
+} // namespace
+
+TEST_CASE("ParallelDecoder: Results match sequential decode")
+{
+    const std::vector<uint8_t> input = make_input(5000);
+
+    Decoded    expected;
+    const auto expected_result = fast_ber::decode_batch<fast_ber::OctetString<>>(
+        input, [&](const fast_ber::OctetString<>& record, size_t offset) {
+            expected.emplace_back(offset, std::string(record.value()));
+        });
+    REQUIRE(expected_result.records == 5000);
+    REQUIRE(expected_result.errors.size() > 50);
+
+    for (size_t threads : {1, 2, 3, 8})
+    {
+        for (size_t chunk_records : {1, 7, 256})
+        {
+            fast_ber::ParallelDecodeOptions options;
+            options.threads       = threads;
+            options.chunk_records = chunk_records;
+
+            Decoded in_order;
+            options.order      = fast_ber::DeliveryOrder::in_order;
+            const auto ordered = fast_ber::decode_parallel<fast_ber::OctetString<>>(
+                input,
+                [&](const fast_ber::OctetString<>& record, size_t offset) {
+                    in_order.emplace_back(offset, std::string(record.value()));
+                },
+                options);
+            REQUIRE(in_order == expected);
+            REQUIRE(ordered.records == expected_result.records);
+            REQUIRE(ordered.errors == expected_result.errors);
+
+            Decoded    any_order;
+            std::mutex mutex;
+            options.order        = fast_ber::DeliveryOrder::any_order;
+            const auto unordered = fast_ber::decode_parallel<fast_ber::OctetString<>>(
+                input,
+                [&](const fast_ber::OctetString<>& record, size_t offset) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    any_order.emplace_back(offset, std::string(record.value()));
+                },
+                options);
+            std::sort(any_order.begin(), any_order.end());
+            REQUIRE(any_order == expected);
+            REQUIRE(unordered.records == expected_result.records);
+            REQUIRE(unordered.errors == expected_result.errors);
+        }
+    }
+
+    const auto empty = fast_ber::decode_parallel<fast_ber::OctetString<>>({}, [](const fast_ber::OctetString<>&,
+                                                                                 size_t) { REQUIRE(false); });
+    REQUIRE(empty.records == 0);
+    REQUIRE(empty.errors.empty());
+}
+
+TEST_CASE("ParallelDecoder: Unterminated indefinite length record")
+{
+    using Record = fast_ber::SequenceOf<fast_ber::Integer<>>;
+
+    std::vector<uint8_t> buffer;
+    append_record(buffer, Record{1, 2});
+    const size_t unterminated_offset = buffer.size();
+    buffer.insert(buffer.end(), {0x30, 0x80, 0x02, 0x01, 0x05});
+
+    size_t     decoded = 0;
+    const auto result  = fast_ber::decode_parallel<Record>(buffer, [&decoded](const Record&, size_t) { decoded++; });
+    REQUIRE(decoded == 1);
+    REQUIRE(result.records == 1);
+    REQUIRE(result.errors == std::vector<fast_ber::BatchDecodeError>{{unterminated_offset, 5}});
+}
+
+TEST_CASE("ParallelDecoder: Exceptions are propagated to the caller")
+{
+    const std::vector<uint8_t> input = make_input(2000);
+
+    for (auto order : {fast_ber::DeliveryOrder::in_order, fast_ber::DeliveryOrder::any_order})
+    {
+        fast_ber::ParallelDecodeOptions options;
+        options.threads       = 4;
+        options.chunk_records = 16;
+        options.order         = order;
+
+        auto throw_at_offset = [&input](const fast_ber::OctetString<>&, size_t offset) {
+            if (offset > input.size() / 2)
+            {
+                throw std::runtime_error("stop");
+            }
+        };
+        REQUIRE_THROWS_AS(fast_ber::decode_parallel<fast_ber::OctetString<>>(input, throw_at_offset, options),
+                          std::runtime_error);
+    }
+}
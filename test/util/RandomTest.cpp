@@ -0,0 +1,138 @@
+#include "fast_ber/util/Random.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <array>
+#include <random>
+#include <string_view>
+
+TEST_CASE("Random: Lengths")
+{
+    std::mt19937_64 rng(1);
+
+    const fast_ber::LengthDistribution fixed = {5, 5};
+    REQUIRE(fast_ber::random_length(rng, fixed) == 5);
+
+    const fast_ber::LengthDistribution uniform = {2, 6};
+    std::array<size_t, 7>              counts  = {};
+    for (int i = 0; i < 1000; i++)
+    {
+        const size_t length = fast_ber::random_length(rng, uniform);
+        REQUIRE(length >= 2);
+        REQUIRE(length <= 6);
+        counts[length]++;
+    }
+    REQUIRE(std::all_of(counts.begin() + 2, counts.end(), [](size_t count) { return count > 100; }));
+
+    // Geometric lengths are mostly short, with the mean set by the distribution
+    const fast_ber::LengthDistribution geometric = {1, 100, fast_ber::LengthDistribution::Shape::geometric, 4.0};
+    size_t                             total     = 0;
+    for (int i = 0; i < 10000; i++)
+    {
+        const size_t length = fast_ber::random_length(rng, geometric);
+        REQUIRE(length >= 1);
+        REQUIRE(length <= 100);
+        total += length;
+    }
+    REQUIRE(total / 10000.0 == Approx(4.0).epsilon(0.1));
+}
+
+TEST_CASE("Random: Optional presence")
+{
+    std::mt19937_64         rng(2);
+    fast_ber::RandomProfile profile;
+    profile.optional_probability             = 0.0;
+    profile.optional_probabilities["Type.a"] = 1.0;
+
+    for (int i = 0; i < 100; i++)
+    {
+        REQUIRE(fast_ber::random_presence(rng, profile, "Type.a"));
+        REQUIRE(!fast_ber::random_presence(rng, profile, "Type.b"));
+    }
+
+    // Optional members are absent beyond the maximum depth
+    profile.max_depth = 1;
+    fast_ber::RandomNesting outer;
+    REQUIRE(fast_ber::random_presence(rng, profile, "Type.a"));
+    fast_ber::RandomNesting inner;
+    REQUIRE(!fast_ber::random_presence(rng, profile, "Type.a"));
+}
+
+TEST_CASE("Random: Choice weights")
+{
+    std::mt19937_64         rng(3);
+    fast_ber::RandomProfile profile;
+    profile.choice_weights["Choice"] = {3.0, 0.0, 1.0};
+
+    std::array<size_t, 4> counts = {};
+    for (int i = 0; i < 4000; i++)
+    {
+        counts[fast_ber::random_alternative(rng, profile, "Choice", 4, 0)]++;
+    }
+    REQUIRE(counts[0] == Approx(3000).epsilon(0.1));
+    REQUIRE(counts[1] == 0);
+    REQUIRE(counts[2] == Approx(1000).epsilon(0.1));
+    REQUIRE(counts[3] == 0);
+
+    // Unweighted choices are uniform
+    counts = {};
+    for (int i = 0; i < 4000; i++)
+    {
+        counts[fast_ber::random_alternative(rng, profile, "Other", 4, 0)]++;
+    }
+    REQUIRE(std::all_of(counts.begin(), counts.end(), [](size_t count) { return count > 800; }));
+}
+
+TEST_CASE("Random: Character strings")
+{
+    std::mt19937_64         rng(4);
+    fast_ber::RandomProfile profile;
+    profile.string_length = {10, 10};
+
+    fast_ber::NumericString<>   numeric;
+    fast_ber::PrintableString<> printable;
+    fast_ber::BMPString<>       bmp;
+    fast_ber::BitString<>       bits;
+    for (int i = 0; i < 100; i++)
+    {
+        generate_random(numeric, rng, profile);
+        generate_random(printable, rng, profile);
+        generate_random(bmp, rng, profile);
+        generate_random(bits, rng, profile);
+
+        REQUIRE(numeric.length() == 10);
+        REQUIRE(std::string_view(numeric).find_first_not_of("0123456789 ") == std::string_view::npos);
+        REQUIRE(std::string_view(printable).find_first_of("!\"#$%&*;<>@[\\]^_`{|}~") == std::string_view::npos);
+        REQUIRE(bmp.length() == 20);
+        REQUIRE(bits.length() == 11);
+        REQUIRE(bits.data()[0] == 0);
+    }
+}
+
+TEST_CASE("Random: Values")
+{
+    std::mt19937_64         rng(5);
+    fast_ber::RandomProfile profile;
+    profile.min_integer = -10;
+    profile.max_integer = 10;
+
+    fast_ber::Integer<>          integer;
+    fast_ber::ObjectIdentifier<> oid;
+    fast_ber::TimeOfDay<>        time_of_day;
+    fast_ber::UTCTime<>          utc_time;
+    for (int i = 0; i < 100; i++)
+    {
+        generate_random(integer, rng, profile);
+        generate_random(oid, rng, profile);
+        generate_random(time_of_day, rng, profile);
+        generate_random(utc_time, rng, profile);
+
+        REQUIRE(integer.value() >= -10);
+        REQUIRE(integer.value() <= 10);
+        REQUIRE(oid.value().size() >= 2);
+        REQUIRE(oid.value()[0] <= 2);
+        REQUIRE(time_of_day.time() < std::chrono::hours(24));
+        REQUIRE(utc_time.time() >= fast_ber::TimePoint());
+    }
+}
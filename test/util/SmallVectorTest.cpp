@@ -0,0 +1,131 @@
+#include "fast_ber/util/SmallVector.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+TEST_CASE("SmallVector: Inline storage")
+{
+    fast_ber::SmallVector<int, 4> vector;
+    REQUIRE(vector.empty());
+    REQUIRE(vector.capacity() == 4);
+    REQUIRE(vector.is_inline());
+
+    for (int i = 0; i < 4; i++)
+    {
+        vector.push_back(i);
+    }
+    REQUIRE(vector.size() == 4);
+    REQUIRE(vector.is_inline());
+    REQUIRE(vector.data() >= reinterpret_cast<const int*>(&vector));
+    REQUIRE(vector.data() < reinterpret_cast<const int*>(&vector + 1));
+
+    vector.push_back(4);
+    REQUIRE(!vector.is_inline());
+    REQUIRE(vector.capacity() >= 5);
+    REQUIRE(vector == fast_ber::SmallVector<int, 2>{0, 1, 2, 3, 4});
+
+    vector.resize(2);
+    vector.shrink_to_fit();
+    REQUIRE(vector.is_inline());
+    REQUIRE(vector == fast_ber::SmallVector<int, 4>{0, 1});
+}
+
+TEST_CASE("SmallVector: Copy and move")
+{
+    for (size_t size : {0, 1, 3, 10})
+    {
+        fast_ber::SmallVector<std::string, 3> vector;
+        for (size_t i = 0; i < size; i++)
+        {
+            vector.push_back(std::string(40, char('a' + i)));
+        }
+
+        fast_ber::SmallVector<std::string, 3> copy = vector;
+        REQUIRE(copy == vector);
+
+        const std::string* heap_data = vector.data();
+        const bool         inline_   = vector.is_inline();
+
+        fast_ber::SmallVector<std::string, 3> moved = std::move(vector);
+        REQUIRE(moved == copy);
+        REQUIRE(vector.empty());
+        REQUIRE(vector.is_inline());
+        REQUIRE((moved.data() == heap_data) == !inline_);
+
+        fast_ber::SmallVector<std::string, 3> assigned{"x"};
+        assigned = std::move(moved);
+        REQUIRE(assigned == copy);
+
+        assigned.swap(vector);
+        REQUIRE(vector == copy);
+        REQUIRE(assigned.empty());
+    }
+}
+
+TEST_CASE("SmallVector: Insert and erase")
+{
+    fast_ber::SmallVector<std::string, 2> vector{"b", "d"};
+
+    REQUIRE(*vector.insert(vector.begin(), "a") == "a");
+    REQUIRE(*vector.emplace(vector.begin() + 2, "c") == "c");
+    REQUIRE(*vector.insert(vector.end(), "e") == "e");
+    REQUIRE(vector == fast_ber::SmallVector<std::string, 2>{"a", "b", "c", "d", "e"});
+
+    const std::vector<std::string> more = {"x", "y"};
+    vector.insert(vector.begin() + 1, more.begin(), more.end());
+    vector.insert(vector.end(), 2, "z");
+    REQUIRE(vector == fast_ber::SmallVector<std::string, 2>{"a", "x", "y", "b", "c", "d", "e", "z", "z"});
+
+    REQUIRE(*vector.erase(vector.begin() + 1, vector.begin() + 3) == "b");
+    const auto after_last = vector.erase(vector.end() - 1);
+    REQUIRE(after_last == vector.end());
+    vector.pop_back();
+    REQUIRE(vector == fast_ber::SmallVector<std::string, 2>{"a", "b", "c", "d", "e"});
+
+    // Arguments referring to an element remain valid while it is moved
+    vector.push_back(vector.front());
+    vector.insert(vector.begin(), vector.back());
+    vector.resize(vector.size() + 10, vector[1]);
+    REQUIRE(vector.size() == 17);
+    REQUIRE(vector[0] == "a");
+    REQUIRE(vector[6] == "a");
+    REQUIRE(vector[16] == "a");
+
+    const std::string long_string(100, 'l');
+    vector[0] = long_string;
+    vector.insert(vector.begin(), 30, vector[0]);
+    REQUIRE(vector.size() == 47);
+    REQUIRE(vector[29] == long_string);
+    REQUIRE(vector[30] == long_string);
+
+    vector.assign(3, "q");
+    REQUIRE(vector == fast_ber::SmallVector<std::string, 2>{"q", "q", "q"});
+    REQUIRE_THROWS_AS(vector.at(3), std::out_of_range);
+}
+
+TEST_CASE("SmallVector: Element lifetime")
+{
+    auto counter = std::make_shared<int>(0);
+    {
+        fast_ber::SmallVector<std::shared_ptr<int>, 2> vector;
+        for (int i = 0; i < 5; i++)
+        {
+            vector.push_back(counter);
+        }
+        REQUIRE(counter.use_count() == 6);
+
+        vector.erase(vector.begin());
+        REQUIRE(counter.use_count() == 5);
+
+        fast_ber::SmallVector<std::shared_ptr<int>, 2> copy(vector.begin(), vector.begin() + 2);
+        REQUIRE(counter.use_count() == 7);
+        REQUIRE(copy.is_inline());
+
+        vector.clear();
+        REQUIRE(counter.use_count() == 3);
+    }
+    REQUIRE(counter.use_count() == 1);
+}
@@ -0,0 +1,164 @@
+#include "fast_ber/ber_types/OctetString.hpp"
+#include "fast_ber/util/StreamDecoder.hpp"
+
+#include <catch2/catch.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+std::vector<uint8_t> encode_string(const std::string& value)
+{
+    const fast_ber::OctetString<> string(value);
+    std::vector<uint8_t>          buffer(string.encoded_length());
+    REQUIRE(fast_ber::encode(std::span(buffer), string).success);
+    return buffer;
+}
+
+// Constructed packet of indefinite length, holding a definite length string and a nested indefinite length packet
+const std::vector<uint8_t> indefinite_pdu = {0x30, 0x80, 0x04, 0x02, 'h', 'i', 0xA0, 0x80,
+                                             0x02, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00};
+
+std::vector<uint8_t> to_vector(const fast_ber::BerView& view)
+{
+    return std::vector<uint8_t>(view.ber_data(), view.ber_data() + view.ber_length());
+}
+
+} // namespace
+
+TEST_CASE("StreamDecoder: Bytes arriving one at a time")
+{
+    const std::vector<uint8_t> long_pdu = encode_string(std::string(300, 'x'));
+    std::vector<uint8_t>       stream   = encode_string("first");
+    stream.insert(stream.end(), long_pdu.begin(), long_pdu.end());
+    stream.insert(stream.end(), indefinite_pdu.begin(), indefinite_pdu.end());
+
+    fast_ber::StreamDecoder           decoder;
+    fast_ber::BerView                 pdu;
+    std::vector<std::vector<uint8_t>> framed;
+    std::vector<size_t>               needed;
+    for (uint8_t byte : stream)
+    {
+        REQUIRE(decoder.push(std::span(&byte, 1)) == 1);
+        fast_ber::StreamStatus status = decoder.next(pdu);
+        while (status == fast_ber::StreamStatus::complete)
+        {
+            framed.push_back(to_vector(pdu));
+            status = decoder.next(pdu);
+        }
+        REQUIRE(status == fast_ber::StreamStatus::need_more);
+        needed.push_back(decoder.needed());
+    }
+
+    REQUIRE(framed.size() == 3);
+    REQUIRE(framed[0] == encode_string("first"));
+    REQUIRE(framed[1] == long_pdu);
+    REQUIRE(framed[2] == indefinite_pdu);
+    REQUIRE(decoder.buffered() == 0);
+
+    // Once the header of the long PDU is known the exact number of remaining bytes is reported
+    const size_t long_start = framed[0].size();
+    REQUIRE(needed[long_start] == 1);
+    REQUIRE(needed[long_start + 1] == 2);
+    REQUIRE(needed[long_start + 2] == 1);
+    REQUIRE(needed[long_start + 3] == 300);
+    REQUIRE(needed[long_start + 302] == 1);
+}
+
+TEST_CASE("StreamDecoder: PDUs wrapping around the buffer")
+{
+    fast_ber::StreamDecoder decoder(100);
+    fast_ber::BerView       pdu;
+
+    std::vector<std::vector<uint8_t>> sent;
+    std::vector<std::vector<uint8_t>> framed;
+    for (size_t i = 0; i < 200; i++)
+    {
+        const std::vector<uint8_t> record =
+            i % 5 == 0 ? indefinite_pdu : encode_string(std::string(i % 60, char('a' + i % 26)));
+        sent.push_back(record);
+
+        // Written in chunks of up to 7 bytes through prepare and commit
+        size_t written = 0;
+        while (written < record.size())
+        {
+            const std::span<uint8_t> space = decoder.prepare();
+            REQUIRE(!space.empty());
+            const size_t length = std::min({space.size(), record.size() - written, size_t(7)});
+            std::copy_n(record.begin() + static_cast<std::ptrdiff_t>(written), length, space.begin());
+            decoder.commit(length);
+            written += length;
+
+            while (decoder.next(pdu) == fast_ber::StreamStatus::complete)
+            {
+                REQUIRE(pdu.is_valid());
+                framed.push_back(to_vector(pdu));
+            }
+        }
+    }
+    REQUIRE(framed == sent);
+
+    // Views are decodable
+    REQUIRE(decoder.push(encode_string("decode")) == 8);
+    REQUIRE(decoder.next(pdu) == fast_ber::StreamStatus::complete);
+    fast_ber::OctetString<> string;
+    REQUIRE(string.decode(pdu).success);
+    REQUIRE(string == "decode");
+}
+
+TEST_CASE("StreamDecoder: Malformed streams")
+{
+    fast_ber::BerView pdu;
+
+    // Too many length octets
+    fast_ber::StreamDecoder decoder;
+    const uint8_t           bad_length[] = {0x04, 0xFF, 0x01};
+    decoder.push(bad_length);
+    REQUIRE(decoder.next(pdu) == fast_ber::StreamStatus::malformed);
+    REQUIRE(decoder.next(pdu) == fast_ber::StreamStatus::malformed);
+
+    decoder.reset();
+    REQUIRE(decoder.buffered() == 0);
+    decoder.push(encode_string("recovered"));
+    REQUIRE(decoder.next(pdu) == fast_ber::StreamStatus::complete);
+    REQUIRE(pdu.content_length() == 9);
+
+    // Indefinite length primitive packet
+    decoder.reset();
+    const uint8_t indefinite_primitive[] = {0x04, 0x80, 0x00, 0x00};
+    decoder.push(indefinite_primitive);
+    REQUIRE(decoder.next(pdu) == fast_ber::StreamStatus::malformed);
+
+    // Largest definite length, not the indefinite form, and larger than the buffer
+    decoder.reset();
+    const uint8_t largest_length[] = {0x30, 0x88, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00};
+    decoder.push(largest_length);
+    REQUIRE(decoder.next(pdu) == fast_ber::StreamStatus::malformed);
+
+    // Partial, but larger than the buffer
+    fast_ber::StreamDecoder small(16);
+    const uint8_t           large[] = {0x04, 0x20, 'a', 'b'};
+    small.push(large);
+    REQUIRE(small.next(pdu) == fast_ber::StreamStatus::malformed);
+
+    // Buffers shorter than the header, which can never be completed
+    fast_ber::StreamDecoder tiny(1);
+    const uint8_t           short_form[] = {0x04, 0x01, 'a'};
+    REQUIRE(tiny.push(short_form) == 1);
+    REQUIRE(tiny.next(pdu) == fast_ber::StreamStatus::malformed);
+
+    fast_ber::StreamDecoder three(3);
+    const uint8_t           long_form[] = {0x04, 0x82, 0x00, 0x01, 'a'};
+    REQUIRE(three.push(long_form) == 3);
+    REQUIRE(three.next(pdu) == fast_ber::StreamStatus::malformed);
+
+    // Incomplete headers are not malformed
+    fast_ber::StreamDecoder partial;
+    const uint8_t           long_tag[] = {0x1F, 0x81};
+    partial.push(long_tag);
+    REQUIRE(partial.next(pdu) == fast_ber::StreamStatus::need_more);
+    REQUIRE(partial.needed() == 1);
+}